@@ -102,6 +102,34 @@ Utf16String Utf16String::from_utf32(Utf32View const& utf32_string)
     return Utf16String { Detail::Utf16StringData::from_utf32(utf32_string) };
 }
 
+// Copying substrings shorter than this is about as cheap as allocating the shared substring data.
+static constexpr size_t MINIMUM_LENGTH_FOR_SHARED_SUBSTRING = 64;
+
+// Any substring may share the storage of a string up to this length. Beyond it, a substring must cover at least
+// 1/MAXIMUM_SHARED_SUPERSTRING_WASTE_FACTOR of the superstring to share it.
+static constexpr size_t MAXIMUM_LENGTH_FOR_UNCONDITIONALLY_SHARED_SUPERSTRING = 4 * KiB;
+static constexpr size_t MAXIMUM_SHARED_SUPERSTRING_WASTE_FACTOR = 32;
+
+Utf16String Utf16String::substring_with_shared_superstring(size_t code_unit_offset, size_t code_unit_length) const
+{
+    auto const superstring_length = length_in_code_units();
+    VERIFY(code_unit_offset + code_unit_length <= superstring_length);
+
+    if (code_unit_offset == 0 && code_unit_length == superstring_length)
+        return *this;
+
+    if (has_short_ascii_storage() || code_unit_length < MINIMUM_LENGTH_FOR_SHARED_SUBSTRING)
+        return from_utf16(substring_view(code_unit_offset, code_unit_length));
+
+    auto const& data = *data_without_union_member_assertion();
+    auto owner_length = data.storage_owner().length_in_code_units();
+
+    if (owner_length > MAXIMUM_LENGTH_FOR_UNCONDITIONALLY_SHARED_SUPERSTRING && code_unit_length * MAXIMUM_SHARED_SUPERSTRING_WASTE_FACTOR < owner_length)
+        return from_utf16(substring_view(code_unit_offset, code_unit_length));
+
+    return Utf16String { Detail::Utf16StringData::create_substring(data, code_unit_offset, code_unit_length) };
+}
+
 Utf16String Utf16String::from_string_builder(Badge<StringBuilder>, StringBuilder& builder)
 {
     auto view = builder.utf16_string_view();
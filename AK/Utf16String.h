@@ -212,6 +212,14 @@ public:
 
     ALWAYS_INLINE Utf16String escape_html_entities() const { return utf16_view().escape_html_entities(); }
 
+    // Long substrings share this string's storage rather than copying it, unless they are only a small part of a large
+    // string, as they would otherwise keep the whole string alive.
+    Utf16String substring_with_shared_superstring(size_t code_unit_offset, size_t code_unit_length) const;
+    Utf16String substring_with_shared_superstring(size_t code_unit_offset) const
+    {
+        return substring_with_shared_superstring(code_unit_offset, length_in_code_units() - code_unit_offset);
+    }
+
     static Utf16String from_string_builder(Badge<StringBuilder>, StringBuilder& builder);
     static ErrorOr<Utf16String> from_ipc_stream(Stream&, size_t length_in_code_units, bool is_ascii);
 
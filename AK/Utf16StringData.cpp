@@ -199,12 +199,34 @@ NonnullRefPtr<Utf16StringData> Utf16StringData::to_well_formed(Utf16View const&
     return string;
 }
 
+NonnullRefPtr<Utf16StringData> Utf16StringData::create_substring(Utf16StringData const& superstring, size_t code_unit_offset, size_t code_unit_length)
+{
+    VERIFY(code_unit_offset + code_unit_length <= superstring.length_in_code_units());
+
+    // Always refer to the string that owns the code units, so that substrings of substrings don't form chains.
+    auto const& owner = superstring.storage_owner();
+    if (superstring.is_substring())
+        code_unit_offset += superstring.substring_data().code_unit_offset;
+
+    void* slot = kmalloc(sizeof(Utf16StringData) + sizeof(SubstringData));
+    VERIFY(slot);
+
+    auto storage_type = owner.has_ascii_storage() ? StorageType::ASCII : StorageType::UTF16;
+    auto string = adopt_ref(*new (slot) Utf16StringData(storage_type, code_unit_length));
+    string->m_is_substring = true;
+
+    new (&string->m_substring_data[0]) SubstringData { .superstring = &owner, .code_unit_offset = code_unit_offset };
+    owner.ref();
+
+    return string;
+}
+
 size_t Utf16StringData::calculate_code_point_length() const
 {
     ASSERT(!has_ascii_storage());
 
-    if (simdutf::validate_utf16(m_utf16_data, length_in_code_units()))
-        return simdutf::count_utf16(m_utf16_data, length_in_code_units());
+    if (simdutf::validate_utf16(utf16_data(), length_in_code_units()))
+        return simdutf::count_utf16(utf16_data(), length_in_code_units());
 
     size_t code_points = 0;
     for ([[maybe_unused]] auto code_point : utf16_view())
@@ -40,10 +40,16 @@ public:
 
     static NonnullRefPtr<Utf16StringData> to_well_formed(Utf16View const&);
 
+    // Creates string data that refers to a range of the superstring's code units, rather than copying them. The
+    // superstring is kept alive for as long as the substring is.
+    static NonnullRefPtr<Utf16StringData> create_substring(Utf16StringData const& superstring, size_t code_unit_offset, size_t code_unit_length);
+
     ~Utf16StringData()
     {
         if (is_fly_string())
             did_destroy_utf16_fly_string_data({}, *this);
+        if (m_is_substring)
+            substring_data().superstring->unref();
     }
 
     [[nodiscard]] static constexpr size_t offset_of_string_storage()
@@ -101,15 +107,15 @@ public:
     [[nodiscard]] ALWAYS_INLINE StringView ascii_view() const LIFETIME_BOUND
     {
         ASSERT(has_ascii_storage());
-        return { m_ascii_data, length_in_code_units() };
+        return { ascii_data(), length_in_code_units() };
     }
 
     [[nodiscard]] ALWAYS_INLINE Utf16View utf16_view() const LIFETIME_BOUND
     {
         if (has_ascii_storage())
-            return { m_ascii_data, length_in_code_units() };
+            return { ascii_data(), length_in_code_units() };
 
-        Utf16View view { m_utf16_data, length_in_code_units() };
+        Utf16View view { utf16_data(), length_in_code_units() };
         view.m_length_in_code_points = m_length_in_code_points;
 
         return view;
@@ -118,7 +124,42 @@ public:
     ALWAYS_INLINE void mark_as_fly_string(Badge<Utf16FlyString>) const { m_is_fly_string = true; }
     [[nodiscard]] ALWAYS_INLINE bool is_fly_string() const { return m_is_fly_string; }
 
+    [[nodiscard]] ALWAYS_INLINE bool is_substring() const { return m_is_substring; }
+
+    // The string data that ultimately owns this string's code units.
+    [[nodiscard]] ALWAYS_INLINE Utf16StringData const& storage_owner() const
+    {
+        if (m_is_substring)
+            return *substring_data().superstring;
+        return *this;
+    }
+
 private:
+    struct SubstringData {
+        Utf16StringData const* superstring { nullptr };
+        size_t code_unit_offset { 0 };
+    };
+
+    ALWAYS_INLINE SubstringData const& substring_data() const
+    {
+        ASSERT(m_is_substring);
+        return m_substring_data[0];
+    }
+
+    ALWAYS_INLINE char const* ascii_data() const
+    {
+        if (m_is_substring) [[unlikely]]
+            return substring_data().superstring->m_ascii_data + substring_data().code_unit_offset;
+        return m_ascii_data;
+    }
+
+    ALWAYS_INLINE char16_t const* utf16_data() const
+    {
+        if (m_is_substring) [[unlikely]]
+            return substring_data().superstring->m_utf16_data + substring_data().code_unit_offset;
+        return m_utf16_data;
+    }
+
     ALWAYS_INLINE Utf16StringData(StorageType storage_type, size_t code_unit_length)
         : m_length_in_code_units(code_unit_length)
     {
@@ -151,9 +192,12 @@ private:
 
     mutable bool m_is_fly_string { false };
 
+    bool m_is_substring { false };
+
     union {
         char m_ascii_data[0];
         char16_t m_utf16_data[0];
+        SubstringData m_substring_data[0];
     };
 };
 
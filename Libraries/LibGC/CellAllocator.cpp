@@ -25,6 +25,10 @@ Cell* CellAllocator::allocate_cell(Heap& heap)
     if (!m_list_node.is_in_list())
         heap.register_cell_allocator({}, *this);
 
+    // Blocks are swept lazily after a collection, the first time we need to take cells from them.
+    while (m_usable_blocks.is_empty() && !m_blocks_needing_sweep.is_empty())
+        sweep_block(heap, *m_blocks_needing_sweep.first());
+
     if (m_usable_blocks.is_empty()) {
         auto block = HeapBlock::create_with_cell_size(heap, *this, m_cell_size, m_overrides_must_survive_garbage_collection, m_overrides_finalize);
         auto block_ptr = reinterpret_cast<FlatPtr>(block.ptr());
@@ -36,6 +40,7 @@ Cell* CellAllocator::allocate_cell(Heap& heap)
     }
 
     auto& block = *m_usable_blocks.last();
+    VERIFY(!block.needs_sweep());
     auto* cell = block.allocate();
     VERIFY(cell);
     if (block.is_full())
@@ -43,18 +48,45 @@ Cell* CellAllocator::allocate_cell(Heap& heap)
     return cell;
 }
 
-void CellAllocator::block_did_become_empty(Badge<Heap>, HeapBlock& block)
+size_t CellAllocator::mark_all_blocks_as_needing_sweep(Badge<Heap>)
 {
-    block.m_list_node.remove();
-    // NOTE: HeapBlocks are managed by the BlockAllocator, so we don't want to `delete` the block here.
-    block.~HeapBlock();
-    m_block_allocator.deallocate_block(&block);
+    size_t block_count = 0;
+    auto move_blocks = [&](BlockList& list) {
+        while (auto* block = list.take_first()) {
+            block->set_needs_sweep(true);
+            m_blocks_needing_sweep.append(*block);
+            ++block_count;
+        }
+    };
+    // NOTE: Usable blocks go first, since they are the most likely to have free cells after sweeping.
+    move_blocks(m_usable_blocks);
+    move_blocks(m_full_blocks);
+    return block_count;
+}
+
+bool CellAllocator::sweep_next_block(Badge<Heap>, Heap& heap)
+{
+    if (m_blocks_needing_sweep.is_empty())
+        return false;
+    sweep_block(heap, *m_blocks_needing_sweep.first());
+    return true;
 }
 
-void CellAllocator::block_did_become_usable(Badge<Heap>, HeapBlock& block)
+void CellAllocator::sweep_block(Heap& heap, HeapBlock& block)
 {
-    VERIFY(!block.is_full());
-    m_usable_blocks.append(block);
+    block.m_list_node.remove();
+
+    if (!heap.sweep_block({}, block)) {
+        // NOTE: HeapBlocks are managed by the BlockAllocator, so we don't want to `delete` the block here.
+        block.~HeapBlock();
+        m_block_allocator.deallocate_block(&block);
+        return;
+    }
+
+    if (block.is_full())
+        m_full_blocks.append(block);
+    else
+        m_usable_blocks.append(block);
 }
 
 }
@@ -50,11 +50,19 @@ public:
             if (callback(block) == IterationDecision::Break)
                 return IterationDecision::Break;
         }
+        for (auto& block : m_blocks_needing_sweep) {
+            if (callback(block) == IterationDecision::Break)
+                return IterationDecision::Break;
+        }
         return IterationDecision::Continue;
     }
 
-    void block_did_become_empty(Badge<Heap>, HeapBlock&);
-    void block_did_become_usable(Badge<Heap>, HeapBlock&);
+    // Returns the number of blocks that were handed over for sweeping.
+    size_t mark_all_blocks_as_needing_sweep(Badge<Heap>);
+    bool has_blocks_needing_sweep() const { return !m_blocks_needing_sweep.is_empty(); }
+
+    // Returns false if there was no block left to sweep.
+    bool sweep_next_block(Badge<Heap>, Heap&);
 
     IntrusiveListNode<CellAllocator> m_list_node;
     using List = IntrusiveList<&CellAllocator::m_list_node>;
@@ -64,6 +72,8 @@ public:
     FlatPtr max_block_address() const { return m_max_block_address; }
 
 private:
+    void sweep_block(Heap&, HeapBlock&);
+
     Optional<StringView> m_class_name;
     size_t const m_cell_size;
 
@@ -72,6 +82,7 @@ private:
     using BlockList = IntrusiveList<&HeapBlock::m_list_node>;
     BlockList m_full_blocks;
     BlockList m_usable_blocks;
+    BlockList m_blocks_needing_sweep;
     FlatPtr m_min_block_address { explode_byte(0xff) };
     FlatPtr m_max_block_address { 0 };
     bool m_overrides_must_survive_garbage_collection { false };
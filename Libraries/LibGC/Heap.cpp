@@ -5,6 +5,7 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <AK/AtomicRefCounted.h>
 #include <AK/Badge.h>
 #include <AK/BinarySearch.h>
 #include <AK/Debug.h>
@@ -26,7 +27,11 @@
 #include <LibGC/NanBoxedValue.h>
 #include <LibGC/Root.h>
 #include <LibGC/Weak.h>
+#include <LibThreading/ConditionVariable.h>
+#include <LibThreading/Mutex.h>
+#include <LibThreading/ThreadPool.h>
 #include <setjmp.h>
+#include <stdlib.h>
 
 #ifdef HAS_ADDRESS_SANITIZER
 #    include <sanitizer/asan_interface.h>
@@ -49,6 +54,8 @@ Heap::Heap(AK::Function<void(HashMap<Cell*, GC::HeapRoot>&)> gather_embedder_roo
     : m_gather_embedder_roots(move(gather_embedder_roots))
 {
     s_the = this;
+    if (auto const* env = getenv("LIBGC_MARKING_HELPER_THREADS"))
+        m_marking_helper_thread_count = StringView { env, strlen(env) }.to_number<size_t>().value_or(0);
     static_assert(HeapBlock::min_possible_cell_size <= 32, "Heap Cell tracking uses too much data!");
     m_size_based_cell_allocators.append(make<CellAllocator>(64));
     m_size_based_cell_allocators.append(make<CellAllocator>(96));
@@ -271,6 +278,8 @@ private:
 
 AK::JsonObject Heap::dump_graph()
 {
+    finish_sweeping();
+
     HashMap<Cell*, HeapRoot> roots;
     HashTable<HeapBlock*> all_live_heap_blocks;
     Vector<StackFrameInfo> stack_frames;
@@ -304,22 +313,43 @@ void Heap::collect_garbage(CollectionType collection_type, bool print_report)
         if (print_report)
             collection_measurement_timer.start();
 
+        auto phase_timer = Core::ElapsedTimer::start_new(Core::TimerType::Precise);
+        AK::Duration mark_time;
+        AK::Duration eager_sweep_time;
+
+        // NOTE: Blocks left over from the previous collection must be swept before we mark again. They still hold
+        //       that collection's mark bits, and conservative scanning would mistake their dead cells for live ones.
         if (collection_type == CollectionType::CollectGarbage) {
             if (m_gc_deferrals) {
                 m_should_gc_when_deferral_ends = true;
                 return;
             }
+            finish_sweeping();
+            eager_sweep_time = phase_timer.elapsed_time();
+
+            phase_timer.start();
             HashMap<Cell*, HeapRoot> roots;
             HashTable<HeapBlock*> all_live_heap_blocks;
             gather_roots(roots, all_live_heap_blocks);
             mark_live_cells(roots, all_live_heap_blocks);
+            mark_time = phase_timer.elapsed_time();
+        } else {
+            finish_sweeping();
+            eager_sweep_time = phase_timer.elapsed_time();
         }
         finalize_unmarked_cells();
         sweep_weak_blocks();
-        sweep_dead_cells(print_report, collection_measurement_timer);
 
-        if (print_report)
+        auto lazy_sweep_time = m_sweep_statistics.lazy_sweep_time;
+        phase_timer.start();
+        // NOTE: Tearing down the heap and printing a complete report both need every block swept right away.
+        sweep_dead_cells(collection_type == CollectionType::CollectEverything || print_report);
+        eager_sweep_time += phase_timer.elapsed_time();
+
+        if (print_report) {
+            dump_collection_report(collection_measurement_timer, mark_time, eager_sweep_time, lazy_sweep_time);
             dump_allocators();
+        }
     }
 
     run_post_gc_tasks();
@@ -601,13 +631,75 @@ NO_SANITIZE_ADDRESS void Heap::gather_conservative_roots(HashMap<Cell*, HeapRoot
     });
 }
 
+// Shared state for parallel marking. Each participant owns a local work queue and hands half of it over
+// as a packet whenever another participant has run dry. Marking is done once every participant is idle
+// and no packets are left. This is reference counted so that helper jobs which only get scheduled after
+// marking has finished can still safely observe that fact and bail out.
+class ParallelMarkingState final : public AtomicRefCounted<ParallelMarkingState> {
+public:
+    using Packet = Vector<Ref<Cell>>;
+
+    static constexpr size_t minimum_shareable_work_queue_size = 64;
+
+    // Returns false if marking has already finished, in which case the caller must not touch the heap.
+    bool join()
+    {
+        Threading::MutexLocker locker(m_mutex);
+        if (m_finished)
+            return false;
+        ++m_participant_count;
+        return true;
+    }
+
+    bool has_idle_participants() const { return m_idle_participant_count.load(AK::memory_order_relaxed) > 0; }
+
+    void donate(Packet&& packet)
+    {
+        Threading::MutexLocker locker(m_mutex);
+        m_packets.append(move(packet));
+        m_condition.signal();
+    }
+
+    // Blocks until either a packet becomes available or every participant has run out of work.
+    Optional<Packet> take()
+    {
+        Threading::MutexLocker locker(m_mutex);
+        while (m_packets.is_empty()) {
+            if (m_finished)
+                return {};
+            if (m_idle_participant_count.load(AK::memory_order_relaxed) + 1 == m_participant_count) {
+                m_finished = true;
+                m_condition.broadcast();
+                return {};
+            }
+            m_idle_participant_count.fetch_add(1, AK::memory_order_relaxed);
+            m_condition.wait();
+            m_idle_participant_count.fetch_sub(1, AK::memory_order_relaxed);
+        }
+        return m_packets.take_last();
+    }
+
+private:
+    Threading::Mutex m_mutex;
+    Threading::ConditionVariable m_condition { m_mutex };
+    Vector<Packet> m_packets;
+    size_t m_participant_count { 0 };
+    Atomic<size_t> m_idle_participant_count { 0 };
+    bool m_finished { false };
+};
+
 class MarkingVisitor final : public Cell::Visitor {
 public:
-    explicit MarkingVisitor(Heap& heap, HashMap<Cell*, HeapRoot> const& roots, HashTable<HeapBlock*> const& all_live_heap_blocks)
+    explicit MarkingVisitor(Heap& heap, HashTable<HeapBlock*> const& all_live_heap_blocks, ParallelMarkingState* parallel_state = nullptr)
         : m_heap(heap)
         , m_all_live_heap_blocks(all_live_heap_blocks)
+        , m_parallel_state(parallel_state)
     {
         m_heap.find_min_and_max_block_addresses(m_min_block_address, m_max_block_address);
+    }
+
+    void visit_roots(HashMap<Cell*, HeapRoot> const& roots)
+    {
         for (auto* root : roots.keys()) {
             visit(root);
         }
@@ -615,11 +707,10 @@ public:
 
     virtual void visit_impl(Cell& cell) override
     {
-        if (cell.is_marked())
+        if (!try_mark(cell))
             return;
         dbgln_if(HEAP_DEBUG, "  ! {}", &cell);
 
-        cell.set_marked(true);
         m_work_queue.append(cell);
     }
 
@@ -631,11 +722,10 @@ public:
             if (!value.is_cell())
                 continue;
             auto& cell = value.as_cell();
-            if (cell.is_marked())
+            if (!try_mark(cell))
                 continue;
             dbgln_if(HEAP_DEBUG, "  ! {}", &cell);
 
-            cell.set_marked(true);
             m_work_queue.unchecked_append(cell);
         }
     }
@@ -649,26 +739,65 @@ public:
             add_possible_value(possible_pointers, raw_pointer_sized_values[i], HeapRoot { .type = HeapRoot::Type::HeapFunctionCapturedPointer }, m_min_block_address, m_max_block_address);
 
         for_each_cell_among_possible_pointers(m_all_live_heap_blocks, possible_pointers, [&](Cell* cell, FlatPtr) {
-            if (cell->is_marked())
-                return;
             if (cell->state() != Cell::State::Live)
                 return;
-            cell->set_marked(true);
+            if (!try_mark(*cell))
+                return;
             m_work_queue.append(*cell);
         });
     }
 
     void mark_all_live_cells()
     {
-        while (!m_work_queue.is_empty()) {
-            m_work_queue.take_last()->visit_edges(*this);
+        while (true) {
+            while (!m_work_queue.is_empty()) {
+                m_work_queue.take_last()->visit_edges(*this);
+                if (m_parallel_state)
+                    share_work_if_needed();
+            }
+
+            if (!m_parallel_state)
+                return;
+            auto packet = m_parallel_state->take();
+            if (!packet.has_value())
+                return;
+            m_work_queue = packet.release_value();
         }
     }
 
 private:
+    ALWAYS_INLINE bool try_mark(Cell& cell)
+    {
+        if (!m_parallel_state) {
+            if (cell.is_marked())
+                return false;
+            cell.set_marked(true);
+            return true;
+        }
+        if (cell.is_marked_atomic())
+            return false;
+        return cell.try_set_marked_atomic();
+    }
+
+    void share_work_if_needed()
+    {
+        if (m_work_queue.size() < ParallelMarkingState::minimum_shareable_work_queue_size)
+            return;
+        if (!m_parallel_state->has_idle_participants())
+            return;
+
+        auto packet_size = m_work_queue.size() / 2;
+        ParallelMarkingState::Packet packet;
+        packet.ensure_capacity(packet_size);
+        for (size_t i = 0; i < packet_size; ++i)
+            packet.unchecked_append(m_work_queue.take_last());
+        m_parallel_state->donate(move(packet));
+    }
+
     Heap& m_heap;
     Vector<Ref<Cell>> m_work_queue;
     HashTable<HeapBlock*> const& m_all_live_heap_blocks;
+    ParallelMarkingState* m_parallel_state { nullptr };
     FlatPtr m_min_block_address;
     FlatPtr m_max_block_address;
 };
@@ -677,8 +806,29 @@ void Heap::mark_live_cells(HashMap<Cell*, HeapRoot> const& roots, HashTable<Heap
 {
     dbgln_if(HEAP_DEBUG, "mark_live_cells:");
 
-    MarkingVisitor visitor(*this, roots, all_live_heap_blocks);
-    visitor.mark_all_live_cells();
+    if (m_marking_helper_thread_count == 0) {
+        MarkingVisitor visitor(*this, all_live_heap_blocks);
+        visitor.visit_roots(roots);
+        visitor.mark_all_live_cells();
+    } else {
+        auto parallel_state = adopt_ref(*new ParallelMarkingState);
+        auto main_thread_joined = parallel_state->join();
+        VERIFY(main_thread_joined);
+
+        for (size_t i = 0; i < m_marking_helper_thread_count; ++i) {
+            Threading::ThreadPool::the().submit([this, parallel_state, &all_live_heap_blocks] {
+                // NOTE: If marking finished before this job got to run, all_live_heap_blocks is already gone.
+                if (!parallel_state->join())
+                    return;
+                MarkingVisitor visitor(*this, all_live_heap_blocks, parallel_state.ptr());
+                visitor.mark_all_live_cells();
+            });
+        }
+
+        MarkingVisitor visitor(*this, all_live_heap_blocks, parallel_state.ptr());
+        visitor.visit_roots(roots);
+        visitor.mark_all_live_cells();
+    }
 
     for (auto& inverse_root : m_uprooted_cells)
         inverse_root->set_marked(false);
@@ -715,55 +865,26 @@ void Heap::sweep_weak_blocks()
     }
 }
 
-void Heap::sweep_dead_cells(bool print_report, Core::ElapsedTimer const& measurement_timer)
+void Heap::sweep_dead_cells(bool sweep_eagerly)
 {
     dbgln_if(HEAP_DEBUG, "sweep_dead_cells:");
-    Vector<HeapBlock*, 32> empty_blocks;
-    Vector<HeapBlock*, 32> full_blocks_that_became_usable;
-
-    size_t collected_cells = 0;
-    size_t live_cells = 0;
-    size_t collected_cell_bytes = 0;
-    size_t live_cell_bytes = 0;
-
-    for_each_block([&](auto& block) {
-        bool block_has_live_cells = false;
-        bool block_was_full = block.is_full();
-        block.template for_each_cell_in_state<Cell::State::Live>([&](Cell* cell) {
-            if (!cell->is_marked()) {
-                dbgln_if(HEAP_DEBUG, "  ~ {}", cell);
-                block.deallocate(cell);
-                ++collected_cells;
-                collected_cell_bytes += block.cell_size();
-            } else {
-                cell->set_marked(false);
-                block_has_live_cells = true;
-                ++live_cells;
-                live_cell_bytes += block.cell_size();
-            }
-        });
-        if (!block_has_live_cells)
-            empty_blocks.append(&block);
-        else if (block_was_full != block.is_full())
-            full_blocks_that_became_usable.append(&block);
-        return IterationDecision::Continue;
-    });
 
+    // NOTE: Nothing has been swept yet at this point, so weak containers and sweep callbacks see every cell
+    //       that survived this collection as marked, and every dead cell as unmarked.
     for (auto& weak_container : m_weak_containers)
         weak_container.remove_dead_cells({});
 
     for (auto& callback : m_sweep_callbacks)
         callback();
 
-    for (auto* block : empty_blocks) {
-        dbgln_if(HEAP_DEBUG, " - HeapBlock empty @ {}: cell_size={}", block, block->cell_size());
-        block->cell_allocator().block_did_become_empty({}, *block);
-    }
+    m_sweep_statistics = {};
 
-    for (auto* block : full_blocks_that_became_usable) {
-        dbgln_if(HEAP_DEBUG, " - HeapBlock usable again @ {}: cell_size={}", block, block->cell_size());
-        block->cell_allocator().block_did_become_usable({}, *block);
-    }
+    VERIFY(!has_blocks_needing_sweep());
+    for (auto& allocator : m_all_cell_allocators)
+        m_blocks_needing_sweep_count += allocator.mark_all_blocks_as_needing_sweep({});
+
+    if (sweep_eagerly)
+        finish_sweeping();
 
     if constexpr (HEAP_DEBUG) {
         for_each_block([&](auto& block) {
@@ -771,26 +892,93 @@ void Heap::sweep_dead_cells(bool print_report, Core::ElapsedTimer const& measure
             return IterationDecision::Continue;
         });
     }
+}
 
-    m_gc_bytes_threshold = live_cell_bytes > GC_MIN_BYTES_THRESHOLD ? live_cell_bytes : GC_MIN_BYTES_THRESHOLD;
+void Heap::dump_collection_report(Core::ElapsedTimer const& measurement_timer, AK::Duration mark_time, AK::Duration eager_sweep_time, AK::Duration previous_lazy_sweep_time)
+{
+    AK::Duration const time_spent = measurement_timer.elapsed_time();
+    size_t live_block_count = 0;
+    for_each_block([&](auto&) {
+        ++live_block_count;
+        return IterationDecision::Continue;
+    });
 
-    if (print_report) {
-        AK::Duration const time_spent = measurement_timer.elapsed_time();
-        size_t live_block_count = 0;
-        for_each_block([&](auto&) {
-            ++live_block_count;
-            return IterationDecision::Continue;
-        });
+    auto const& statistics = m_sweep_statistics;
+    dbgln("Garbage collection report");
+    dbgln("=============================================");
+    dbgln("      Time spent: {} ms", time_spent.to_milliseconds());
+    dbgln("       Mark time: {} ms", mark_time.to_milliseconds());
+    dbgln("Eager sweep time: {} ms", eager_sweep_time.to_milliseconds());
+    dbgln(" Lazy sweep time: {} ms (since previous collection)", previous_lazy_sweep_time.to_milliseconds());
+    dbgln("      Live cells: {} ({} bytes)", statistics.live_cells, statistics.live_cell_bytes);
+    dbgln(" Collected cells: {} ({} bytes)", statistics.collected_cells, statistics.collected_cell_bytes);
+    dbgln("     Live blocks: {} ({} bytes)", live_block_count, live_block_count * HeapBlock::BLOCK_SIZE);
+    dbgln("    Freed blocks: {} ({} bytes)", statistics.freed_blocks, statistics.freed_blocks * HeapBlock::BLOCK_SIZE);
+    dbgln("=============================================");
+}
 
-        dbgln("Garbage collection report");
-        dbgln("=============================================");
-        dbgln("     Time spent: {} ms", time_spent.to_milliseconds());
-        dbgln("     Live cells: {} ({} bytes)", live_cells, live_cell_bytes);
-        dbgln("Collected cells: {} ({} bytes)", collected_cells, collected_cell_bytes);
-        dbgln("    Live blocks: {} ({} bytes)", live_block_count, live_block_count * HeapBlock::BLOCK_SIZE);
-        dbgln("   Freed blocks: {} ({} bytes)", empty_blocks.size(), empty_blocks.size() * HeapBlock::BLOCK_SIZE);
-        dbgln("=============================================");
+bool Heap::sweep_block(Badge<CellAllocator>, HeapBlock& block)
+{
+    VERIFY(block.needs_sweep());
+    auto timer = Core::ElapsedTimer::start_new(Core::TimerType::Precise);
+
+    auto& statistics = m_sweep_statistics;
+    bool block_has_live_cells = false;
+    block.for_each_cell_in_state<Cell::State::Live>([&](Cell* cell) {
+        if (!cell->is_marked()) {
+            dbgln_if(HEAP_DEBUG, "  ~ {}", cell);
+            block.deallocate(cell);
+            ++statistics.collected_cells;
+            statistics.collected_cell_bytes += block.cell_size();
+        } else {
+            cell->set_marked(false);
+            block_has_live_cells = true;
+            ++statistics.live_cells;
+            statistics.live_cell_bytes += block.cell_size();
+        }
+    });
+    block.set_needs_sweep(false);
+
+    if (!block_has_live_cells) {
+        dbgln_if(HEAP_DEBUG, " - HeapBlock empty @ {}: cell_size={}", &block, block.cell_size());
+        ++statistics.freed_blocks;
+    }
+
+    if (!m_collecting_garbage)
+        statistics.lazy_sweep_time += timer.elapsed_time();
+
+    VERIFY(m_blocks_needing_sweep_count > 0);
+    if (--m_blocks_needing_sweep_count == 0)
+        did_finish_sweeping();
+
+    return block_has_live_cells;
+}
+
+void Heap::sweep_lazily(AK::Duration time_budget)
+{
+    auto timer = Core::ElapsedTimer::start_new(Core::TimerType::Precise);
+    for (auto& allocator : m_all_cell_allocators) {
+        while (allocator.sweep_next_block({}, *this)) {
+            if (timer.elapsed_time() >= time_budget)
+                return;
+        }
+    }
+}
+
+void Heap::finish_sweeping()
+{
+    if (!has_blocks_needing_sweep())
+        return;
+    for (auto& allocator : m_all_cell_allocators) {
+        while (allocator.sweep_next_block({}, *this)) { }
     }
+    VERIFY(!has_blocks_needing_sweep());
+}
+
+void Heap::did_finish_sweeping()
+{
+    auto live_cell_bytes = m_sweep_statistics.live_cell_bytes;
+    m_gc_bytes_threshold = live_cell_bytes > GC_MIN_BYTES_THRESHOLD ? live_cell_bytes : GC_MIN_BYTES_THRESHOLD;
 }
 
 void Heap::defer_gc()
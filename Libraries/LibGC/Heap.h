@@ -11,6 +11,7 @@
 #include <AK/Noncopyable.h>
 #include <AK/NonnullOwnPtr.h>
 #include <AK/StackInfo.h>
+#include <AK/Time.h>
 #include <AK/String.h>
 #include <AK/Types.h>
 #include <AK/Vector.h>
@@ -64,6 +65,12 @@ public:
     bool should_collect_on_every_allocation() const { return m_should_collect_on_every_allocation; }
     void set_should_collect_on_every_allocation(bool b) { m_should_collect_on_every_allocation = b; }
 
+    // Number of thread pool jobs that help the collecting thread mark live cells. Zero means marking
+    // happens on the collecting thread only. Every visit_edges() reachable from this heap must be safe
+    // to run off the main thread before this is raised.
+    size_t marking_helper_thread_count() const { return m_marking_helper_thread_count; }
+    void set_marking_helper_thread_count(size_t count) { m_marking_helper_thread_count = count; }
+
     void did_create_root(Badge<RootImpl>, RootImpl&);
     void did_destroy_root(Badge<RootImpl>, RootImpl&);
 
@@ -83,6 +90,14 @@ public:
 
     void register_cell_allocator(Badge<CellAllocator>, CellAllocator&);
 
+    // Each collection leaves its dead cells in place and marks every block as needing sweep. Blocks are then
+    // swept as their allocator needs room, from idle time via sweep_lazily(), or at the start of the next collection.
+    bool has_blocks_needing_sweep() const { return m_blocks_needing_sweep_count > 0; }
+    void sweep_lazily(AK::Duration time_budget);
+
+    // Returns false if the block had no live cells left, in which case the caller should free it.
+    bool sweep_block(Badge<CellAllocator>, HeapBlock&);
+
     void uproot_cell(Cell* cell);
 
     bool is_gc_deferred() const { return m_gc_deferrals > 0; }
@@ -131,7 +146,10 @@ private:
     void gather_asan_fake_stack_roots(HashMap<FlatPtr, HeapRoot>&, FlatPtr, FlatPtr min_block_address, FlatPtr max_block_address);
     void mark_live_cells(HashMap<Cell*, HeapRoot> const& live_cells, HashTable<HeapBlock*> const& all_live_heap_blocks);
     void finalize_unmarked_cells();
-    void sweep_dead_cells(bool print_report, Core::ElapsedTimer const&);
+    void sweep_dead_cells(bool sweep_eagerly);
+    void dump_collection_report(Core::ElapsedTimer const&, AK::Duration mark_time, AK::Duration eager_sweep_time, AK::Duration previous_lazy_sweep_time);
+    void finish_sweeping();
+    void did_finish_sweeping();
     void sweep_weak_blocks();
     void run_post_gc_tasks();
 
@@ -159,8 +177,21 @@ private:
     size_t m_gc_bytes_threshold { GC_MIN_BYTES_THRESHOLD };
     size_t m_allocated_bytes_since_last_gc { 0 };
 
+    struct SweepStatistics {
+        size_t collected_cells { 0 };
+        size_t collected_cell_bytes { 0 };
+        size_t live_cells { 0 };
+        size_t live_cell_bytes { 0 };
+        size_t freed_blocks { 0 };
+        AK::Duration lazy_sweep_time;
+    };
+    SweepStatistics m_sweep_statistics;
+    size_t m_blocks_needing_sweep_count { 0 };
+
     bool m_should_collect_on_every_allocation { false };
 
+    size_t m_marking_helper_thread_count { 0 };
+
     Vector<NonnullOwnPtr<CellAllocator>> m_size_based_cell_allocators;
     CellAllocator::List m_all_cell_allocators;
 
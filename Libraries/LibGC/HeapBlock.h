@@ -95,6 +95,11 @@ public:
     bool overrides_must_survive_garbage_collection() const { return m_overrides_must_survive_garbage_collection; }
     bool overrides_finalize() const { return m_overrides_finalize; }
 
+    // Set on every block at the end of a collection. Until the block is swept, its surviving cells are still
+    // marked and its dead cells have not been deallocated yet, so nothing may be allocated from it.
+    bool needs_sweep() const { return m_needs_sweep; }
+    void set_needs_sweep(bool needs_sweep) { m_needs_sweep = needs_sweep; }
+
 private:
     HeapBlock(Heap&, CellAllocator&, size_t cell_size, bool overrides_must_survive_garbage_collection, bool overrides_finalize);
 
@@ -117,6 +122,7 @@ private:
 
     bool m_overrides_must_survive_garbage_collection { false };
     bool m_overrides_finalize { false };
+    bool m_needs_sweep { false };
 
     Ptr<FreelistEntry> m_freelist;
     alignas(__BIGGEST_ALIGNMENT__) u8 m_storage[];
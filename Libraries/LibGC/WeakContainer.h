@@ -16,6 +16,8 @@ public:
     explicit WeakContainer(Heap&);
     virtual ~WeakContainer();
 
+    // Called after marking, before any dead cell has been swept. Cells that did not survive the collection
+    // are exactly the ones that are not marked. The container itself may be dead at this point too.
     virtual void remove_dead_cells(Badge<Heap>) = 0;
 
 protected:
@@ -931,6 +931,14 @@ fn emit_instruction(
             emit_ldr64(out, "x28", "x20", interp_ctx);
         }
 
+        // load_interp: load the Interpreter* (pinned in x20) into a register
+        "load_interp" => {
+            if let Some(op) = insn.operands.first() {
+                let dst = resolve_op(op, handler, program);
+                w!(out, "    mov {dst}, x20");
+            }
+        }
+
         // dispatch_variable: advance ip by value in register and dispatch
         "dispatch_variable" => {
             if let Some(op) = insn.operands.first() {
@@ -412,6 +412,14 @@ fn emit_instruction(out: &mut String, insn: &AsmInstruction, handler: &Handler,
             w!(out, "    mov rbx, QWORD PTR [rcx + {interp_ctx}]");
         }
 
+        // load_interp: load the Interpreter* (saved on the stack) into a register
+        "load_interp" => {
+            if let Some(op) = insn.operands.first() {
+                let dst = resolve_op(op, handler, program);
+                w!(out, "    mov {dst}, QWORD PTR [rbp - 48]");
+            }
+        }
+
         // dispatch_variable pseudo-instruction: advance pc by value in register and dispatch
         "dispatch_variable" => {
             if let Some(op) = insn.operands.first() {
@@ -73,6 +73,8 @@
 //!   Result lands in `t0`. The handler continues. Does NOT reload pinned state.
 //! - `reload_exec_ctx` -- Reload the exec_ctx register from the Interpreter*.
 //!   Used after non-terminal calls that may modify the running execution context.
+//! - `load_interp dst` -- Load the Interpreter* into `dst`, e.g. to read one of
+//!   its fields without calling into C++.
 //!
 //! ### Bytecode operand access
 //!
@@ -282,6 +282,7 @@ i64 asm_slow_path_get_private_by_id(Interpreter*, u32 pc);
 i64 asm_slow_path_put_private_by_id(Interpreter*, u32 pc);
 i64 asm_slow_path_instance_of(Interpreter*, u32 pc);
 i64 asm_slow_path_resolve_this_binding(Interpreter*, u32 pc);
+i64 asm_slow_path_take_profiler_sample(Interpreter*, u32 pc);
 
 // ===== Fallback handler for opcodes without DSL handlers =====
 // NB: Opcodes with DSL handlers are dispatched directly and never reach here.
@@ -514,6 +515,25 @@ i64 asm_slow_path_decrement(Interpreter* interp, u32 pc)
     return slow_path_throwing<Op::Decrement>(*interp, pc);
 }
 
+// Backward jumps are loop back-edges, where the profiler gets its chance to take a sample (see jump_to in asmint.asm).
+static i64 take_jump(Interpreter& interp, u32 pc, u32 target)
+{
+    if (target <= pc) {
+        interp.running_execution_context().program_counter = pc;
+        Interpreter::vm().take_profiler_sample_if_requested();
+    }
+    return static_cast<i64>(target);
+}
+
+// Called by jump_to in asmint.asm at a loop back-edge when the profiler has asked for a sample. We resume at the
+// same jump instruction, which then finds the request handled and takes its jump.
+i64 asm_slow_path_take_profiler_sample(Interpreter* interp, u32 pc)
+{
+    interp->running_execution_context().program_counter = pc;
+    Interpreter::vm().take_profiler_sample_if_requested();
+    return static_cast<i64>(pc);
+}
+
 // Comparison jump slow paths - these are terminators (execute_impl returns void),
 // so they need custom handling instead of the generic slow_path_throwing template.
 #define DEFINE_JUMP_COMPARISON_SLOW_PATH(snake_name, op_name, compare_call)      \
@@ -528,8 +548,8 @@ i64 asm_slow_path_decrement(Interpreter* interp, u32 pc)
         if (result.is_error()) [[unlikely]]                                      \
             return handle_asm_exception(*interp, pc, result.error_value());      \
         if (result.value())                                                      \
-            return static_cast<i64>(insn.true_target().address());               \
-        return static_cast<i64>(insn.false_target().address());                  \
+            return take_jump(*interp, pc, insn.true_target().address());         \
+        return take_jump(*interp, pc, insn.false_target().address());            \
     }
 
 DEFINE_JUMP_COMPARISON_SLOW_PATH(less_than, LessThan, less_than(Interpreter::vm(), lhs, rhs))
@@ -550,8 +570,8 @@ i64 asm_slow_path_jump_loosely_inequals(Interpreter* interp, u32 pc)
     if (result.is_error()) [[unlikely]]
         return handle_asm_exception(*interp, pc, result.error_value());
     if (!result.value())
-        return static_cast<i64>(insn.true_target().address());
-    return static_cast<i64>(insn.false_target().address());
+        return take_jump(*interp, pc, insn.true_target().address());
+    return take_jump(*interp, pc, insn.false_target().address());
 }
 
 i64 asm_slow_path_jump_strictly_equals(Interpreter* interp, u32 pc)
@@ -562,8 +582,8 @@ i64 asm_slow_path_jump_strictly_equals(Interpreter* interp, u32 pc)
     auto lhs = interp->get(insn.lhs());
     auto rhs = interp->get(insn.rhs());
     if (is_strictly_equal(lhs, rhs))
-        return static_cast<i64>(insn.true_target().address());
-    return static_cast<i64>(insn.false_target().address());
+        return take_jump(*interp, pc, insn.true_target().address());
+    return take_jump(*interp, pc, insn.false_target().address());
 }
 
 i64 asm_slow_path_jump_strictly_inequals(Interpreter* interp, u32 pc)
@@ -574,8 +594,8 @@ i64 asm_slow_path_jump_strictly_inequals(Interpreter* interp, u32 pc)
     auto lhs = interp->get(insn.lhs());
     auto rhs = interp->get(insn.rhs());
     if (!is_strictly_equal(lhs, rhs))
-        return static_cast<i64>(insn.true_target().address());
-    return static_cast<i64>(insn.false_target().address());
+        return take_jump(*interp, pc, insn.true_target().address());
+    return take_jump(*interp, pc, insn.false_target().address());
 }
 
 // ===== Dedicated slow paths for hot instructions =====
@@ -903,6 +923,44 @@ i64 asm_try_put_by_id_cache(Interpreter* interp, u32 pc)
             continue;
         }
     }
+
+    if (cache.is_full() && insn.kind() == PutKind::Normal) {
+        auto& megamorphic_cache = interp->vm().megamorphic_property_cache();
+        auto const& property_key = interp->current_executable().get_property_key(insn.property());
+        auto const* megamorphic_entry = megamorphic_cache.find(MegamorphicPropertyCache::AccessKind::Put, object.shape(), property_key);
+        if (!megamorphic_entry)
+            return 1;
+        auto const& entry = megamorphic_entry->data;
+        switch (megamorphic_entry->type) {
+        case PropertyLookupCache::Entry::Type::ChangeOwnProperty: {
+            if (object.shape().is_dictionary()
+                && object.shape().dictionary_generation() != entry.shape_dictionary_generation)
+                return 1;
+            if (object.get_direct(entry.property_offset).is_accessor()) [[unlikely]]
+                return 1;
+            object.put_direct(entry.property_offset, value);
+            ++megamorphic_cache.hit_count;
+            return 0;
+        }
+        case PropertyLookupCache::Entry::Type::AddOwnProperty: {
+            auto cached_shape = entry.shape.ptr();
+            if (!cached_shape || !object.extensible()) [[unlikely]]
+                return 1;
+            if (cached_shape->is_dictionary()
+                && object.shape().dictionary_generation() != entry.shape_dictionary_generation)
+                return 1;
+            auto pcv = entry.prototype_chain_validity.ptr();
+            if (pcv && !pcv->is_valid()) [[unlikely]]
+                return 1;
+            object.unsafe_set_shape(*cached_shape);
+            object.put_direct(entry.property_offset, value);
+            ++megamorphic_cache.hit_count;
+            return 0;
+        }
+        default:
+            return 1;
+        }
+    }
     return 1;
 }
 
@@ -947,6 +1005,21 @@ i64 asm_try_get_by_id_cache(Interpreter* interp, u32 pc)
             return 0;
         }
     }
+
+    if (cache.is_full()) {
+        auto& megamorphic_cache = interp->vm().megamorphic_property_cache();
+        auto const& property_key = interp->current_executable().get_property_key(insn.property());
+        auto const* megamorphic_entry = megamorphic_cache.find(MegamorphicPropertyCache::AccessKind::Get, shape, property_key);
+        if (!megamorphic_entry || !can_use_get_cache_entry(megamorphic_entry->data, shape))
+            return 1;
+        auto const& entry = megamorphic_entry->data;
+        auto value = entry.prototype ? entry.prototype->get_direct(entry.property_offset) : object.get_direct(entry.property_offset);
+        if (value.is_accessor()) [[unlikely]]
+            return 1;
+        ++megamorphic_cache.hit_count;
+        interp->set(insn.dst(), value);
+        return 0;
+    }
     return 1;
 }
 
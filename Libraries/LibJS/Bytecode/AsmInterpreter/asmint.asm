@@ -124,6 +124,19 @@ macro coerce_to_doubles(both_int_label, fail)
 .coerced:
 end
 
+# Check that storing a value into Packed/Holey indexed storage keeps the
+# object's IndexedElementKind valid. Widening the kind is left to C++.
+# Expects t3 = Object*. Clobbers t0, t2. Jumps to fail if the kind would change.
+macro check_indexed_element_kind(reg, fail)
+    load8 t0, [t3, OBJECT_INDEXED_ELEMENT_KIND]
+    branch_eq t0, INDEXED_ELEMENT_KIND_GENERIC, .kind_ok
+    extract_tag t2, reg
+    branch_eq t2, INT32_TAG, .kind_ok
+    branch_eq t0, INDEXED_ELEMENT_KIND_INT32, fail
+    check_tag_is_double t2, fail
+.kind_ok:
+end
+
 # NOTE: canonicalize_nan is a codegen instruction, not a macro.
 # canonicalize_nan dst_gpr, src_fpr
 # If src_fpr is NaN, writes CANON_NAN_BITS to dst_gpr.
@@ -299,6 +312,27 @@ macro boolean_result_epilogue(slow_path_func)
     call_slow_path slow_path_func
 end
 
+# Jump to the bytecode address in target.
+# Backward jumps are loop back-edges, where a long-running loop that never
+# enters a function has to give the profiler its chance to take a sample.
+# The slow path takes the sample and resumes at this same jump instruction.
+# Clobbers t7, t8.
+macro jump_to(target)
+    mov t7, target
+    add t7, pb
+    lea t8, [pb, pc]
+    branch_ge_unsigned t8, t7, .poll_profiler
+    jmp .dispatch
+.poll_profiler:
+    load_interp t8
+    load64 t8, [t8, INTERPRETER_PROFILER_SAMPLE_REQUESTED]
+    load8 t8, [t8]
+    branch_zero t8, .dispatch
+    call_slow_path asm_slow_path_take_profiler_sample
+.dispatch:
+    goto_handler target
+end
+
 # Epilogue for jump comparison/equality handlers.
 # Defines .take_true, .take_false, and .slow labels.
 macro jump_binary_epilogue(slow_path_func)
@@ -306,10 +340,10 @@ macro jump_binary_epilogue(slow_path_func)
     call_slow_path slow_path_func
 .take_true:
     load_label t0, m_true_target
-    goto_handler t0
+    jump_to t0
 .take_false:
     load_label t0, m_false_target
-    goto_handler t0
+    jump_to t0
 end
 
 # Coerce two operands (already in t1/t2) to int32 for bitwise operations.
@@ -541,7 +575,7 @@ end
 
 handler Jump
     load_label t0, m_target
-    goto_handler t0
+    jump_to t0
 end
 
 # Conditional jumps: check boolean first (most common), then int32, then slow path.
@@ -566,10 +600,10 @@ handler JumpIf
     jmp .take_false
 .take_true:
     load_label t0, m_true_target
-    goto_handler t0
+    jump_to t0
 .take_false:
     load_label t0, m_false_target
-    goto_handler t0
+    jump_to t0
 end
 
 handler JumpTrue
@@ -588,7 +622,7 @@ handler JumpTrue
     dispatch_next
 .take:
     load_label t0, m_target
-    goto_handler t0
+    jump_to t0
 end
 
 handler JumpFalse
@@ -607,7 +641,7 @@ handler JumpFalse
     dispatch_next
 .take:
     load_label t0, m_target
-    goto_handler t0
+    jump_to t0
 end
 
 # Nullish check: undefined and null tags differ only in bit 0,
@@ -619,10 +653,10 @@ handler JumpNullish
     and t2, 0xFFFE
     branch_eq t2, UNDEFINED_TAG, .nullish
     load_label t0, m_false_target
-    goto_handler t0
+    jump_to t0
 .nullish:
     load_label t0, m_true_target
-    goto_handler t0
+    jump_to t0
 end
 
 handler JumpUndefined
@@ -630,10 +664,10 @@ handler JumpUndefined
     mov t0, UNDEFINED_SHIFTED
     branch_eq t1, t0, .is_undefined
     load_label t0, m_false_target
-    goto_handler t0
+    jump_to t0
 .is_undefined:
     load_label t0, m_true_target
-    goto_handler t0
+    jump_to t0
 end
 
 
@@ -1341,6 +1375,7 @@ end
 # ============================================================================
 
 # Fast path for array[int32_index] = value with Packed/Holey indexed storage.
+# Stores that would widen the IndexedElementKind go through the slow path.
 handler PutByValue
     # Only fast-path Normal puts (not Getter/Setter/Own)
     load8 t0, [pb, pc, m_kind]
@@ -1372,6 +1407,7 @@ handler PutByValue
     branch_ge_unsigned t4, t5, .slow
     load64 t5, [t3, OBJECT_INDEXED_ELEMENTS]
     load_operand t1, m_src
+    check_indexed_element_kind t1, .slow
     store64 [t5, t4, 8], t1
     dispatch_next
 .not_packed:
@@ -1384,6 +1420,7 @@ handler PutByValue
     mov t0, EMPTY_TAG_SHIFTED
     branch_eq t1, t0, .slow
     load_operand t1, m_src
+    check_indexed_element_kind t1, .slow
     store64 [t5, t4, 8], t1
     dispatch_next
 .try_typed_array:
@@ -41,6 +41,7 @@ int main()
     EMIT_OFFSET(OBJECT_NAMED_PROPERTIES, Object, m_named_properties);
     EMIT_OFFSET(OBJECT_INDEXED_ELEMENTS, Object, m_indexed_elements);
     EMIT_OFFSET(OBJECT_INDEXED_STORAGE_KIND, Object, m_indexed_storage_kind);
+    EMIT_OFFSET(OBJECT_INDEXED_ELEMENT_KIND, Object, m_indexed_element_kind);
     EMIT_OFFSET(OBJECT_INDEXED_ARRAY_LIKE_SIZE, Object, m_indexed_array_like_size);
     EMIT_SIZEOF(OBJECT_SIZE, Object);
 
@@ -103,6 +104,7 @@ int main()
     // Interpreter layout
     outln("\n# Interpreter layout");
     EMIT_OFFSET(INTERPRETER_RUNNING_EXECUTION_CONTEXT, Interpreter, m_running_execution_context);
+    EMIT_OFFSET(INTERPRETER_PROFILER_SAMPLE_REQUESTED, Interpreter, m_profiler_sample_requested);
 
     // IndexedStorageKind enum values
     outln("\n# IndexedStorageKind enum values");
@@ -111,6 +113,12 @@ int main()
     outln("const INDEXED_STORAGE_KIND_HOLEY = {}", static_cast<u8>(IndexedStorageKind::Holey));
     outln("const INDEXED_STORAGE_KIND_DICTIONARY = {}", static_cast<u8>(IndexedStorageKind::Dictionary));
 
+    // IndexedElementKind enum values
+    outln("\n# IndexedElementKind enum values");
+    outln("const INDEXED_ELEMENT_KIND_INT32 = {}", static_cast<u8>(IndexedElementKind::Int32));
+    outln("const INDEXED_ELEMENT_KIND_DOUBLE = {}", static_cast<u8>(IndexedElementKind::Double));
+    outln("const INDEXED_ELEMENT_KIND_GENERIC = {}", static_cast<u8>(IndexedElementKind::Generic));
+
     // Vector<Value> layout (used for bytecode)
     outln("\n# Vector<Value> layout");
     {
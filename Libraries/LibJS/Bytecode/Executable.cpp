@@ -13,6 +13,7 @@
 #include <LibJS/Bytecode/RegexTable.h>
 #include <LibJS/Runtime/Array.h>
 #include <LibJS/Runtime/SharedFunctionInstanceData.h>
+#include <LibJS/Runtime/Symbol.h>
 #include <LibJS/Runtime/Value.h>
 #include <LibJS/SourceCode.h>
 
@@ -237,8 +238,6 @@ void Executable::visit_edges(Visitor& visitor)
 {
     Base::visit_edges(visitor);
     visitor.visit(constants);
-    for (auto& cache : template_object_caches)
-        visitor.visit(cache.cached_template_object);
     for (auto& data : shared_function_data)
         visitor.visit(data);
     for (auto& blueprint : class_blueprints) {
@@ -263,13 +262,13 @@ StaticPropertyLookupCache::StaticPropertyLookupCache()
 
 static void clear_cache_entry_if_dead(PropertyLookupCache::Entry& entry)
 {
-    if (entry.from_shape && entry.from_shape->state() != Cell::State::Live)
+    if (entry.from_shape && !entry.from_shape->is_marked())
         entry.from_shape = nullptr;
-    if (entry.shape && entry.shape->state() != Cell::State::Live)
+    if (entry.shape && !entry.shape->is_marked())
         entry.shape = nullptr;
-    if (entry.prototype && entry.prototype->state() != Cell::State::Live)
+    if (entry.prototype && !entry.prototype->is_marked())
         entry.prototype = nullptr;
-    if (entry.prototype_chain_validity && entry.prototype_chain_validity->state() != Cell::State::Live)
+    if (entry.prototype_chain_validity && !entry.prototype_chain_validity->is_marked())
         entry.prototype_chain_validity = nullptr;
 }
 
@@ -281,6 +280,24 @@ void StaticPropertyLookupCache::sweep_all()
     }
 }
 
+void MegamorphicPropertyCache::remove_dead_cells()
+{
+    auto remove_dead_cells_in = [](auto& entries) {
+        for (auto& entry : entries) {
+            if (!entry.shape)
+                continue;
+            bool key_is_dead = entry.key->is_symbol() && !entry.key->as_symbol()->is_marked();
+            if (!entry.shape->is_marked() || key_is_dead) {
+                entry = {};
+                continue;
+            }
+            clear_cache_entry_if_dead(entry.data);
+        }
+    };
+    remove_dead_cells_in(get_entries);
+    remove_dead_cells_in(put_entries);
+}
+
 void Executable::remove_dead_cells(Badge<GC::Heap>)
 {
     for (auto& cache : property_lookup_caches) {
@@ -291,8 +308,14 @@ void Executable::remove_dead_cells(Badge<GC::Heap>)
         for (auto& entry : cache.entries)
             clear_cache_entry_if_dead(entry);
     }
+    for (auto& cache : template_object_caches) {
+        if (cache.cached_template_object && !cache.cached_template_object->is_marked()) {
+            cache.cached_template_object = nullptr;
+            cache.cached_script_or_module = nullptr;
+        }
+    }
     for (auto& cache : object_shape_caches) {
-        if (cache.shape && cache.shape->state() != Cell::State::Live)
+        if (cache.shape && !cache.shape->is_marked())
             cache.shape = nullptr;
     }
 }
@@ -6,6 +6,7 @@
 
 #pragma once
 
+#include <AK/HashFunctions.h>
 #include <AK/NonnullOwnPtr.h>
 #include <AK/OwnPtr.h>
 #include <AK/String.h>
@@ -48,6 +49,9 @@ struct PropertyLookupCache {
         GC::RawPtr<PrototypeChainValidity> prototype_chain_validity;
     };
 
+    // Once the last entry is in use, this cache has seen more shapes than it can remember.
+    bool is_full() const { return entries.last().shape || entries.last().from_shape; }
+
     void update(Entry::Type type, auto callback)
     {
         // First, move all entries one step back.
@@ -78,10 +82,73 @@ struct GlobalVariableCache : public PropertyLookupCache {
     bool in_module_environment { false };
 };
 
+// A VM-wide, direct-mapped cache keyed by (shape, property key).
+// Property accesses whose PropertyLookupCache is full (i.e. megamorphic sites) consult this before falling back to
+// a full property lookup. Entries are validated exactly like PropertyLookupCache entries, i.e. against the shape's
+// dictionary generation and the prototype chain validity.
+struct MegamorphicPropertyCache {
+    static constexpr size_t number_of_entries = 1024;
+
+    enum class AccessKind {
+        Get,
+        Put,
+    };
+
+    struct Entry {
+        GC::RawPtr<Shape> shape;
+        Optional<PropertyKey> key;
+        PropertyLookupCache::Entry::Type type { PropertyLookupCache::Entry::Type::Empty };
+        PropertyLookupCache::Entry data;
+    };
+
+    ALWAYS_INLINE Entry const* find(AccessKind access_kind, Shape const& shape, PropertyKey const& key) const
+    {
+        auto const& entry = entry_for(access_kind, shape, key);
+        if (entry.shape.ptr() != &shape || !entry.key.has_value() || !Traits<PropertyKey>::equals(*entry.key, key))
+            return nullptr;
+        return &entry;
+    }
+
+    void remember(AccessKind access_kind, Shape& shape, PropertyKey const& key, PropertyLookupCache::Entry::Type type, PropertyLookupCache::Entry const& data)
+    {
+        auto& entry = entry_for(access_kind, shape, key);
+        entry.shape = &shape;
+        entry.key = key;
+        entry.type = type;
+        entry.data = data;
+    }
+
+    void remove_dead_cells();
+
+    // Reported by `js --dump-cache-stats`.
+    u64 hit_count { 0 };
+    u64 miss_count { 0 };
+
+private:
+    ALWAYS_INLINE Entry& entry_for(AccessKind access_kind, Shape const& shape, PropertyKey const& key)
+    {
+        auto index = pair_int_hash(ptr_hash(&shape), Traits<PropertyKey>::hash(key)) & (number_of_entries - 1);
+        return access_kind == AccessKind::Get ? get_entries[index] : put_entries[index];
+    }
+
+    ALWAYS_INLINE Entry const& entry_for(AccessKind access_kind, Shape const& shape, PropertyKey const& key) const
+    {
+        return const_cast<MegamorphicPropertyCache&>(*this).entry_for(access_kind, shape, key);
+    }
+
+    AK::Array<Entry, number_of_entries> get_entries;
+    AK::Array<Entry, number_of_entries> put_entries;
+};
+
 // https://tc39.es/ecma262/#sec-gettemplateobject
 // Template objects are cached at the call site.
+// NB: This is a non-owning fast path. The template object is owned by its realm's [[TemplateMap]], since the
+//     executable may outlive that realm and be shared by several scripts (see CompiledProgramCache). The map entry
+//     also keeps the script or module alive, so it can't be reused while the template object is. Dead template
+//     objects are cleared during sweep.
 struct TemplateObjectCache {
-    GC::Ptr<Array> cached_template_object;
+    GC::RawPtr<Array> cached_template_object;
+    Cell const* cached_script_or_module { nullptr };
 };
 
 // Cache for object literal shapes.
@@ -86,7 +86,10 @@ ALWAYS_INLINE static ThrowCompletionOr<bool> strict_equals(VM&, Value src1, Valu
     return is_strictly_equal(src1, src2);
 }
 
-Interpreter::Interpreter() = default;
+Interpreter::Interpreter()
+    : m_profiler_sample_requested(&vm().profiler_sample_requested())
+{
+}
 
 Interpreter::~Interpreter() = default;
 
@@ -291,6 +294,8 @@ ExecutionContext* Interpreter::push_inline_frame(
     }
     callee_context->private_environment = callee_function.m_private_environment;
 
+    vm().take_profiler_sample_if_requested();
+
     // Fast-path push onto execution context stack (avoids Vector::append growth check preventing inlining).
     auto& ec_stack = vm().execution_context_stack();
     if (ec_stack.size() < ec_stack.capacity()) [[likely]]
@@ -463,6 +468,17 @@ void Interpreter::run_bytecode(size_t entry_point)
         goto start;                                                          \
     } while (0)
 
+// Jump to a bytecode address. Backward jumps are loop back-edges, where a long-running loop that never enters a
+// function has to give the profiler its chance to take a sample.
+#define JUMP_TO(target)                               \
+    do {                                              \
+        auto target_address = (target);               \
+        if (target_address <= program_counter)        \
+            vm().take_profiler_sample_if_requested(); \
+        program_counter = target_address;             \
+        goto start;                                   \
+    } while (0)
+
     bytecode = current_executable().bytecode.data();
     program_counter = entry_point;
 
@@ -508,44 +524,35 @@ void Interpreter::run_bytecode(size_t entry_point)
 
         handle_Jump: {
             auto& instruction = *reinterpret_cast<Op::Jump const*>(&bytecode[program_counter]);
-            program_counter = instruction.target().address();
-            goto start;
+            JUMP_TO(instruction.target().address());
         }
 
         handle_JumpIf: {
             auto& instruction = *reinterpret_cast<Op::JumpIf const*>(&bytecode[program_counter]);
             if (get(instruction.condition()).to_boolean())
-                program_counter = instruction.true_target().address();
-            else
-                program_counter = instruction.false_target().address();
-            goto start;
+                JUMP_TO(instruction.true_target().address());
+            JUMP_TO(instruction.false_target().address());
         }
 
         handle_JumpTrue: {
             auto& instruction = *reinterpret_cast<Op::JumpTrue const*>(&bytecode[program_counter]);
-            if (get(instruction.condition()).to_boolean()) {
-                program_counter = instruction.target().address();
-                goto start;
-            }
+            if (get(instruction.condition()).to_boolean())
+                JUMP_TO(instruction.target().address());
             DISPATCH_NEXT(JumpTrue);
         }
 
         handle_JumpFalse: {
             auto& instruction = *reinterpret_cast<Op::JumpFalse const*>(&bytecode[program_counter]);
-            if (!get(instruction.condition()).to_boolean()) {
-                program_counter = instruction.target().address();
-                goto start;
-            }
+            if (!get(instruction.condition()).to_boolean())
+                JUMP_TO(instruction.target().address());
             DISPATCH_NEXT(JumpFalse);
         }
 
         handle_JumpNullish: {
             auto& instruction = *reinterpret_cast<Op::JumpNullish const*>(&bytecode[program_counter]);
             if (get(instruction.condition()).is_nullish())
-                program_counter = instruction.true_target().address();
-            else
-                program_counter = instruction.false_target().address();
-            goto start;
+                JUMP_TO(instruction.true_target().address());
+            JUMP_TO(instruction.false_target().address());
         }
 
 #define HANDLE_COMPARISON_OP(op_TitleCase, op_snake_case, numeric_operator)                                             \
@@ -561,8 +568,7 @@ void Interpreter::run_bytecode(size_t entry_point)
             } else {                                                                                                    \
                 result = lhs.as_double() numeric_operator rhs.as_double();                                              \
             }                                                                                                           \
-            program_counter = result ? instruction.true_target().address() : instruction.false_target().address();      \
-            goto start;                                                                                                 \
+            JUMP_TO(result ? instruction.true_target().address() : instruction.false_target().address());               \
         }                                                                                                               \
         auto result = op_snake_case(vm(), get(instruction.lhs()), get(instruction.rhs()));                              \
         if (result.is_error()) [[unlikely]] {                                                                           \
@@ -570,11 +576,7 @@ void Interpreter::run_bytecode(size_t entry_point)
                 return;                                                                                                 \
             RELOAD_AND_GOTO_START();                                                                                    \
         }                                                                                                               \
-        if (result.value())                                                                                             \
-            program_counter = instruction.true_target().address();                                                      \
-        else                                                                                                            \
-            program_counter = instruction.false_target().address();                                                     \
-        goto start;                                                                                                     \
+        JUMP_TO(result.value() ? instruction.true_target().address() : instruction.false_target().address());           \
     }
 
             JS_ENUMERATE_COMPARISON_OPS(HANDLE_COMPARISON_OP)
@@ -583,10 +585,8 @@ void Interpreter::run_bytecode(size_t entry_point)
         handle_JumpUndefined: {
             auto& instruction = *reinterpret_cast<Op::JumpUndefined const*>(&bytecode[program_counter]);
             if (get(instruction.condition()).is_undefined())
-                program_counter = instruction.true_target().address();
-            else
-                program_counter = instruction.false_target().address();
-            goto start;
+                JUMP_TO(instruction.true_target().address());
+            JUMP_TO(instruction.false_target().address());
         }
 
 #define HANDLE_INSTRUCTION(name)                                                                                            \
@@ -1931,6 +1931,13 @@ void NewPrimitiveArray::execute_impl(Bytecode::Interpreter& interpreter) const
     interpreter.set(dst(), array);
 }
 
+static GC::Ptr<Cell> script_or_module_cell(ScriptOrModule const& script_or_module)
+{
+    return script_or_module.visit(
+        [](Empty) -> GC::Ptr<Cell> { return nullptr; },
+        [](auto const& script_or_module) -> GC::Ptr<Cell> { return script_or_module.ptr(); });
+}
+
 // 13.2.8.4 GetTemplateObject ( templateLiteral ), https://tc39.es/ecma262/#sec-gettemplateobject
 void GetTemplateObject::execute_impl(Bytecode::Interpreter& interpreter) const
 {
@@ -1944,10 +1951,19 @@ void GetTemplateObject::execute_impl(Bytecode::Interpreter& interpreter) const
     // 3. For each element e of templateRegistry, do
     //    a. If e.[[Site]] is the same Parse Node as templateLiteral, then
     //       i. Return e.[[Array]].
-    if (cache.cached_template_object) {
+    // NOTE: Executables may be shared between realms and between scripts with identical source text (see
+    //       CompiledProgramCache), so the same per-site cache stands for one Parse Node per Script or Module Record.
+    //       Every realm owns its template objects in its own map, which the per-site cache merely short-circuits
+    //       for the realm and script that created the template object.
+    auto script_or_module = script_or_module_cell(vm.running_execution_context().script_or_module);
+    if (cache.cached_template_object && cache.cached_script_or_module == script_or_module && &cache.cached_template_object->shape().realm() == &realm) {
         interpreter.set(dst(), cache.cached_template_object);
         return;
     }
+    if (auto template_object = realm.template_object_for_site(script_or_module, cache)) {
+        interpreter.set(dst(), template_object);
+        return;
+    }
 
     // 4. Let rawStrings be the TemplateStrings of templateLiteral with argument true.
     // 5. Assert: rawStrings is a List of Strings.
@@ -1994,7 +2010,11 @@ void GetTemplateObject::execute_impl(Bytecode::Interpreter& interpreter) const
     MUST(template_object->set_integrity_level(Object::IntegrityLevel::Frozen));
 
     // 16. Append the Record { [[Site]]: templateLiteral, [[Array]]: template } to realm.[[TemplateMap]].
-    cache.cached_template_object = template_object;
+    realm.set_template_object_for_site(script_or_module, interpreter.current_executable(), cache, *template_object);
+    if (!cache.cached_template_object) {
+        cache.cached_template_object = template_object;
+        cache.cached_script_or_module = script_or_module;
+    }
 
     // 17. Return template.
     interpreter.set(dst(), template_object);
@@ -2060,7 +2080,9 @@ void NewObject::execute_impl(Bytecode::Interpreter& interpreter) const
     if (m_cache) {
         auto& cache = *bit_cast<ObjectShapeCache*>(m_cache);
         auto cached_shape = cache.shape.ptr();
-        if (cached_shape) {
+        // NOTE: The cached shape carries the prototype of the realm that created it, and executables may be
+        //       shared between realms.
+        if (cached_shape && &cached_shape->realm() == &realm) {
             interpreter.set(dst(), Object::create_with_premade_shape(*cached_shape));
             return;
         }
@@ -2722,7 +2744,7 @@ NEVER_INLINE static ThrowCompletionOr<void> execute_call(
     size_t registers_and_locals_count = 0;
     ReadonlySpan<Value> constants;
     size_t argument_count = arguments.size();
-    function.get_stack_frame_info(registers_and_locals_count, constants, argument_count);
+    TRY(function.get_stack_frame_info(registers_and_locals_count, constants, argument_count));
 
     auto& stack = vm.interpreter_stack();
     auto* stack_mark = stack.top();
@@ -2801,7 +2823,7 @@ NEVER_INLINE static ThrowCompletionOr<void> call_with_argument_array(
     size_t argument_count = argument_array_length;
     size_t registers_and_locals_count = 0;
     ReadonlySpan<Value> constants;
-    function.get_stack_frame_info(registers_and_locals_count, constants, argument_count);
+    TRY(function.get_stack_frame_info(registers_and_locals_count, constants, argument_count));
 
     auto& stack = vm.interpreter_stack();
     auto* stack_mark = stack.top();
@@ -2886,7 +2908,7 @@ ThrowCompletionOr<void> SuperCallWithArgumentArray::execute_impl(Bytecode::Inter
     size_t argument_count = argument_array_length;
     size_t registers_and_locals_count = 0;
     ReadonlySpan<Value> constants;
-    function.get_stack_frame_info(registers_and_locals_count, constants, argument_count);
+    TRY(function.get_stack_frame_info(registers_and_locals_count, constants, argument_count));
 
     auto& stack = vm.interpreter_stack();
     auto* stack_mark = stack.top();
@@ -112,6 +112,10 @@ private:
     void run_bytecode(size_t entry_point);
 
     ExecutionContext* m_running_execution_context { nullptr };
+
+    // NB: The VM's profiler sample request flag, so that the asm interpreter can poll it at loop back-edges without
+    //     calling into C++.
+    Atomic<bool> const* m_profiler_sample_requested { nullptr };
 };
 
 JS_API extern bool g_dump_bytecode;
@@ -69,6 +69,20 @@ ALWAYS_INLINE ThrowCompletionOr<GC::Ref<Object>> base_object_for_get(VM& vm, Val
     return throw_null_or_undefined_property_get(vm, base_value, get_base_identifier, get_property_name);
 }
 
+ALWAYS_INLINE bool can_use_get_cache_entry(PropertyLookupCache::Entry const& cache_entry, Shape const& shape)
+{
+    if (&shape != cache_entry.shape.ptr())
+        return false;
+    if (shape.is_dictionary() && shape.dictionary_generation() != cache_entry.shape_dictionary_generation)
+        return false;
+    if (cache_entry.prototype) {
+        auto cached_prototype_chain_validity = cache_entry.prototype_chain_validity.ptr();
+        if (!cached_prototype_chain_validity || !cached_prototype_chain_validity->is_valid())
+            return false;
+    }
+    return true;
+}
+
 template<GetByIdMode mode, typename GetBaseIdentifier, typename GetPropertyName>
 ALWAYS_INLINE ThrowCompletionOr<Value> get_by_id(VM& vm, GetBaseIdentifier get_base_identifier, GetPropertyName get_property_name, Value base_value, Value this_value, PropertyLookupCache& cache)
 {
@@ -134,6 +148,23 @@ ALWAYS_INLINE ThrowCompletionOr<Value> get_by_id(VM& vm, GetBaseIdentifier get_b
             }
         }
     }
+
+    // OPTIMIZATION: If this site has seen more shapes than its inline cache can remember, try the VM-wide cache.
+    auto& megamorphic_cache = vm.megamorphic_property_cache();
+    bool is_megamorphic_site = cache.is_full();
+    if (is_megamorphic_site) {
+        auto const* megamorphic_entry = megamorphic_cache.find(MegamorphicPropertyCache::AccessKind::Get, shape, get_property_name());
+        if (megamorphic_entry && can_use_get_cache_entry(megamorphic_entry->data, shape)) {
+            ++megamorphic_cache.hit_count;
+            auto const& cache_entry = megamorphic_entry->data;
+            auto value = cache_entry.prototype ? cache_entry.prototype->get_direct(cache_entry.property_offset) : base_obj->get_direct(cache_entry.property_offset);
+            if (value.is_accessor())
+                return TRY(call(vm, value.as_accessor().getter(), this_value));
+            return value;
+        }
+        ++megamorphic_cache.miss_count;
+    }
+
     GC::Ptr<PrototypeChainValidity> prototype_chain_validity;
     if (shape.prototype())
         prototype_chain_validity = shape.prototype()->shape().prototype_chain_validity();
@@ -160,6 +191,9 @@ ALWAYS_INLINE ThrowCompletionOr<Value> get_by_id(VM& vm, GetBaseIdentifier get_b
             if (shape.is_dictionary()) {
                 entry.shape_dictionary_generation = shape.dictionary_generation();
             }
+
+            if (is_megamorphic_site)
+                megamorphic_cache.remember(MegamorphicPropertyCache::AccessKind::Get, shape, get_property_name(), PropertyLookupCache::Entry::Type::GetOwnProperty, entry);
         } else if (cacheable_metadata.type == CacheableGetPropertyMetadata::Type::GetPropertyInPrototypeChain) {
             auto& entry = get_cache_slot();
             entry.shape = &base_obj->shape();
@@ -170,6 +204,9 @@ ALWAYS_INLINE ThrowCompletionOr<Value> get_by_id(VM& vm, GetBaseIdentifier get_b
             if (shape.is_dictionary()) {
                 entry.shape_dictionary_generation = shape.dictionary_generation();
             }
+
+            if (is_megamorphic_site)
+                megamorphic_cache.remember(MegamorphicPropertyCache::AccessKind::Get, shape, get_property_name(), PropertyLookupCache::Entry::Type::GetPropertyInPrototypeChain, entry);
         }
     }
 
@@ -198,6 +235,42 @@ COLD Completion throw_null_or_undefined_property_access(VM& vm, Value base_value
     return vm.throw_completion<TypeError>(ErrorType::ToObjectNullOrUndefined);
 }
 
+// Applies a ChangeOwnProperty or AddOwnProperty entry from the megamorphic cache to an object whose shape matched it.
+// Returns false if the entry no longer applies and the caller should take the slow path.
+ALWAYS_INLINE ThrowCompletionOr<bool> put_with_megamorphic_cache_entry(VM& vm, Object& object, Value this_value, Value value, MegamorphicPropertyCache::Entry const& megamorphic_entry)
+{
+    auto const& cache = megamorphic_entry.data;
+    switch (megamorphic_entry.type) {
+    case PropertyLookupCache::Entry::Type::ChangeOwnProperty: {
+        if (object.shape().is_dictionary() && object.shape().dictionary_generation() != cache.shape_dictionary_generation)
+            return false;
+        auto value_in_object = object.get_direct(cache.property_offset);
+        if (value_in_object.is_accessor()) [[unlikely]]
+            (void)TRY(call(vm, value_in_object.as_accessor().setter(), this_value, value));
+        else
+            object.put_direct(cache.property_offset, value);
+        return true;
+    }
+    case PropertyLookupCache::Entry::Type::AddOwnProperty: {
+        auto cached_shape = cache.shape.ptr();
+        if (!cached_shape) [[unlikely]]
+            return false;
+        if (!TRY(object.internal_is_extensible())) [[unlikely]]
+            return false;
+        if (cached_shape->is_dictionary() && object.shape().dictionary_generation() != cache.shape_dictionary_generation)
+            return false;
+        auto cached_prototype_chain_validity = cache.prototype_chain_validity.ptr();
+        if (cached_prototype_chain_validity && !cached_prototype_chain_validity->is_valid()) [[unlikely]]
+            return false;
+        object.unsafe_set_shape(*cached_shape);
+        object.put_direct(cache.property_offset, value);
+        return true;
+    }
+    default:
+        return false;
+    }
+}
+
 inline ThrowCompletionOr<void> put_by_property_key(VM& vm, Value base, Value this_value, Value value, Optional<Utf16FlyString const&> const base_identifier, PropertyKey const& name, PutKind kind, Strict strict, PropertyLookupCache* caches = nullptr)
 {
     // Better error message than to_object would give
@@ -321,6 +394,19 @@ inline ThrowCompletionOr<void> put_by_property_key(VM& vm, Value base, Value thi
             }
         }
 
+        // OPTIMIZATION: If this site has seen more shapes than its inline cache can remember, try the VM-wide cache.
+        //               Since that cache is shared between all sites, we only use it when the receiver is the base object.
+        auto& megamorphic_cache = vm.megamorphic_property_cache();
+        bool is_megamorphic_site = caches && caches->is_full() && this_value_object.ptr() == object.ptr();
+        if (is_megamorphic_site) {
+            auto const* megamorphic_entry = megamorphic_cache.find(MegamorphicPropertyCache::AccessKind::Put, object->shape(), name);
+            if (megamorphic_entry && TRY(put_with_megamorphic_cache_entry(vm, object, this_value, value, *megamorphic_entry))) {
+                ++megamorphic_cache.hit_count;
+                return {};
+            }
+            ++megamorphic_cache.miss_count;
+        }
+
         CacheableSetPropertyMetadata cacheable_metadata;
         bool succeeded = TRY(object->internal_set(name, value, this_value, &cacheable_metadata));
 
@@ -336,6 +422,8 @@ inline ThrowCompletionOr<void> put_by_property_key(VM& vm, Value base, Value thi
                     cache.shape_dictionary_generation = object->shape().dictionary_generation();
                 }
             });
+            if (is_megamorphic_site)
+                megamorphic_cache.remember(MegamorphicPropertyCache::AccessKind::Put, from_shape, name, PropertyLookupCache::Entry::Type::AddOwnProperty, caches->entries[0]);
         }
 
         // If internal_set() caused object's shape change, we can no longer be sure
@@ -356,6 +444,8 @@ inline ThrowCompletionOr<void> put_by_property_key(VM& vm, Value base, Value thi
                         cache.shape_dictionary_generation = object->shape().dictionary_generation();
                     }
                 });
+                if (is_megamorphic_site)
+                    megamorphic_cache.remember(MegamorphicPropertyCache::AccessKind::Put, object->shape(), name, PropertyLookupCache::Entry::Type::ChangeOwnProperty, caches->entries[0]);
                 break;
             case CacheableSetPropertyMetadata::Type::ChangePropertyInPrototypeChain:
                 caches->update(PropertyLookupCache::Entry::Type::ChangePropertyInPrototypeChain, [&](auto& cache) {
@@ -0,0 +1,117 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/HashFunctions.h>
+#include <LibJS/CompiledProgramCache.h>
+
+namespace JS {
+
+static bool is_same_source(SourceCode const& a, SourceCode const& b)
+{
+    if (&a == &b)
+        return true;
+    if (a.length_in_code_units() != b.length_in_code_units())
+        return false;
+    if (a.code().hash() != b.code().hash())
+        return false;
+    return a.filename() == b.filename() && a.code_view() == b.code_view();
+}
+
+unsigned CompiledProgramCache::hash_key(SourceCode const& source_code, RustIntegration::ProgramType type, size_t line_number_offset)
+{
+    auto hash = pair_int_hash(source_code.code().hash(), to_underlying(type));
+    return pair_int_hash(hash, u64_hash(line_number_offset));
+}
+
+bool CompiledProgramCache::matches_key(Key const& key, SourceCode const& source_code, RustIntegration::ProgramType type, size_t line_number_offset)
+{
+    return key.type == type && key.line_number_offset == line_number_offset && is_same_source(key.source_code, source_code);
+}
+
+template<typename Entries>
+auto CompiledProgramCache::find_in(Entries& entries, SourceCode const& source_code, RustIntegration::ProgramType type, size_t line_number_offset)
+{
+    if (source_code.length_in_code_units() < minimum_cached_source_length || entries.is_empty())
+        return entries.end();
+    return entries.find(hash_key(source_code, type, line_number_offset), [&](auto const& entry) {
+        return matches_key(entry.key, source_code, type, line_number_offset);
+    });
+}
+
+CompiledProgramCache::Entry* CompiledProgramCache::find_entry(SourceCode const& source_code, RustIntegration::ProgramType type, size_t line_number_offset)
+{
+    auto it = find_in(m_entries, source_code, type, line_number_offset);
+    if (it == m_entries.end()) {
+        ++m_miss_count;
+        return nullptr;
+    }
+    ++m_hit_count;
+    it->value.last_use = m_next_use++;
+    return &it->value;
+}
+
+bool CompiledProgramCache::contains(SourceCode const& source_code, RustIntegration::ProgramType type, size_t line_number_offset) const
+{
+    return find_in(m_entries, source_code, type, line_number_offset) != m_entries.end();
+}
+
+Optional<RustIntegration::ScriptResult> CompiledProgramCache::find_script(SourceCode const& source_code, size_t line_number_offset)
+{
+    auto* entry = find_entry(source_code, RustIntegration::ProgramType::Script, line_number_offset);
+    if (!entry)
+        return {};
+    return entry->result.get<RustIntegration::ScriptResult>();
+}
+
+void CompiledProgramCache::add_script(NonnullRefPtr<SourceCode const> source_code, size_t line_number_offset, RustIntegration::ScriptResult const& result)
+{
+    add_entry({ move(source_code), RustIntegration::ProgramType::Script, line_number_offset }, { .last_use = m_next_use++, .result = result });
+}
+
+Optional<RustIntegration::ModuleResult> CompiledProgramCache::find_module(SourceCode const& source_code)
+{
+    auto* entry = find_entry(source_code, RustIntegration::ProgramType::Module, 0);
+    if (!entry)
+        return {};
+    return entry->result.get<RustIntegration::ModuleResult>();
+}
+
+void CompiledProgramCache::add_module(NonnullRefPtr<SourceCode const> source_code, RustIntegration::ModuleResult const& result)
+{
+    add_entry({ move(source_code), RustIntegration::ProgramType::Module, 0 }, { .last_use = m_next_use++, .result = result });
+}
+
+void CompiledProgramCache::add_entry(Key&& key, Entry&& entry)
+{
+    auto source_length = key.source_code->length_in_code_units();
+    if (source_length < minimum_cached_source_length || source_length > maximum_total_cached_source_length)
+        return;
+    if (m_entries.contains(key))
+        return;
+
+    // Evict the least recently used entries until the new one fits.
+    // NB: This scans every entry, but only runs once the cache is full, not on lookups.
+    while (!m_entries.is_empty() && m_total_cached_source_length + source_length > maximum_total_cached_source_length) {
+        auto least_recently_used = m_entries.begin();
+        for (auto it = m_entries.begin(); it != m_entries.end(); ++it) {
+            if (it->value.last_use < least_recently_used->value.last_use)
+                least_recently_used = it;
+        }
+        m_total_cached_source_length -= least_recently_used->key.source_code->length_in_code_units();
+        m_entries.remove(least_recently_used);
+    }
+
+    m_total_cached_source_length += source_length;
+    m_entries.set(move(key), move(entry));
+}
+
+void CompiledProgramCache::clear()
+{
+    m_entries.clear();
+    m_total_cached_source_length = 0;
+}
+
+}
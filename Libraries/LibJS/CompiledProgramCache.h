@@ -0,0 +1,80 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/HashMap.h>
+#include <AK/NonnullRefPtr.h>
+#include <AK/Optional.h>
+#include <AK/Variant.h>
+#include <LibJS/RustIntegration.h>
+#include <LibJS/SourceCode.h>
+
+namespace JS {
+
+// Keeps the compilation results of recently loaded scripts and modules around, so that loading the exact same
+// source again (e.g. a framework bundle on the next navigation within the same process) skips parsing and
+// bytecode generation. Lookups are keyed by a hash of the source, program type and line number offset, but always
+// validated against the full text.
+class CompiledProgramCache {
+    AK_MAKE_NONCOPYABLE(CompiledProgramCache);
+    AK_MAKE_NONMOVABLE(CompiledProgramCache);
+
+public:
+    // Small programs are cheap to compile and not worth holding on to.
+    static constexpr size_t minimum_cached_source_length = 4 * KiB;
+    static constexpr size_t maximum_total_cached_source_length = 32 * MiB;
+
+    CompiledProgramCache() = default;
+
+    bool contains(SourceCode const&, RustIntegration::ProgramType, size_t line_number_offset) const;
+
+    Optional<RustIntegration::ScriptResult> find_script(SourceCode const&, size_t line_number_offset);
+    void add_script(NonnullRefPtr<SourceCode const>, size_t line_number_offset, RustIntegration::ScriptResult const&);
+
+    Optional<RustIntegration::ModuleResult> find_module(SourceCode const&);
+    void add_module(NonnullRefPtr<SourceCode const>, RustIntegration::ModuleResult const&);
+
+    void clear();
+
+    size_t hit_count() const { return m_hit_count; }
+    size_t miss_count() const { return m_miss_count; }
+
+private:
+    struct Key {
+        NonnullRefPtr<SourceCode const> source_code;
+        RustIntegration::ProgramType type;
+        size_t line_number_offset { 0 };
+    };
+
+    struct KeyTraits : public DefaultTraits<Key> {
+        static unsigned hash(Key const& key) { return hash_key(key.source_code, key.type, key.line_number_offset); }
+        static bool equals(Key const& a, Key const& b) { return matches_key(a, b.source_code, b.type, b.line_number_offset); }
+    };
+
+    struct Entry {
+        u64 last_use { 0 };
+        Variant<RustIntegration::ScriptResult, RustIntegration::ModuleResult> result;
+    };
+
+    using EntryMap = HashMap<Key, Entry, KeyTraits>;
+
+    static unsigned hash_key(SourceCode const&, RustIntegration::ProgramType, size_t line_number_offset);
+    static bool matches_key(Key const&, SourceCode const&, RustIntegration::ProgramType, size_t line_number_offset);
+
+    template<typename Entries>
+    static auto find_in(Entries&, SourceCode const&, RustIntegration::ProgramType, size_t line_number_offset);
+    Entry* find_entry(SourceCode const&, RustIntegration::ProgramType, size_t line_number_offset);
+    void add_entry(Key&&, Entry&&);
+
+    EntryMap m_entries;
+    size_t m_total_cached_source_length { 0 };
+    u64 m_next_use { 0 };
+    size_t m_hit_count { 0 };
+    size_t m_miss_count { 0 };
+};
+
+}
@@ -164,12 +164,14 @@ enum class ThisBindingStatus : u8 {
 
 class Accessor;
 class Agent;
+class AsyncFunctionDriverWrapper;
 struct AsyncGeneratorRequest;
 class BigInt;
 class BoundFunction;
 class BuiltinIterator;
 class Cell;
 struct ClassFieldDefinition;
+class CompiledProgramCache;
 class Completion;
 class Console;
 class ConsoleClient;
@@ -205,6 +207,7 @@ class PropertyDescriptor;
 class PropertyKey;
 class Realm;
 class Reference;
+class SamplingProfiler;
 class Script;
 class Shape;
 class SharedFunctionInstanceData;
@@ -319,10 +322,12 @@ class Executable;
 class Generator;
 class Instruction;
 class Interpreter;
+struct MegamorphicPropertyCache;
 class Operand;
 struct PropertyLookupCache;
 class RegexTable;
 class Register;
+struct TemplateObjectCache;
 
 }
 
@@ -65,7 +65,7 @@ ThrowCompletionOr<Value> call_impl(VM& vm, Value function, Value this_value, Rea
     size_t registers_and_locals_count = 0;
     ReadonlySpan<Value> constants;
     size_t argument_count = arguments_list.size();
-    function_object.get_stack_frame_info(registers_and_locals_count, constants, argument_count);
+    TRY(function_object.get_stack_frame_info(registers_and_locals_count, constants, argument_count));
 
     auto& stack = vm.interpreter_stack();
     auto* stack_mark = stack.top();
@@ -95,7 +95,7 @@ ThrowCompletionOr<Value> call_impl(VM& vm, FunctionObject& function, Value this_
     size_t registers_and_locals_count = 0;
     ReadonlySpan<Value> constants;
     size_t argument_count = arguments_list.size();
-    function.get_stack_frame_info(registers_and_locals_count, constants, argument_count);
+    TRY(function.get_stack_frame_info(registers_and_locals_count, constants, argument_count));
 
     auto& stack = vm.interpreter_stack();
     auto* stack_mark = stack.top();
@@ -127,7 +127,7 @@ ThrowCompletionOr<GC::Ref<Object>> construct_impl(VM& vm, FunctionObject& functi
     size_t registers_and_locals_count = 0;
     ReadonlySpan<Value> constants;
     size_t argument_count = arguments_list.size();
-    function.get_stack_frame_info(registers_and_locals_count, constants, argument_count);
+    TRY(function.get_stack_frame_info(registers_and_locals_count, constants, argument_count));
 
     auto& stack = vm.interpreter_stack();
     auto* stack_mark = stack.top();
@@ -13,6 +13,7 @@
 #include <LibJS/Runtime/Error.h>
 #include <LibJS/Runtime/GlobalObject.h>
 #include <LibJS/Runtime/NativeFunction.h>
+#include <LibJS/Runtime/TimSort.h>
 #include <LibJS/Runtime/ValueInlines.h>
 
 namespace JS {
@@ -168,15 +169,72 @@ ThrowCompletionOr<bool> Array::set_length(PropertyDescriptor const& property_des
     return true;
 }
 
+// OPTIMIZATION: With the default comparator, CompareArrayElements converts both values to strings for every comparison.
+//               For primitives other than Symbols that conversion is unobservable and cannot fail, so we convert each
+//               value just once instead. Returns false without sorting if any of the values is an Object or a Symbol.
+static bool sort_primitives_with_default_comparison(VM& vm, GC::RootVector<Value>& items)
+{
+    struct Entry {
+        Utf16String string;
+        Value value;
+    };
+
+    Vector<Entry> entries;
+    entries.ensure_capacity(items.size());
+
+    for (auto item : items) {
+        if (item.is_undefined())
+            continue;
+        if (item.is_object() || item.is_symbol())
+            return false;
+        entries.unchecked_append({ MUST(item.to_utf16_string(vm)), item });
+    }
+
+    Vector<Entry> buffer;
+    MUST(tim_sort(entries.span(), buffer, [](Entry const& x, Entry const& y) -> ThrowCompletionOr<bool> {
+        return x.string.utf16_view().is_code_unit_less_than(y.string.utf16_view());
+    }));
+
+    // NB: CompareArrayElements orders undefined after all other values.
+    for (size_t i = 0; i < entries.size(); ++i)
+        items[i] = entries[i].value;
+    for (size_t i = entries.size(); i < items.size(); ++i)
+        items[i] = js_undefined();
+    return true;
+}
+
+// Sorts the values stably, with the order defined by SortCompare.
+ThrowCompletionOr<void> sort_values(VM& vm, GC::RootVector<Value>& values, Function<ThrowCompletionOr<double>(Value, Value)> const& sort_compare)
+{
+    // NB: The scratch buffer must be rooted, as the values moved into it during a merge may only be referenced from there
+    //     while SortCompare runs arbitrary code.
+    GC::RootVector<Value> buffer { vm.heap() };
+
+    // NB: TimSort only ever asks whether a value belongs before one that currently precedes it. We ask SortCompare the
+    //     equivalent question of whether the preceding value belongs after it, so that it sees both in their current
+    //     order. This only makes a difference for inconsistent comparators, but keeps their results more intuitive.
+    return tim_sort(values.span(), buffer, [&](Value y, Value x) -> ThrowCompletionOr<bool> {
+        return TRY(sort_compare(x, y)) > 0;
+    });
+}
+
 // 23.1.3.30.1 SortIndexedProperties ( obj, len, SortCompare, holes ), https://tc39.es/ecma262/#sec-sortindexedproperties
-ThrowCompletionOr<GC::RootVector<Value>> sort_indexed_properties(VM& vm, Object const& object, size_t length, Function<ThrowCompletionOr<double>(Value, Value)> const& sort_compare, Holes holes)
+ThrowCompletionOr<GC::RootVector<Value>> sort_indexed_properties(VM& vm, Object const& object, size_t length, Function<ThrowCompletionOr<double>(Value, Value)> const& sort_compare, Holes holes, SortCompareKind sort_compare_kind)
 {
     // 1. Let items be a new empty List.
     auto items = GC::RootVector<Value> { vm.heap() };
 
+    // OPTIMIZATION: Every index of a simple packed array is an own data property, so neither HasProperty nor Get are
+    //               observable for them and the elements can be copied directly, leaving nothing for the loop below.
+    auto const* array = as_if<Array>(object);
+    if (array && array->is_simple_packed_array() && array->indexed_packed_elements_span().size() == length) {
+        auto elements = array->indexed_packed_elements_span();
+        items.append(elements.data(), elements.size());
+    }
+
     // 2. Let k be 0.
     // 3. Repeat, while k < len,
-    for (size_t k = 0; k < length; ++k) {
+    for (size_t k = items.size(); k < length; ++k) {
         // a. Let Pk be ! ToString(𝔽(k)).
         auto property_key = PropertyKey { k };
 
@@ -210,12 +268,12 @@ ThrowCompletionOr<GC::RootVector<Value>> sort_indexed_properties(VM& vm, Object
 
     // 4. Sort items using an implementation-defined sequence of calls to SortCompare. If any such call returns an abrupt completion, stop before performing any further calls to SortCompare or steps in this algorithm and return that Completion Record.
 
-    // Perform sorting by merge sort. This isn't as efficient compared to quick sort, but
-    // quicksort can't be used in all cases because the spec requires Array.prototype.sort()
-    // to be stable. FIXME: when initially scanning through the array, maintain a flag
-    // for if an unstable sort would be indistinguishable from a stable sort (such as just
-    // just strings or numbers), and in that case use quick sort instead for better performance.
-    TRY(array_merge_sort(vm, sort_compare, items));
+    if (sort_compare_kind == SortCompareKind::DefaultArrayComparison && sort_primitives_with_default_comparison(vm, items))
+        return items;
+
+    // NB: The spec requires Array.prototype.sort() to be stable, so we use TimSort, which also takes advantage of any
+    //     runs of already sorted values.
+    TRY(sort_values(vm, items, sort_compare));
 
     // 5. Return items.
     return items;
@@ -94,7 +94,15 @@ enum class Holes {
     ReadThroughHoles,
 };
 
-ThrowCompletionOr<GC::RootVector<Value>> sort_indexed_properties(VM&, Object const&, size_t length, Function<ThrowCompletionOr<double>(Value, Value)> const& sort_compare, Holes holes);
+// NB: Lets SortIndexedProperties know that SortCompare is CompareArrayElements with an undefined comparefn, so that it can
+//     use a specialized comparison where that is unobservable.
+enum class SortCompareKind {
+    Custom,
+    DefaultArrayComparison,
+};
+
+ThrowCompletionOr<GC::RootVector<Value>> sort_indexed_properties(VM&, Object const&, size_t length, Function<ThrowCompletionOr<double>(Value, Value)> const& sort_compare, Holes holes, SortCompareKind = SortCompareKind::Custom);
+ThrowCompletionOr<void> sort_values(VM&, GC::RootVector<Value>& values, Function<ThrowCompletionOr<double>(Value, Value)> const& sort_compare);
 ThrowCompletionOr<double> compare_array_elements(VM&, Value x, Value y, FunctionObject* comparefn);
 
 }
@@ -9,6 +9,7 @@
 
 #include <AK/Function.h>
 #include <AK/HashTable.h>
+#include <AK/QuickSort.h>
 #include <AK/ScopeGuard.h>
 #include <AK/StringBuilder.h>
 #include <LibJS/Runtime/AbstractOperations.h>
@@ -161,6 +162,39 @@ static Array* fast_array_species_result(Object& object)
     return array;
 }
 
+// Returns the elements of a packed array whose element kind guarantees that they are all numbers.
+static Optional<ReadonlySpan<Value>> packed_number_elements(Object const& object, size_t length)
+{
+    auto const* array = as_if<Array>(object);
+    if (!array || !array->is_simple_packed_array() || !array->indexed_elements_are_numbers())
+        return {};
+    auto elements = array->indexed_packed_elements_span();
+    if (elements.size() != length)
+        return {};
+    return elements;
+}
+
+static Optional<size_t> packed_number_index_of(ReadonlySpan<Value> elements, IndexedElementKind element_kind, double search_number, size_t from_index)
+{
+    if (element_kind == IndexedElementKind::Int32) {
+        // Int32 elements can only be equal to integral numbers in the i32 range (this also rules out NaN).
+        if (trunc(search_number) != search_number || search_number < NumericLimits<i32>::min() || search_number > NumericLimits<i32>::max())
+            return {};
+        auto search_int = static_cast<i32>(search_number);
+        for (size_t k = from_index; k < elements.size(); ++k) {
+            if (elements[k].as_i32() == search_int)
+                return k;
+        }
+        return {};
+    }
+
+    for (size_t k = from_index; k < elements.size(); ++k) {
+        if (elements[k].as_double() == search_number)
+            return k;
+    }
+    return {};
+}
+
 // 23.1.3.1 Array.prototype.at ( index ), https://tc39.es/ecma262/#sec-array.prototype.at
 JS_DEFINE_NATIVE_FUNCTION(ArrayPrototype::at)
 {
@@ -799,6 +833,24 @@ JS_DEFINE_NATIVE_FUNCTION(ArrayPrototype::includes)
             from_index = from_argument;
     }
     auto value_to_find = vm.argument(0);
+
+    // OPTIMIZATION: Packed number arrays can be searched without going through [[Get]].
+    if (auto elements = packed_number_elements(*this_object, length); elements.has_value()) {
+        if (!value_to_find.is_number())
+            return Value(false);
+        auto element_kind = this_object->indexed_element_kind();
+        if (value_to_find.is_nan()) {
+            if (element_kind == IndexedElementKind::Int32)
+                return Value(false);
+            for (u64 i = from_index; i < length; ++i) {
+                if ((*elements)[i].is_nan())
+                    return Value(true);
+            }
+            return Value(false);
+        }
+        return Value(packed_number_index_of(*elements, element_kind, value_to_find.as_double(), from_index).has_value());
+    }
+
     for (u64 i = from_index; i < length; ++i) {
         auto element = TRY(this_object->get(i));
         if (same_value_zero(element, value_to_find))
@@ -852,6 +904,16 @@ JS_DEFINE_NATIVE_FUNCTION(ArrayPrototype::index_of)
         k = max(length + n, 0);
     }
 
+    // OPTIMIZATION: Packed number arrays can be searched without going through [[HasProperty]] and [[Get]].
+    //               Nothing but a number can be strictly equal to their elements.
+    if (auto elements = packed_number_elements(*object, length); elements.has_value()) {
+        if (!search_element.is_number())
+            return Value(-1);
+        if (auto index = packed_number_index_of(*elements, object->indexed_element_kind(), search_element.as_double(), k); index.has_value())
+            return Value(*index);
+        return Value(-1);
+    }
+
     // 10. Repeat, while k < len,
     for (; k < length; ++k) {
         auto property_key = PropertyKey { k };
@@ -1150,8 +1212,18 @@ JS_DEFINE_NATIVE_FUNCTION(ArrayPrototype::reduce)
             return vm.throw_completion<TypeError>(ErrorType::ReduceNoInitial);
     }
 
+    auto* array = as_if<Array>(*object);
+
     // 9. Repeat, while k < len,
     for (; k < length; ++k) {
+        // OPTIMIZATION: As long as the array stays packed, index k is an own data property that we can read directly.
+        //               The callback may change that, so this is re-checked on every iteration.
+        if (array && array->is_simple_packed_array() && k < array->indexed_array_like_size()) {
+            auto k_value = array->indexed_packed_elements_span()[k];
+            accumulator = TRY(call(vm, callback_function.as_function(), js_undefined(), accumulator, k_value, Value(k), object));
+            continue;
+        }
+
         // a. Let Pk be ! ToString(𝔽(k)).
         auto property_key = PropertyKey { k };
 
@@ -1444,60 +1516,31 @@ JS_DEFINE_NATIVE_FUNCTION(ArrayPrototype::some)
     return Value(false);
 }
 
-ThrowCompletionOr<void> array_merge_sort(VM& vm, Function<ThrowCompletionOr<double>(Value, Value)> const& compare_func, GC::RootVector<Value>& arr_to_sort)
+static StringView int32_to_decimal_string(i32 value, char (&buffer)[11])
 {
-    // FIXME: it would probably be better to switch to insertion sort for small arrays for
-    // better performance
-    if (arr_to_sort.size() <= 1)
-        return {};
-
-    GC::RootVector<Value> left(vm.heap());
-    GC::RootVector<Value> right(vm.heap());
-
-    left.ensure_capacity(arr_to_sort.size() / 2);
-    right.ensure_capacity(arr_to_sort.size() / 2 + (arr_to_sort.size() & 1));
-
-    for (size_t i = 0; i < arr_to_sort.size(); ++i) {
-        if (i < arr_to_sort.size() / 2) {
-            left.append(arr_to_sort[i]);
-        } else {
-            right.append(arr_to_sort[i]);
-        }
-    }
-
-    TRY(array_merge_sort(vm, compare_func, left));
-    TRY(array_merge_sort(vm, compare_func, right));
-
-    arr_to_sort.clear();
-
-    size_t left_index = 0, right_index = 0;
-
-    while (left_index < left.size() && right_index < right.size()) {
-        auto x = left[left_index];
-        auto y = right[right_index];
-
-        double comparison_result = TRY(compare_func(x, y));
-
-        if (comparison_result <= 0) {
-            arr_to_sort.append(x);
-            left_index++;
-        } else {
-            arr_to_sort.append(y);
-            right_index++;
-        }
-    }
-
-    while (left_index < left.size()) {
-        arr_to_sort.append(left[left_index]);
-        left_index++;
-    }
-
-    while (right_index < right.size()) {
-        arr_to_sort.append(right[right_index]);
-        right_index++;
-    }
+    auto magnitude = value < 0 ? -static_cast<i64>(value) : static_cast<i64>(value);
+    size_t position = sizeof(buffer);
+    do {
+        buffer[--position] = static_cast<char>('0' + magnitude % 10);
+        magnitude /= 10;
+    } while (magnitude != 0);
+    if (value < 0)
+        buffer[--position] = '-';
+    return { buffer + position, sizeof(buffer) - position };
+}
 
-    return {};
+// Orders two Int32 values the way the default sort comparator orders their string representations.
+static bool int32_less_than_as_strings(i32 a, i32 b)
+{
+    char a_buffer[11];
+    char b_buffer[11];
+    auto a_string = int32_to_decimal_string(a, a_buffer);
+    auto b_string = int32_to_decimal_string(b, b_buffer);
+
+    auto result = memcmp(a_string.characters_without_null_termination(), b_string.characters_without_null_termination(), min(a_string.length(), b_string.length()));
+    if (result != 0)
+        return result < 0;
+    return a_string.length() < b_string.length();
 }
 
 // 23.1.3.30 Array.prototype.sort ( comparefn ), https://tc39.es/ecma262/#sec-array.prototype.sort
@@ -1514,6 +1557,21 @@ JS_DEFINE_NATIVE_FUNCTION(ArrayPrototype::sort)
     // 3. Let len be ? LengthOfArrayLike(obj).
     auto length = TRY(length_of_array_like(vm, object));
 
+    // OPTIMIZATION: With the default comparator, a packed array of Int32 elements can be sorted in place without
+    //               converting its elements to strings. Equal strings imply equal integers, so stability is preserved.
+    if (comparefn.is_undefined() && length > 1) {
+        if (auto elements = packed_number_elements(*object, length); elements.has_value() && object->indexed_element_kind() == IndexedElementKind::Int32) {
+            Vector<i32> integers;
+            integers.ensure_capacity(length);
+            for (auto element : *elements)
+                integers.unchecked_append(element.as_i32());
+            quick_sort(integers, int32_less_than_as_strings);
+            for (size_t i = 0; i < length; ++i)
+                object->indexed_put(i, Value(integers[i]));
+            return object;
+        }
+    }
+
     // 4. Let SortCompare be a new Abstract Closure with parameters (x, y) that captures comparefn and performs the following steps when called:
     Function<ThrowCompletionOr<double>(Value, Value)> sort_compare = [&](auto x, auto y) -> ThrowCompletionOr<double> {
         // a. Return ? CompareArrayElements(x, y, comparefn).
@@ -1521,7 +1579,7 @@ JS_DEFINE_NATIVE_FUNCTION(ArrayPrototype::sort)
     };
 
     // 5. Let sortedList be ? SortIndexedProperties(obj, len, SortCompare, skip-holes).
-    auto sorted_list = TRY(sort_indexed_properties(vm, object, length, sort_compare, Holes::SkipHoles));
+    auto sorted_list = TRY(sort_indexed_properties(vm, object, length, sort_compare, Holes::SkipHoles, comparefn.is_undefined() ? SortCompareKind::DefaultArrayComparison : SortCompareKind::Custom));
 
     // 6. Let itemCount be the number of elements in sortedList.
     auto item_count = sorted_list.size();
@@ -1879,7 +1937,7 @@ JS_DEFINE_NATIVE_FUNCTION(ArrayPrototype::to_sorted)
     };
 
     // 6. Let sortedList be ? SortIndexedProperties(obj, len, SortCompare, read-through-holes).
-    auto sorted_list = TRY(sort_indexed_properties(vm, object, length, sort_compare, Holes::ReadThroughHoles));
+    auto sorted_list = TRY(sort_indexed_properties(vm, object, length, sort_compare, Holes::ReadThroughHoles, comparefn.is_undefined() ? SortCompareKind::DefaultArrayComparison : SortCompareKind::Custom));
 
     // 7. Let j be 0.
     // 8. Repeat, while j < len,
@@ -10,6 +10,8 @@
 #include <LibJS/Runtime/NativeFunction.h>
 #include <LibJS/Runtime/PromiseCapability.h>
 #include <LibJS/Runtime/PromiseConstructor.h>
+#include <LibJS/Runtime/PromiseJobs.h>
+#include <LibJS/Runtime/PromiseReaction.h>
 #include <LibJS/Runtime/VM.h>
 #include <LibJS/Runtime/ValueInlines.h>
 
@@ -123,8 +125,15 @@ ThrowCompletionOr<void> AsyncFunctionDriverWrapper::await(JS::Value value)
         m_on_settled = NativeFunction::create(realm, move(settled_closure), 1);
 
     // 7. Perform PerformPromiseThen(promise, onFulfilled, onRejected).
+    // OPTIMIZATION: The reactions PerformPromiseThen creates only refer to onFulfilled and onRejected, which are the same
+    //               for every await in this function, so they are created once and shared by all awaits.
+    if (!m_on_settled_fulfill_reaction) {
+        auto on_settled_job_callback = vm.host_make_job_callback(*m_on_settled);
+        m_on_settled_fulfill_reaction = PromiseReaction::create(vm, PromiseReaction::Type::Fulfill, {}, on_settled_job_callback);
+        m_on_settled_reject_reaction = PromiseReaction::create(vm, PromiseReaction::Type::Reject, {}, on_settled_job_callback);
+    }
     m_current_promise = as<Promise>(promise_object);
-    m_current_promise->perform_then(m_on_settled, m_on_settled, {});
+    m_current_promise->perform_then_with_reactions(m_on_settled_fulfill_reaction, m_on_settled_reject_reaction);
 
     // NOTE: None of these are necessary. 8-12 are handled by step d of the above lambdas.
     // 8. Remove asyncContext from the execution context stack and restore the execution context that is at the top of the
@@ -139,14 +148,15 @@ ThrowCompletionOr<void> AsyncFunctionDriverWrapper::await(JS::Value value)
 void AsyncFunctionDriverWrapper::schedule_resume(Value value, bool is_fulfilled)
 {
     auto& vm = this->vm();
-    vm.host_enqueue_promise_job(
-        GC::create_function(vm.heap(), [this, value, is_fulfilled, &vm]() -> ThrowCompletionOr<Value> {
-            TRY(vm.push_execution_context(*m_suspended_execution_context, {}));
-            continue_async_execution(vm, value, is_fulfilled);
-            vm.pop_execution_context();
-            return js_undefined();
-        }),
-        vm.current_realm());
+    vm.host_enqueue_promise_job(PromiseJob::resume_async_function(*this, value, is_fulfilled), vm.current_realm());
+}
+
+ThrowCompletionOr<Value> AsyncFunctionDriverWrapper::resume_after_await(VM& vm, Value value, bool is_fulfilled)
+{
+    TRY(vm.push_execution_context(*m_suspended_execution_context, {}));
+    continue_async_execution(vm, value, is_fulfilled);
+    vm.pop_execution_context();
+    return js_undefined();
 }
 
 void AsyncFunctionDriverWrapper::continue_async_execution(VM& vm, Value value, bool is_successful)
@@ -238,6 +248,8 @@ void AsyncFunctionDriverWrapper::visit_edges(Cell::Visitor& visitor)
     if (m_suspended_execution_context)
         m_suspended_execution_context->visit_edges(visitor);
     visitor.visit(m_on_settled);
+    visitor.visit(m_on_settled_fulfill_reaction);
+    visitor.visit(m_on_settled_reject_reaction);
 }
 
 }
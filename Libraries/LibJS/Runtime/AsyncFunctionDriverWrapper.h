@@ -26,6 +26,7 @@ public:
 
     void continue_async_execution(VM&, Value, bool is_successful);
     void schedule_resume(Value, bool is_fulfilled);
+    ThrowCompletionOr<Value> resume_after_await(VM&, Value, bool is_fulfilled);
 
 private:
     AsyncFunctionDriverWrapper(Realm&, GC::Ref<GeneratorObject>, GC::Ref<Promise> top_level_promise);
@@ -37,6 +38,8 @@ private:
     OwnPtr<ExecutionContext> m_suspended_execution_context;
 
     GC::Ptr<NativeFunction> m_on_settled;
+    GC::Ptr<PromiseReaction> m_on_settled_fulfill_reaction;
+    GC::Ptr<PromiseReaction> m_on_settled_reject_reaction;
     bool m_is_initial_execution { true };
 };
 
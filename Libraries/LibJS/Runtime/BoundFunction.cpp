@@ -108,10 +108,11 @@ void BoundFunction::visit_edges(Visitor& visitor)
     visitor.visit(m_bound_arguments);
 }
 
-void BoundFunction::get_stack_frame_info(size_t& registers_and_locals_count, ReadonlySpan<Value>& constants, size_t& argument_count)
+ThrowCompletionOr<void> BoundFunction::get_stack_frame_info(size_t& registers_and_locals_count, ReadonlySpan<Value>& constants, size_t& argument_count)
 {
-    m_bound_target_function->get_stack_frame_info(registers_and_locals_count, constants, argument_count);
+    TRY(m_bound_target_function->get_stack_frame_info(registers_and_locals_count, constants, argument_count));
     argument_count += m_bound_arguments.size();
+    return {};
 }
 
 Utf16String BoundFunction::name_for_call_stack() const
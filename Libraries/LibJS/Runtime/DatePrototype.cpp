@@ -1004,7 +1004,10 @@ JS_DEFINE_NATIVE_FUNCTION(DatePrototype::to_locale_date_string)
         return PrimitiveString::create(vm, "Invalid Date"_string);
 
     // 3. Let dateFormat be ? CreateDateTimeFormat(%DateTimeFormat%, locales, options, "date", "date").
-    auto date_format = TRY(Intl::create_date_time_format(vm, realm.intrinsics().intl_date_time_format_constructor(), locales, options, Intl::OptionRequired::Date, Intl::OptionDefaults::Date));
+    // OPTIMIZATION: The DateTimeFormat is not observable by script, so we reuse one from the realm's formatter cache if we can.
+    auto date_format = TRY(realm.intl_formatter_cache().ensure<Intl::DateTimeFormat>(Intl::FormatterCache::Type::DateTimeFormatDate, locales, options, [&] {
+        return Intl::create_date_time_format(vm, realm.intrinsics().intl_date_time_format_constructor(), locales, options, Intl::OptionRequired::Date, Intl::OptionDefaults::Date);
+    }));
 
     // 4. Return ? FormatDateTime(dateFormat, x).
     auto formatted = TRY(Intl::format_date_time(vm, date_format, time));
@@ -1028,7 +1031,10 @@ JS_DEFINE_NATIVE_FUNCTION(DatePrototype::to_locale_string)
         return PrimitiveString::create(vm, "Invalid Date"_string);
 
     // 3. Let dateFormat be ? CreateDateTimeFormat(%DateTimeFormat%, locales, options, "any", "all").
-    auto date_format = TRY(Intl::create_date_time_format(vm, realm.intrinsics().intl_date_time_format_constructor(), locales, options, Intl::OptionRequired::Any, Intl::OptionDefaults::All));
+    // OPTIMIZATION: The DateTimeFormat is not observable by script, so we reuse one from the realm's formatter cache if we can.
+    auto date_format = TRY(realm.intl_formatter_cache().ensure<Intl::DateTimeFormat>(Intl::FormatterCache::Type::DateTimeFormatAny, locales, options, [&] {
+        return Intl::create_date_time_format(vm, realm.intrinsics().intl_date_time_format_constructor(), locales, options, Intl::OptionRequired::Any, Intl::OptionDefaults::All);
+    }));
 
     // 4. Return ? FormatDateTime(dateFormat, x).
     auto formatted = TRY(Intl::format_date_time(vm, date_format, time));
@@ -1052,7 +1058,10 @@ JS_DEFINE_NATIVE_FUNCTION(DatePrototype::to_locale_time_string)
         return PrimitiveString::create(vm, "Invalid Date"_string);
 
     // 3. Let timeFormat be ? CreateDateTimeFormat(%DateTimeFormat%, locales, options, "time", "time").
-    auto time_format = TRY(Intl::create_date_time_format(vm, realm.intrinsics().intl_date_time_format_constructor(), locales, options, Intl::OptionRequired::Time, Intl::OptionDefaults::Time));
+    // OPTIMIZATION: The DateTimeFormat is not observable by script, so we reuse one from the realm's formatter cache if we can.
+    auto time_format = TRY(realm.intl_formatter_cache().ensure<Intl::DateTimeFormat>(Intl::FormatterCache::Type::DateTimeFormatTime, locales, options, [&] {
+        return Intl::create_date_time_format(vm, realm.intrinsics().intl_date_time_format_constructor(), locales, options, Intl::OptionRequired::Time, Intl::OptionDefaults::Time);
+    }));
 
     // 4. Return ? FormatDateTime(timeFormat, x).
     auto formatted = TRY(Intl::format_date_time(vm, time_format, time));
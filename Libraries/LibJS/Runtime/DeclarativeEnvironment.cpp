@@ -9,6 +9,7 @@
 #include <LibJS/Runtime/Error.h>
 #include <LibJS/Runtime/FunctionObject.h>
 #include <LibJS/Runtime/GlobalObject.h>
+#include <LibJS/Runtime/VM.h>
 #include <LibJS/Runtime/Value.h>
 
 namespace JS {
@@ -18,12 +19,14 @@ GC_DEFINE_ALLOCATOR(DeclarativeEnvironment);
 DeclarativeEnvironment::DeclarativeEnvironment()
     : Environment(nullptr, IsDeclarative::Yes)
     , m_dispose_capability(new_dispose_capability())
+    , m_environment_serial_number(vm().next_environment_serial_number())
 {
 }
 
 DeclarativeEnvironment::DeclarativeEnvironment(Environment* parent_environment)
     : Environment(parent_environment, IsDeclarative::Yes)
     , m_dispose_capability(new_dispose_capability())
+    , m_environment_serial_number(vm().next_environment_serial_number())
 {
 }
 
@@ -31,6 +34,7 @@ DeclarativeEnvironment::DeclarativeEnvironment(Environment* parent_environment,
     : Environment(parent_environment, IsDeclarative::Yes)
     , m_bindings(bindings)
     , m_dispose_capability(new_dispose_capability())
+    , m_environment_serial_number(vm().next_environment_serial_number())
 {
 }
 
@@ -71,7 +75,7 @@ ThrowCompletionOr<void> DeclarativeEnvironment::create_mutable_binding(VM&, Utf1
         .initialized = false,
     });
 
-    ++m_environment_serial_number;
+    m_environment_serial_number = vm().next_environment_serial_number();
 
     // 3. Return unused.
     return {};
@@ -94,7 +98,7 @@ ThrowCompletionOr<void> DeclarativeEnvironment::create_immutable_binding(VM&, Ut
         .initialized = false,
     });
 
-    ++m_environment_serial_number;
+    m_environment_serial_number = vm().next_environment_serial_number();
 
     // 3. Return unused.
     return {};
@@ -204,7 +208,7 @@ ThrowCompletionOr<bool> DeclarativeEnvironment::delete_binding(VM&, Utf16FlyStri
     // NOTE: We keep the entries in m_bindings to avoid disturbing indices.
     binding_and_index->binding() = {};
 
-    ++m_environment_serial_number;
+    m_environment_serial_number = vm().next_environment_serial_number();
 
     // 4. Return true.
     return true;
@@ -136,12 +136,13 @@ void ECMAScriptFunctionObject::initialize(Realm& realm)
     }
 }
 
-void ECMAScriptFunctionObject::get_stack_frame_info(size_t& registers_and_locals_count, ReadonlySpan<Value>& constants, size_t& argument_count)
+ThrowCompletionOr<void> ECMAScriptFunctionObject::get_stack_frame_info(size_t& registers_and_locals_count, ReadonlySpan<Value>& constants, size_t& argument_count)
 {
     auto& executable = shared_data().m_executable;
     if (!executable) {
         auto rust_executable = RustIntegration::compile_function(vm(), *m_shared_data, false);
-        VERIFY(rust_executable);
+        if (!rust_executable)
+            return vm().throw_completion<SyntaxError>(ErrorType::FunctionCouldNotBeReparsed, m_shared_data->m_name);
         executable = rust_executable;
         executable->name = m_shared_data->m_name;
         if (Bytecode::g_dump_bytecode)
@@ -151,6 +152,7 @@ void ECMAScriptFunctionObject::get_stack_frame_info(size_t& registers_and_locals
     registers_and_locals_count = executable->registers_and_locals_count;
     constants = executable->constants;
     argument_count = max(argument_count, static_cast<size_t>(formal_parameter_count()));
+    return {};
 }
 
 // 10.2.1 [[Call]] ( thisArgument, argumentsList ), https://tc39.es/ecma262/#sec-ecmascript-function-objects-call-thisargument-argumentslist
@@ -47,6 +47,7 @@
     M(DynamicImportNotAllowed, "Dynamic Imports are not allowed")                                                                   \
     M(FinalizationRegistrySameTargetAndValue, "Target and held value must not be the same")                                         \
     M(FixedArrayBuffer, "ArrayBuffer is not resizable")                                                                             \
+    M(FunctionCouldNotBeReparsed, "Function '{}' could not be parsed again for compilation")                                        \
     M(GeneratorAlreadyExecuting, "Generator is already executing")                                                                  \
     M(GeneratorBrandMismatch, "Generator brand '{}' does not match generator brand '{}')")                                          \
     M(GetCapabilitiesExecutorCalledMultipleTimes, "GetCapabilitiesExecutor was called multiple times")                              \
@@ -0,0 +1,64 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <LibJS/Runtime/Date.h>
+#include <LibJS/Runtime/Intl/FormatterCache.h>
+#include <LibJS/Runtime/Intl/IntlObject.h>
+#include <LibJS/Runtime/PrimitiveString.h>
+
+namespace JS::Intl {
+
+Optional<FormatterCache::Key> FormatterCache::cache_key(Type type, Value locales, Value options)
+{
+    // NB: An undefined options value is coerced to a new object with a null prototype, so none of the options lookups
+    //     are observable. An options object, on the other hand, may have getters that must be called every time.
+    if (!options.is_undefined())
+        return {};
+
+    Key key { .type = type, .locale = {}, .time_zone = {} };
+
+    // NB: A String is canonicalized as a single-element locale list without invoking any user code, but an array-like
+    //     locale list may have getters or be a Proxy.
+    if (locales.is_string())
+        key.locale = locales.as_string().utf8_string();
+    else if (!locales.is_undefined())
+        return {};
+
+    // NB: Date-time formats depend on the system time zone, which may change over the lifetime of the realm.
+    if (first_is_one_of(type, Type::DateTimeFormatAny, Type::DateTimeFormatDate, Type::DateTimeFormatTime))
+        key.time_zone = system_time_zone_identifier();
+
+    return key;
+}
+
+GC::Ptr<IntlObject> FormatterCache::find(Key const& key)
+{
+    auto index = m_entries.find_first_index_if([&](auto const& entry) { return entry.key == key; });
+    if (!index.has_value())
+        return {};
+
+    // Move the entry to the end, marking it as the most recently used.
+    if (*index != m_entries.size() - 1)
+        m_entries.append(m_entries.take(*index));
+    return m_entries.last().formatter;
+}
+
+void FormatterCache::insert(Key key, IntlObject& formatter)
+{
+    if (m_entries.size() == capacity) {
+        m_entries.take_first();
+        ++m_statistics.evictions;
+    }
+    m_entries.append({ move(key), formatter });
+}
+
+void FormatterCache::visit_edges(Cell::Visitor& visitor)
+{
+    for (auto& entry : m_entries)
+        visitor.visit(entry.formatter);
+}
+
+}
@@ -0,0 +1,101 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/Optional.h>
+#include <AK/String.h>
+#include <AK/TypeCasts.h>
+#include <AK/Vector.h>
+#include <LibGC/Ptr.h>
+#include <LibJS/Export.h>
+#include <LibJS/Forward.h>
+#include <LibJS/Heap/Cell.h>
+#include <LibJS/Runtime/Completion.h>
+#include <LibJS/Runtime/Value.h>
+
+namespace JS::Intl {
+
+class IntlObject;
+
+// A per-realm cache of the Intl objects created internally by the locale-sensitive builtins, such as
+// Number.prototype.toLocaleString and String.prototype.localeCompare. These objects are never exposed to script, so
+// one may be reused by a later call with the same arguments, as long as creating it had no observable side effects.
+// This saves resolving the locale and creating the ICU formatter on every call.
+class JS_API FormatterCache {
+public:
+    enum class Type : u8 {
+        Collator,
+        NumberFormat,
+        DateTimeFormatAny,
+        DateTimeFormatDate,
+        DateTimeFormatTime,
+    };
+
+    struct Statistics {
+        size_t hits { 0 };
+        size_t misses { 0 };
+        size_t evictions { 0 };
+        size_t uncacheable_lookups { 0 };
+    };
+
+    // Once this many formatters are cached, the least recently used one is evicted.
+    static constexpr size_t capacity = 32;
+
+    // Returns the cached formatter for the given constructor arguments, or creates and caches one. Only arguments that
+    // can be processed without observable side effects are cached, i.e. locales must be undefined or a String and
+    // options must be undefined. For any other arguments, the formatter is always created.
+    template<typename T, typename Callback>
+    ThrowCompletionOr<GC::Ref<T>> ensure(Type type, Value locales, Value options, Callback&& create)
+    {
+        auto key = cache_key(type, locales, options);
+        if (!key.has_value()) {
+            ++m_statistics.uncacheable_lookups;
+            return GC::Ref<T> { as<T>(*TRY(create())) };
+        }
+
+        if (auto formatter = find(*key)) {
+            ++m_statistics.hits;
+            return GC::Ref<T> { as<T>(*formatter) };
+        }
+
+        ++m_statistics.misses;
+        GC::Ref<T> formatter = as<T>(*TRY(create()));
+        insert(key.release_value(), *formatter);
+        return formatter;
+    }
+
+    // Reported by `js --dump-cache-stats`.
+    Statistics const& statistics() const { return m_statistics; }
+    void clear() { m_entries.clear(); }
+
+    void visit_edges(Cell::Visitor&);
+
+private:
+    struct Key {
+        Type type;
+        Optional<String> locale;
+        Optional<String> time_zone;
+
+        bool operator==(Key const&) const = default;
+    };
+
+    struct Entry {
+        Key key;
+        GC::Ref<IntlObject> formatter;
+    };
+
+    static Optional<Key> cache_key(Type, Value locales, Value options);
+
+    GC::Ptr<IntlObject> find(Key const&);
+    void insert(Key, IntlObject&);
+
+    // Ordered from least to most recently used.
+    Vector<Entry> m_entries;
+    Statistics m_statistics;
+};
+
+}
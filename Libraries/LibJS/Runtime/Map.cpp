@@ -4,6 +4,7 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <AK/IntegralMath.h>
 #include <LibJS/Runtime/Map.h>
 
 namespace JS {
@@ -20,74 +21,160 @@ Map::Map(Object& prototype)
 {
 }
 
+size_t Map::bucket_count_for(size_t entry_count)
+{
+    return AK::exp2(AK::ceil_log2(max(entry_count * 2, minimum_bucket_count)));
+}
+
+Optional<u32> Map::find_slot_index(Value const& key) const
+{
+    if (m_buckets.is_empty())
+        return {};
+    for (auto index = m_buckets[bucket_index_for(key)]; index != invalid_slot_index; index = m_slots[index].next_in_bucket) {
+        if (ValueTraits::equals(m_slots[index].entry.key, key))
+            return index;
+    }
+    return {};
+}
+
+size_t Map::first_slot_index_at_or_after(u64 insertion_id) const
+{
+    // NOTE: Slots are always ordered by insertion id, so we can binary search for the lower bound.
+    size_t low = 0;
+    size_t high = m_slots.size();
+    while (low < high) {
+        auto middle = low + (high - low) / 2;
+        if (m_slots[middle].insertion_id < insertion_id)
+            low = middle + 1;
+        else
+            high = middle;
+    }
+    return low;
+}
+
+void Map::rehash(size_t bucket_count)
+{
+    VERIFY(is_power_of_two(bucket_count));
+
+    // Compact the slots in place, dropping tombstones while preserving insertion order.
+    size_t live_index = 0;
+    for (size_t i = 0; i < m_slots.size(); ++i) {
+        if (m_slots[i].is_tombstone())
+            continue;
+        if (live_index != i)
+            m_slots[live_index] = m_slots[i];
+        ++live_index;
+    }
+    VERIFY(live_index == m_live_entry_count);
+    if (live_index != m_slots.size()) {
+        m_slots.shrink(live_index, true);
+        // Slot positions have changed, live iterators need to find their place again.
+        ++m_compaction_epoch;
+    }
+
+    m_buckets.resize(bucket_count);
+    m_buckets.fill(invalid_slot_index);
+    for (u32 index = 0; index < m_slots.size(); ++index) {
+        auto& head = m_buckets[bucket_index_for(m_slots[index].entry.key)];
+        m_slots[index].next_in_bucket = head;
+        head = index;
+    }
+}
+
 // 24.1.3.1 Map.prototype.clear ( ), https://tc39.es/ecma262/#sec-map.prototype.clear
 void Map::map_clear()
 {
-    m_keys.clear();
-    m_entries.clear();
+    m_slots.clear();
+    m_buckets.clear();
+    m_live_entry_count = 0;
+    // NOTE: Insertion ids keep counting up, so iterators created before the clear will visit entries added after it.
+    ++m_compaction_epoch;
 }
 
 // 24.1.3.3 Map.prototype.delete ( key ), https://tc39.es/ecma262/#sec-map.prototype.delete
 bool Map::map_remove(Value const& key)
 {
-    Optional<size_t> index;
+    if (m_buckets.is_empty())
+        return false;
 
-    for (auto it = m_keys.begin(); !it.is_end(); ++it) {
-        if (ValueTraits::equals(*it, key)) {
-            index = it.key();
-            break;
+    auto* link = &m_buckets[bucket_index_for(key)];
+    while (*link != invalid_slot_index) {
+        auto& slot = m_slots[*link];
+        if (ValueTraits::equals(slot.entry.key, key)) {
+            *link = slot.next_in_bucket;
+            slot.entry = { js_special_empty_value(), js_undefined() };
+            slot.next_in_bucket = invalid_slot_index;
+            --m_live_entry_count;
+
+            // Don't let tombstones dominate the table.
+            if (m_slots.size() > minimum_bucket_count && m_live_entry_count < m_slots.size() / 4)
+                rehash(bucket_count_for(m_live_entry_count));
+            return true;
         }
+        link = &slot.next_in_bucket;
     }
-
-    if (!index.has_value())
-        return false;
-
-    m_keys.remove(*index);
-    m_entries.remove(key);
-    return true;
+    return false;
 }
 
 // 24.1.3.6 Map.prototype.get ( key ), https://tc39.es/ecma262/#sec-map.prototype.get
 Optional<Value> Map::map_get(Value const& key) const
 {
-    if (auto it = m_entries.find(key); it != m_entries.end())
-        return it->value;
+    if (auto index = find_slot_index(key); index.has_value())
+        return m_slots[*index].entry.value;
     return {};
 }
 
 // 24.1.3.7 Map.prototype.has ( key ), https://tc39.es/ecma262/#sec-map.prototype.has
 bool Map::map_has(Value const& key) const
 {
-    return m_entries.contains(key);
+    return find_slot_index(key).has_value();
 }
 
 // 24.1.3.9 Map.prototype.set ( key, value ), https://tc39.es/ecma262/#sec-map.prototype.set
 void Map::map_set(Value const& key, Value value)
 {
-    auto it = m_entries.find(key);
-    if (it != m_entries.end()) {
-        it->value = value;
-    } else {
-        auto index = m_next_insertion_id++;
-        m_keys.insert(index, key);
-        m_entries.set(key, value);
+    if (auto index = find_slot_index(key); index.has_value()) {
+        m_slots[*index].entry.value = value;
+        return;
     }
+
+    // Keep the load factor (tombstones included) at or below one slot per bucket.
+    if (m_slots.size() >= m_buckets.size())
+        rehash(bucket_count_for(m_live_entry_count + 1));
+
+    auto index = static_cast<u32>(m_slots.size());
+    auto& head = m_buckets[bucket_index_for(key)];
+    m_slots.append({ { key, value }, m_next_insertion_id++, head });
+    head = index;
+    ++m_live_entry_count;
 }
 
 size_t Map::map_size() const
 {
-    return m_keys.size();
+    return m_live_entry_count;
+}
+
+void Map::copy_entries_from(Map const& other)
+{
+    VERIFY(m_slots.is_empty());
+    m_slots.ensure_capacity(other.m_live_entry_count);
+    for (auto const& slot : other.m_slots) {
+        if (!slot.is_tombstone())
+            m_slots.unchecked_append({ slot.entry, m_next_insertion_id++, invalid_slot_index });
+    }
+    m_live_entry_count = m_slots.size();
+    rehash(bucket_count_for(m_live_entry_count));
 }
 
 void Map::visit_edges(Cell::Visitor& visitor)
 {
     Base::visit_edges(visitor);
-    for (auto& value : m_entries) {
-        visitor.visit(value.key);
-        visitor.visit(value.value);
+    for (auto& slot : m_slots) {
+        if (slot.is_tombstone())
+            continue;
+        visitor.visit(slot.entry.key);
+        visitor.visit(slot.entry.value);
     }
-    // NOTE: The entries in m_keys are already visited by the walk over m_entries above.
-    visitor.ignore(m_keys);
 }
 
 }
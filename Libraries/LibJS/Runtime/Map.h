@@ -6,8 +6,7 @@
 
 #pragma once
 
-#include <AK/HashMap.h>
-#include <AK/RedBlackTree.h>
+#include <AK/Vector.h>
 #include <LibJS/Export.h>
 #include <LibJS/Runtime/GlobalObject.h>
 #include <LibJS/Runtime/Object.h>
@@ -16,6 +15,11 @@
 
 namespace JS {
 
+// NOTE: Map entries are kept in a deterministic ordered hash table: a dense array of slots in insertion order,
+//       plus a power-of-two array of bucket heads that chains slots with the same hash together. Removing an
+//       entry leaves a tombstone slot behind, and tombstones are dropped when the table is compacted on rehash.
+//       Every slot carries a monotonically increasing insertion id, which lets iterators find their place again
+//       after a compaction or a clear without the table having to keep track of them.
 class JS_API Map : public Object {
     JS_OBJECT(Map, Object);
     GC_DECLARE_ALLOCATOR(Map);
@@ -34,6 +38,13 @@ public:
     void map_set(Value const&, Value);
     size_t map_size() const;
 
+    void copy_entries_from(Map const&);
+
+    struct Entry {
+        Value key;
+        Value value;
+    };
+
     struct EndIterator {
     };
 
@@ -41,29 +52,37 @@ public:
     struct IteratorImpl {
         bool is_end() const
         {
-            return m_map->m_keys.begin_from(m_index).is_end()
-                && m_map->m_keys.find_smallest_not_below_iterator(m_index).is_end();
+            ensure_position();
+            return m_position >= m_map->m_slots.size();
         }
 
         IteratorImpl& operator++()
         {
-            ++m_index;
+            // NOTE: The entry we're on may have been removed since it was dereferenced, so we advance past
+            //       its insertion id instead of looking for the next live slot first.
+            ++m_next_insertion_id;
+            ++m_position;
             return *this;
         }
 
         decltype(auto) operator*()
         {
-            ensure_next_element();
-            return *m_map->m_entries.find(*m_map->m_keys.begin_from(m_index));
+            ensure_position();
+            return (m_map->m_slots[m_position].entry);
         }
 
         decltype(auto) operator*() const
         {
-            ensure_next_element();
-            return *m_map->m_entries.find(*m_map->m_keys.begin_from(m_index));
+            ensure_position();
+            return (m_map->m_slots[m_position].entry);
         }
 
-        bool operator==(IteratorImpl const& other) const { return m_index == other.m_index && &m_map == &other.m_map; }
+        bool operator==(IteratorImpl const& other) const
+        {
+            ensure_position();
+            other.ensure_position();
+            return m_position == other.m_position && m_map.ptr() == other.m_map.ptr();
+        }
         bool operator==(EndIterator const&) const { return is_end(); }
 
         void visit_edges(Cell::Visitor& visitor)
@@ -76,35 +95,37 @@ public:
         IteratorImpl(Map const& map)
         requires(IsConst)
             : m_map(map)
+            , m_compaction_epoch(map.m_compaction_epoch)
         {
-            ensure_index();
+            ensure_position();
         }
 
         IteratorImpl(Map& map)
         requires(!IsConst)
             : m_map(map)
+            , m_compaction_epoch(map.m_compaction_epoch)
         {
-            ensure_index();
-        }
-
-        void ensure_index() const
-        {
-            if (m_map->m_keys.is_empty())
-                m_index = m_map->m_next_insertion_id;
-            else
-                m_index = m_map->m_keys.begin().key();
+            ensure_position();
         }
 
-        void ensure_next_element() const
+        // Moves to the first live slot whose insertion id is not below m_next_insertion_id.
+        void ensure_position() const
         {
-            if (auto it = m_map->m_keys.find_smallest_not_below_iterator(m_index); it.is_end())
-                m_index = m_map->m_next_insertion_id;
-            else
-                m_index = it.key();
+            auto const& slots = m_map->m_slots;
+            if (m_compaction_epoch != m_map->m_compaction_epoch) {
+                m_position = m_map->first_slot_index_at_or_after(m_next_insertion_id);
+                m_compaction_epoch = m_map->m_compaction_epoch;
+            }
+            while (m_position < slots.size() && slots[m_position].is_tombstone())
+                ++m_position;
+            if (m_position < slots.size())
+                m_next_insertion_id = slots[m_position].insertion_id;
         }
 
         Conditional<IsConst, GC::Ref<Map const>, GC::Ref<Map>> m_map;
-        mutable size_t m_index { 0 };
+        mutable u64 m_next_insertion_id { 0 };
+        mutable size_t m_position { 0 };
+        mutable u32 m_compaction_epoch { 0 };
     };
 
     using Iterator = IteratorImpl<false>;
@@ -118,9 +139,28 @@ private:
     explicit Map(Object& prototype);
     virtual void visit_edges(Visitor& visitor) override;
 
-    size_t m_next_insertion_id { 0 };
-    RedBlackTree<size_t, Value> m_keys;
-    HashMap<Value, Value, ValueTraits> m_entries;
+    static constexpr u32 invalid_slot_index = NumericLimits<u32>::max();
+    static constexpr size_t minimum_bucket_count = 8;
+
+    struct Slot {
+        bool is_tombstone() const { return entry.key.is_special_empty_value(); }
+
+        Entry entry;
+        u64 insertion_id { 0 };
+        u32 next_in_bucket { invalid_slot_index };
+    };
+
+    static size_t bucket_count_for(size_t entry_count);
+    u32 bucket_index_for(Value const& key) const { return ValueTraits::hash(key) & (m_buckets.size() - 1); }
+    Optional<u32> find_slot_index(Value const& key) const;
+    size_t first_slot_index_at_or_after(u64 insertion_id) const;
+    void rehash(size_t bucket_count);
+
+    Vector<Slot> m_slots;
+    Vector<u32> m_buckets;
+    size_t m_live_entry_count { 0 };
+    u64 m_next_insertion_id { 0 };
+    u32 m_compaction_epoch { 0 };
 };
 
 template<>
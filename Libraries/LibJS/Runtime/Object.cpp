@@ -1734,6 +1734,7 @@ void Object::free_indexed_elements()
     }
     m_indexed_elements = nullptr;
     m_indexed_storage_kind = IndexedStorageKind::None;
+    m_indexed_element_kind = IndexedElementKind::Int32;
     m_indexed_array_like_size = 0;
 }
 
@@ -1783,6 +1784,15 @@ void Object::transition_to_dictionary()
 
     m_indexed_elements = reinterpret_cast<Value*>(dict);
     m_indexed_storage_kind = IndexedStorageKind::Dictionary;
+    m_indexed_element_kind = IndexedElementKind::Generic;
+}
+
+ALWAYS_INLINE void Object::update_indexed_element_kind(Value value)
+{
+    // Holes don't change the element kind; every other value can only widen it.
+    if (m_indexed_element_kind == IndexedElementKind::Generic || value.is_int32() || value.is_special_empty_value())
+        return;
+    m_indexed_element_kind = value.is_double() ? IndexedElementKind::Double : IndexedElementKind::Generic;
 }
 
 Optional<ValueAndAttributes> Object::indexed_get(u32 index) const
@@ -1838,6 +1848,7 @@ void Object::indexed_put(u32 index, Value value, PropertyAttributes attributes)
         m_indexed_storage_kind = storing_hole || index > 0 ? IndexedStorageKind::Holey : IndexedStorageKind::Packed;
         u32 needed = index + 1;
         ensure_indexed_elements(needed);
+        update_indexed_element_kind(value);
         m_indexed_elements[index] = value;
         m_indexed_array_like_size = index + 1;
         return;
@@ -1861,6 +1872,7 @@ void Object::indexed_put(u32 index, Value value, PropertyAttributes attributes)
     if (m_indexed_storage_kind == IndexedStorageKind::Packed && storing_hole)
         m_indexed_storage_kind = IndexedStorageKind::Holey;
 
+    update_indexed_element_kind(value);
     m_indexed_elements[index] = value;
 
     // Promote Holey -> Packed when filling the last hole.
@@ -2072,8 +2084,10 @@ void Object::set_indexed_property_elements(Vector<Value>&& values)
     m_indexed_storage_kind = IndexedStorageKind::Packed;
     m_indexed_array_like_size = size;
     m_indexed_elements = allocate_indexed_elements(size);
-    for (u32 i = 0; i < size; ++i)
+    for (u32 i = 0; i < size; ++i) {
+        update_indexed_element_kind(values[i]);
         m_indexed_elements[i] = values[i];
+    }
 }
 
 ReadonlySpan<Value> Object::indexed_packed_elements_span() const
@@ -76,6 +76,15 @@ enum class IndexedStorageKind : u8 {
     Dictionary = 3,
 };
 
+// Tracks what kind of values the Packed/Holey element storage holds. This only ever widens
+// (Int32 -> Double -> Generic) until the storage is reset, which lets builtins that see an
+// Int32 or Double kind treat every present element as a number without looking at it.
+enum class IndexedElementKind : u8 {
+    Int32 = 0,
+    Double = 1,
+    Generic = 2,
+};
+
 class JS_API Object : public Cell {
     GC_CELL(Object, Cell);
     GC_DECLARE_ALLOCATOR(Object);
@@ -304,6 +313,12 @@ public:
     Vector<u32> indexed_indices() const;
     void set_indexed_property_elements(Vector<Value>&& values);
     IndexedStorageKind indexed_storage_kind() const { return m_indexed_storage_kind; }
+    IndexedElementKind indexed_element_kind() const { return m_indexed_element_kind; }
+    bool indexed_elements_are_numbers() const
+    {
+        return (m_indexed_storage_kind == IndexedStorageKind::Packed || m_indexed_storage_kind == IndexedStorageKind::Holey)
+            && m_indexed_element_kind != IndexedElementKind::Generic;
+    }
 
     template<typename Callback>
     void indexed_for_each_value(Callback callback)
@@ -378,7 +393,8 @@ private:
 
     u8 m_flags { Flag::IsExtensible };
     IndexedStorageKind m_indexed_storage_kind { IndexedStorageKind::None };
-    // 2 bytes padding
+    IndexedElementKind m_indexed_element_kind { IndexedElementKind::Int32 };
+    // 1 byte padding
     u32 m_indexed_array_like_size { 0 };
     void set_shape(Shape& shape) { m_shape = &shape; }
 
@@ -390,6 +406,7 @@ private:
     void ensure_indexed_elements(u32 needed_capacity);
     void grow_indexed_elements(u32 needed_capacity);
     void transition_to_dictionary();
+    void update_indexed_element_kind(Value);
     void free_indexed_elements();
     void ensure_named_storage_capacity(u32 needed);
     bool named_storage_is_inline() const { return m_named_properties == const_cast<Object*>(this)->m_inline_named_storage; }
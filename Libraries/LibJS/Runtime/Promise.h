@@ -46,6 +46,10 @@ public:
     void reject(Value reason);
     Value perform_then(Value on_fulfilled, Value on_rejected, GC::Ptr<PromiseCapability> result_capability);
 
+    // Steps 9-12 of PerformPromiseThen, for callers that create (or reuse) the reactions themselves. Only the reaction
+    // matching the promise's state is required once the promise is settled.
+    void perform_then_with_reactions(GC::Ptr<PromiseReaction> fulfill_reaction, GC::Ptr<PromiseReaction> reject_reaction);
+
     bool is_handled() const { return m_is_handled; }
     void set_is_handled() { m_is_handled = true; }
 
@@ -7,6 +7,7 @@
 
 #include <AK/Debug.h>
 #include <LibJS/Runtime/AbstractOperations.h>
+#include <LibJS/Runtime/AsyncFunctionDriverWrapper.h>
 #include <LibJS/Runtime/GlobalObject.h>
 #include <LibJS/Runtime/JobCallback.h>
 #include <LibJS/Runtime/Promise.h>
@@ -84,13 +85,11 @@ static ThrowCompletionOr<Value> run_reaction_job(VM& vm, PromiseReaction& reacti
 }
 
 // 27.2.2.1 NewPromiseReactionJob ( reaction, argument ), https://tc39.es/ecma262/#sec-newpromisereactionjob
-PromiseJob create_promise_reaction_job(VM& vm, PromiseReaction& reaction, Value argument)
+PromiseJobRecord create_promise_reaction_job(VM& vm, PromiseReaction& reaction, Value argument)
 {
     // 1. Let job be a new Job Abstract Closure with no parameters that captures reaction and argument and performs the following steps when called:
     //    See run_reaction_job for "the following steps".
-    auto job = GC::create_function(vm.heap(), [&vm, &reaction, argument] {
-        return run_reaction_job(vm, reaction, argument);
-    });
+    auto job = PromiseJob::reaction(reaction, argument);
 
     // 2. Let handlerRealm be null.
     Realm* handler_realm { nullptr };
@@ -142,7 +141,7 @@ static ThrowCompletionOr<Value> run_resolve_thenable_job(VM& vm, Promise& promis
 }
 
 // 27.2.2.2 NewPromiseResolveThenableJob ( promiseToResolve, thenable, then ), https://tc39.es/ecma262/#sec-newpromiseresolvethenablejob
-PromiseJob create_promise_resolve_thenable_job(VM& vm, Promise& promise_to_resolve, Value thenable, GC::Ref<JobCallback> then)
+PromiseJobRecord create_promise_resolve_thenable_job(VM& vm, Promise& promise_to_resolve, Value thenable, GC::Ref<JobCallback> then)
 {
     // 2. Let getThenRealmResult be Completion(GetFunctionRealm(then.[[Callback]])).
     auto get_then_realm_result = get_function_realm(vm, then->callback());
@@ -162,12 +161,45 @@ PromiseJob create_promise_resolve_thenable_job(VM& vm, Promise& promise_to_resol
 
     // 1. Let job be a new Job Abstract Closure with no parameters that captures promiseToResolve, thenable, and then and performs the following steps when called:
     //    See run_resolve_thenable_job() for "the following steps".
-    auto job = GC::create_function(vm.heap(), [&vm, &promise_to_resolve, thenable, then]() mutable {
-        return run_resolve_thenable_job(vm, promise_to_resolve, thenable, then);
-    });
+    auto job = PromiseJob::resolve_thenable(promise_to_resolve, thenable, then);
 
     // 6. Return the Record { [[Job]]: job, [[Realm]]: thenRealm }.
     return { job, then_realm };
 }
 
+PromiseJob PromiseJob::reaction(PromiseReaction& reaction, Value argument)
+{
+    return PromiseJob { Type::Reaction, reaction, argument };
+}
+
+PromiseJob PromiseJob::resolve_thenable(Promise& promise_to_resolve, Value thenable, JobCallback& then)
+{
+    return PromiseJob { Type::ResolveThenable, promise_to_resolve, thenable, &then };
+}
+
+PromiseJob PromiseJob::resume_async_function(AsyncFunctionDriverWrapper& async_function, Value value, bool is_fulfilled)
+{
+    return PromiseJob { Type::ResumeAsyncFunction, async_function, value, {}, is_fulfilled };
+}
+
+ThrowCompletionOr<Value> PromiseJob::run(VM& vm) const
+{
+    switch (m_type) {
+    case Type::Reaction:
+        return run_reaction_job(vm, static_cast<PromiseReaction&>(*m_target), m_value);
+    case Type::ResolveThenable:
+        return run_resolve_thenable_job(vm, static_cast<Promise&>(*m_target), m_value, *m_then);
+    case Type::ResumeAsyncFunction:
+        return static_cast<AsyncFunctionDriverWrapper&>(*m_target).resume_after_await(vm, m_value, m_is_fulfilled);
+    }
+    VERIFY_NOT_REACHED();
+}
+
+void PromiseJob::visit_edges(Cell::Visitor& visitor) const
+{
+    visitor.visit(m_target);
+    visitor.visit(m_value);
+    visitor.visit(m_then);
+}
+
 }
@@ -7,20 +7,57 @@
 
 #pragma once
 
-#include <LibJS/Runtime/GlobalObject.h>
-#include <LibJS/Runtime/JobCallback.h>
-#include <LibJS/Runtime/NativeFunction.h>
-#include <LibJS/Runtime/Promise.h>
+#include <LibGC/Ptr.h>
+#include <LibJS/Export.h>
+#include <LibJS/Forward.h>
+#include <LibJS/Heap/Cell.h>
+#include <LibJS/Runtime/Completion.h>
+#include <LibJS/Runtime/Value.h>
 
 namespace JS {
 
-struct PromiseJob {
-    GC::Ref<GC::Function<ThrowCompletionOr<Value>()>> job;
+// The Job Abstract Closures created by the promise abstract operations. Rather than allocating a closure for every job,
+// the job's kind and everything it captures are stored inline, so jobs can be queued without any allocation.
+class JS_API PromiseJob {
+public:
+    static PromiseJob reaction(PromiseReaction&, Value argument);
+    static PromiseJob resolve_thenable(Promise& promise_to_resolve, Value thenable, JobCallback& then);
+    static PromiseJob resume_async_function(AsyncFunctionDriverWrapper&, Value, bool is_fulfilled);
+
+    ThrowCompletionOr<Value> run(VM&) const;
+
+    void visit_edges(Cell::Visitor&) const;
+
+private:
+    enum class Type : u8 {
+        Reaction,
+        ResolveThenable,
+        ResumeAsyncFunction,
+    };
+
+    PromiseJob(Type type, Cell& target, Value value, GC::Ptr<JobCallback> then = {}, bool is_fulfilled = false)
+        : m_type(type)
+        , m_is_fulfilled(is_fulfilled)
+        , m_target(target)
+        , m_value(value)
+        , m_then(then)
+    {
+    }
+
+    Type m_type;
+    bool m_is_fulfilled { false };
+    GC::Ref<Cell> m_target;
+    Value m_value;
+    GC::Ptr<JobCallback> m_then;
+};
+
+struct PromiseJobRecord {
+    PromiseJob job;
     GC::Ptr<Realm> realm;
 };
 
-// NOTE: These return a PromiseJob to prevent awkward casting at call sites.
-PromiseJob create_promise_reaction_job(VM&, PromiseReaction&, Value argument);
-PromiseJob create_promise_resolve_thenable_job(VM&, Promise&, Value thenable, GC::Ref<JobCallback> then);
+// NOTE: These return a PromiseJobRecord to prevent awkward casting at call sites.
+PromiseJobRecord create_promise_reaction_job(VM&, PromiseReaction&, Value argument);
+PromiseJobRecord create_promise_resolve_thenable_job(VM&, Promise&, Value thenable, GC::Ref<JobCallback> then);
 
 }
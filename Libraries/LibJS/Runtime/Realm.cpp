@@ -7,6 +7,8 @@
 
 #include <AK/TypeCasts.h>
 #include <LibGC/DeferGC.h>
+#include <LibJS/Bytecode/Executable.h>
+#include <LibJS/Runtime/Array.h>
 #include <LibJS/Runtime/DeclarativeEnvironment.h>
 #include <LibJS/Runtime/GlobalEnvironment.h>
 #include <LibJS/Runtime/GlobalObject.h>
@@ -109,6 +111,25 @@ void Realm::visit_edges(Visitor& visitor)
     visitor.visit(m_global_declarative_environment);
     if (m_host_defined)
         m_host_defined->visit_edges(visitor);
+    for (auto& it : m_template_map) {
+        visitor.visit(it.value.script_or_module);
+        visitor.visit(it.value.executable);
+        visitor.visit(it.value.template_object);
+    }
+    m_intl_formatter_cache.visit_edges(visitor);
+}
+
+GC::Ptr<Array> Realm::template_object_for_site(Cell const* script_or_module, Bytecode::TemplateObjectCache const& cache) const
+{
+    auto it = m_template_map.find({ script_or_module, &cache });
+    if (it == m_template_map.end())
+        return {};
+    return it->value.template_object;
+}
+
+void Realm::set_template_object_for_site(GC::Ptr<Cell> script_or_module, Bytecode::Executable& executable, Bytecode::TemplateObjectCache const& cache, Array& template_object)
+{
+    m_template_map.set({ script_or_module, &cache }, { script_or_module, executable, template_object });
 }
 
 }
@@ -8,6 +8,7 @@
 #pragma once
 
 #include <AK/Badge.h>
+#include <AK/HashMap.h>
 #include <AK/HashTable.h>
 #include <AK/OwnPtr.h>
 #include <AK/StringView.h>
@@ -17,6 +18,7 @@
 #include <LibJS/Bytecode/Builtins.h>
 #include <LibJS/Export.h>
 #include <LibJS/Heap/Cell.h>
+#include <LibJS/Runtime/Intl/FormatterCache.h>
 #include <LibJS/Runtime/Intrinsics.h>
 #include <LibJS/Runtime/Value.h>
 
@@ -73,6 +75,16 @@ public:
 
     HashTable<GC::RawPtr<Shape>>& all_prototype_shapes() { return m_all_prototype_shapes; }
 
+    // [[TemplateMap]], which owns every template object created in this realm.
+    // A site is identified by its Script or Module Record together with its TemplateObjectCache, since scripts with
+    // identical source text share one executable (see CompiledProgramCache) but are still different Parse Nodes.
+    // The per-site TemplateObjectCache only holds a non-owning pointer to one of them as a fast path.
+    GC::Ptr<Array> template_object_for_site(Cell const* script_or_module, Bytecode::TemplateObjectCache const&) const;
+    void set_template_object_for_site(GC::Ptr<Cell> script_or_module, Bytecode::Executable&, Bytecode::TemplateObjectCache const&, Array&);
+
+    Intl::FormatterCache& intl_formatter_cache() { return m_intl_formatter_cache; }
+    Intl::FormatterCache const& intl_formatter_cache() const { return m_intl_formatter_cache; }
+
 private:
     Realm() = default;
 
@@ -85,6 +97,26 @@ private:
     OwnPtr<HostDefined> m_host_defined;                               // [[HostDefined]]
 
     HashTable<GC::RawPtr<Shape>> m_all_prototype_shapes;
+
+    struct TemplateSite {
+        Cell const* script_or_module { nullptr };
+        Bytecode::TemplateObjectCache const* cache { nullptr };
+
+        bool operator==(TemplateSite const&) const = default;
+    };
+    struct TemplateSiteTraits : public DefaultTraits<TemplateSite> {
+        static unsigned hash(TemplateSite const& site) { return pair_int_hash(ptr_hash(site.script_or_module), ptr_hash(site.cache)); }
+    };
+    struct TemplateMapEntry {
+        // NB: Keeps the script or module and the executable (and thus the cache) used as the key alive for as long
+        //     as the entry exists.
+        GC::Ptr<Cell> script_or_module;
+        GC::Ref<Bytecode::Executable> executable;
+        GC::Ref<Array> template_object;
+    };
+    HashMap<TemplateSite, TemplateMapEntry, TemplateSiteTraits> m_template_map;
+
+    Intl::FormatterCache m_intl_formatter_cache;
 };
 
 }
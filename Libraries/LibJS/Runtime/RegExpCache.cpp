@@ -0,0 +1,97 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <LibJS/Runtime/RegExpCache.h>
+#include <LibJS/Runtime/RegExpObject.h>
+
+namespace JS {
+
+RegExpCache& RegExpCache::the()
+{
+    static RegExpCache s_the;
+    return s_the;
+}
+
+static u8 to_key_flags(regex::ECMAScriptCompileFlags flags)
+{
+    return (flags.global << 0)
+        | (flags.ignore_case << 1)
+        | (flags.multiline << 2)
+        | (flags.dot_all << 3)
+        | (flags.unicode << 4)
+        | (flags.unicode_sets << 5)
+        | (flags.sticky << 6)
+        | (flags.has_indices << 7);
+}
+
+// NB: Looks the pattern up through a view, so that the caller's string is never copied or hashed. Must be called with
+//     the lock held.
+auto RegExpCache::find_entry(Utf16View const& pattern, u8 flags)
+{
+    return m_entries.find(hash_key(pattern, flags), [&](auto const& entry) {
+        return entry.key.flags == flags && entry.key.pattern.utf16_view() == pattern;
+    });
+}
+
+ErrorOr<NonnullRefPtr<CompiledRegExp>, String> RegExpCache::get_or_compile(Utf16String const& pattern, regex::ECMAScriptCompileFlags flags)
+{
+    auto key_flags = to_key_flags(flags);
+
+    {
+        Threading::MutexLocker locker { m_mutex };
+        if (auto it = find_entry(pattern.utf16_view(), key_flags); it != m_entries.end()) {
+            ++m_statistics.hits;
+            auto key = it->key;
+            auto compiled = it->value;
+
+            // Re-insert the entry at the end, marking it as the most recently used.
+            m_entries.remove(it);
+            m_entries.set(move(key), compiled);
+            return compiled;
+        }
+        ++m_statistics.misses;
+    }
+
+    // NB: The pattern is compiled without holding the lock, so a long compilation on one thread doesn't stall lookups
+    //     on another. If two threads race to compile the same pattern, the first one to finish wins.
+
+    // Parse the pattern from UTF-16 source to UTF-8 with escape normalization.
+    String parsed_pattern;
+    if (!pattern.is_empty()) {
+        auto result = parse_regex_pattern(pattern.utf16_view(), flags.unicode, flags.unicode_sets);
+        if (result.is_error())
+            return result.release_error().error;
+        parsed_pattern = result.release_value();
+    }
+
+    auto regex = TRY(regex::ECMAScriptRegex::compile(parsed_pattern.bytes_as_string_view(), flags));
+    auto compiled = CompiledRegExp::create(move(regex));
+
+    Threading::MutexLocker locker { m_mutex };
+    if (auto it = find_entry(pattern.utf16_view(), key_flags); it != m_entries.end())
+        return it->value;
+
+    if (m_entries.size() == capacity) {
+        m_entries.remove(m_entries.begin());
+        ++m_statistics.evictions;
+    }
+    m_entries.set({ .pattern = Utf16String::from_utf16(pattern.utf16_view()), .flags = key_flags }, compiled);
+    return compiled;
+}
+
+RegExpCache::Statistics RegExpCache::statistics() const
+{
+    Threading::MutexLocker locker { m_mutex };
+    return m_statistics;
+}
+
+void RegExpCache::clear()
+{
+    Threading::MutexLocker locker { m_mutex };
+    m_entries.clear();
+}
+
+}
@@ -0,0 +1,93 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/AtomicRefCounted.h>
+#include <AK/HashMap.h>
+#include <AK/NonnullRefPtr.h>
+#include <AK/String.h>
+#include <AK/Utf16String.h>
+#include <LibJS/Export.h>
+#include <LibThreading/Mutex.h>
+#include <LibRegex/ECMAScriptRegex.h>
+
+namespace JS {
+
+// A compiled regular expression program, shared by every RegExpObject (and every realm) with the same pattern and
+// flags. NB: Programs may be compiled while parsing a script off the main thread, but the program keeps the captures
+//     of its last match internally, so it must only ever be executed by the thread running JS.
+class CompiledRegExp : public AtomicRefCounted<CompiledRegExp> {
+public:
+    static NonnullRefPtr<CompiledRegExp> create(regex::ECMAScriptRegex regex)
+    {
+        return adopt_ref(*new CompiledRegExp(move(regex)));
+    }
+
+    regex::ECMAScriptRegex const& regex() const { return m_regex; }
+
+private:
+    explicit CompiledRegExp(regex::ECMAScriptRegex regex)
+        : m_regex(move(regex))
+    {
+    }
+
+    regex::ECMAScriptRegex m_regex;
+};
+
+// A process-wide cache of compiled regular expressions, keyed by the original source text of the pattern and the
+// flags. RegExp literals, RegExpCreate and the RegExp constructor all go through it, so a pattern is only parsed and
+// compiled once no matter how many objects, scripts or iframes create it. It is safe to use from any thread.
+class JS_API RegExpCache {
+public:
+    struct Statistics {
+        size_t hits { 0 };
+        size_t misses { 0 };
+        size_t evictions { 0 };
+    };
+
+    // Once this many programs are cached, the least recently used one is evicted. Objects that still use an evicted
+    // program keep it alive.
+    static constexpr size_t capacity = 512;
+
+    static RegExpCache& the();
+
+    // Returns the compiled program for the given pattern and flags, parsing and compiling it on a miss. Patterns that
+    // fail to compile are not cached, the error message is returned instead.
+    ErrorOr<NonnullRefPtr<CompiledRegExp>, String> get_or_compile(Utf16String const& pattern, regex::ECMAScriptCompileFlags);
+
+    // Reported by `js --dump-cache-stats`.
+    Statistics statistics() const;
+    void clear();
+
+private:
+    RegExpCache() = default;
+
+    struct Key {
+        // NB: This is a deep copy of the caller's pattern. Strings share their reference count and lazily computed
+        //     hash with every copy, which may live on another thread, so the cache must never hold on to a copy of the
+        //     caller's string itself. Its own copy is only ever touched while holding the lock.
+        Utf16String pattern;
+        u8 flags { 0 };
+
+        bool operator==(Key const&) const = default;
+    };
+
+    static unsigned hash_key(Utf16View const& pattern, u8 flags) { return pair_int_hash(pattern.hash(), flags); }
+
+    struct KeyTraits : public DefaultTraits<Key> {
+        static unsigned hash(Key const& key) { return hash_key(key.pattern.utf16_view(), key.flags); }
+    };
+
+    auto find_entry(Utf16View const& pattern, u8 flags);
+
+    mutable Threading::Mutex m_mutex;
+    // Ordered from least to most recently used.
+    OrderedHashMap<Key, NonnullRefPtr<CompiledRegExp>, KeyTraits> m_entries;
+    Statistics m_statistics;
+};
+
+}
@@ -354,6 +354,25 @@ static RegExpObject::Flags to_flag_bits(Utf16View const& flags)
     return flag_bits;
 }
 
+static regex::ECMAScriptCompileFlags to_compile_flags(RegExpObject::Flags flag_bits)
+{
+    regex::ECMAScriptCompileFlags flags {};
+    flags.global = has_flag(flag_bits, RegExpObject::Flags::Global);
+    flags.ignore_case = has_flag(flag_bits, RegExpObject::Flags::IgnoreCase);
+    flags.multiline = has_flag(flag_bits, RegExpObject::Flags::Multiline);
+    flags.dot_all = has_flag(flag_bits, RegExpObject::Flags::DotAll);
+    flags.unicode = has_flag(flag_bits, RegExpObject::Flags::Unicode);
+    flags.unicode_sets = has_flag(flag_bits, RegExpObject::Flags::UnicodeSets);
+    flags.sticky = has_flag(flag_bits, RegExpObject::Flags::Sticky);
+    flags.has_indices = has_flag(flag_bits, RegExpObject::Flags::HasIndices);
+    return flags;
+}
+
+regex::ECMAScriptCompileFlags RegExpObject::compile_flags() const
+{
+    return to_compile_flags(m_flag_bits);
+}
+
 RegExpObject::RegExpObject(Utf16String pattern, Utf16String flags, Object& prototype)
     : Object(ConstructWithPrototypeTag::Tag, prototype)
     , m_pattern(move(pattern))
@@ -398,33 +417,13 @@ ThrowCompletionOr<GC::Ref<RegExpObject>> RegExpObject::regexp_initialize(VM& vm,
     if (validated_flags_or_error.is_error())
         return vm.throw_completion<SyntaxError>(validated_flags_or_error.release_error());
     auto flag_bits = validated_flags_or_error.release_value();
-    bool unicode = has_flag(flag_bits, Flags::Unicode);
-    bool unicode_sets = has_flag(flag_bits, Flags::UnicodeSets);
-
-    auto parsed_pattern = String {};
-
-    // Convert UTF-16 pattern to UTF-8 (with escape normalization for non-ASCII).
-    if (!pattern.is_empty()) {
-        auto result = parse_regex_pattern(pattern, unicode, unicode_sets);
-        if (result.is_error())
-            return vm.throw_completion<SyntaxError>(ErrorType::RegExpCompileError, result.release_error().error);
-        parsed_pattern = result.release_value();
-    }
 
     // 11. If u is true and v is true, throw a SyntaxError exception.
     // NB: Already handled by validate_flags above.
 
-    // Validate by trial-compiling the pattern.
-    regex::ECMAScriptCompileFlags compile_flags {};
-    compile_flags.global = has_flag(flag_bits, Flags::Global);
-    compile_flags.ignore_case = has_flag(flag_bits, Flags::IgnoreCase);
-    compile_flags.multiline = has_flag(flag_bits, Flags::Multiline);
-    compile_flags.dot_all = has_flag(flag_bits, Flags::DotAll);
-    compile_flags.unicode = unicode;
-    compile_flags.unicode_sets = unicode_sets;
-    compile_flags.sticky = has_flag(flag_bits, Flags::Sticky);
-
-    auto compiled = regex::ECMAScriptRegex::compile(parsed_pattern.bytes_as_string_view(), compile_flags);
+    // NB: Steps 12-15 parse the pattern. We parse and compile it through the process-wide cache, so a pattern that was
+    //     seen before (by any realm) is neither parsed nor compiled again.
+    auto compiled = RegExpCache::the().get_or_compile(pattern, to_compile_flags(flag_bits));
     if (compiled.is_error())
         return vm.throw_completion<SyntaxError>(ErrorType::RegExpCompileError, compiled.release_error());
 
@@ -439,6 +438,7 @@ ThrowCompletionOr<GC::Ref<RegExpObject>> RegExpObject::regexp_initialize(VM& vm,
     // 19. Let rer be the RegExp Record { [[IgnoreCase]]: i, [[Multiline]]: m, [[DotAll]]: s, [[Unicode]]: u, [[CapturingGroupsCount]]: capturingGroupsCount }.
     // 20. Set obj.[[RegExpRecord]] to rer.
     // 21. Set obj.[[RegExpMatcher]] to CompilePattern of parseResult with argument rer.
+    m_cached_regex = compiled.release_value();
 
     // 22. Perform ? Set(obj, "lastIndex", +0𝔽, true).
     TRY(set(vm.names.lastIndex, Value(0), Object::ShouldThrowExceptions::Yes));
@@ -75,58 +75,18 @@ static ThrowCompletionOr<void> increment_last_index(VM& vm, Object& regexp_objec
     return {};
 }
 
-// FIXME: Add an eviction policy to bound the size of this cache.
-static HashMap<String, NonnullOwnPtr<regex::ECMAScriptRegex>> s_regex_cache;
-
 static regex::ECMAScriptRegex const* get_or_compile_regex(RegExpObject& regexp_object)
 {
     // Fast path: check the inline cache on the RegExpObject.
     if (auto* cached = regexp_object.cached_regex())
         return cached;
 
-    auto const& pattern = regexp_object.pattern();
-    auto flag_bits = regexp_object.flag_bits();
-
-    // Build a cache key from pattern + flag bits.
-    StringBuilder key_builder;
-    key_builder.append('/');
-    key_builder.append(pattern.utf16_view());
-    key_builder.append('/');
-    key_builder.append_code_point(static_cast<u8>(flag_bits));
-    auto cache_key = key_builder.to_string_without_validation();
-
-    if (auto it = s_regex_cache.find(cache_key); it != s_regex_cache.end()) {
-        auto* ptr = it->value.ptr();
-        regexp_object.set_cached_regex(ptr);
-        return ptr;
-    }
-
-    bool unicode = has_flag(flag_bits, RegExpObject::Flags::Unicode);
-    bool unicode_sets = has_flag(flag_bits, RegExpObject::Flags::UnicodeSets);
-
-    // Parse the pattern from UTF-16 source to UTF-8 with escape normalization.
-    auto parsed_pattern = parse_regex_pattern(pattern.utf16_view(), unicode, unicode_sets);
-    if (parsed_pattern.is_error())
-        return nullptr;
-
-    regex::ECMAScriptCompileFlags flags {};
-    flags.global = has_flag(flag_bits, RegExpObject::Flags::Global);
-    flags.ignore_case = has_flag(flag_bits, RegExpObject::Flags::IgnoreCase);
-    flags.multiline = has_flag(flag_bits, RegExpObject::Flags::Multiline);
-    flags.dot_all = has_flag(flag_bits, RegExpObject::Flags::DotAll);
-    flags.unicode = unicode;
-    flags.unicode_sets = unicode_sets;
-    flags.sticky = has_flag(flag_bits, RegExpObject::Flags::Sticky);
-    flags.has_indices = has_flag(flag_bits, RegExpObject::Flags::HasIndices);
-
-    auto compiled = regex::ECMAScriptRegex::compile(parsed_pattern.release_value(), flags);
+    auto compiled = RegExpCache::the().get_or_compile(regexp_object.pattern(), regexp_object.compile_flags());
     if (compiled.is_error())
         return nullptr;
 
-    auto owned = make<regex::ECMAScriptRegex>(compiled.release_value());
-    auto* ptr = owned.ptr();
-    s_regex_cache.set(cache_key, move(owned));
-    regexp_object.set_cached_regex(ptr);
+    auto* ptr = &compiled.value()->regex();
+    regexp_object.set_cached_regex(compiled.release_value());
     return ptr;
 }
 
@@ -261,7 +221,8 @@ static ThrowCompletionOr<Value> regexp_builtin_exec(VM& vm, RegExpObject& regexp
     array->put_direct(realm.intrinsics().regexp_builtin_exec_array_input_offset(), string);
 
     // Element 0: the full match substring.
-    auto match_str = Utf16String::from_utf16(utf16_view.substring_view(match_index, end_index - match_index));
+    auto utf16_string = string->utf16_string();
+    auto match_str = utf16_string.substring_with_shared_superstring(match_index, end_index - match_index);
     array->indexed_put(0, PrimitiveString::create(vm, match_str));
 
     bool has_groups = !named_groups.is_empty();
@@ -282,8 +243,7 @@ static ThrowCompletionOr<Value> regexp_builtin_exec(VM& vm, RegExpObject& regexp
         int cap_end = (i < total_groups) ? compiled_regex->capture_slot(i * 2 + 1) : -1;
 
         if (cap_start >= 0 && cap_end >= 0) {
-            auto cap_view = utf16_view.substring_view(cap_start, cap_end - cap_start);
-            auto cap_str = Utf16String::from_utf16(cap_view);
+            auto cap_str = utf16_string.substring_with_shared_superstring(cap_start, cap_end - cap_start);
             captured_value = PrimitiveString::create(vm, cap_str);
         } else {
             captured_value = js_undefined();
@@ -333,7 +293,7 @@ static ThrowCompletionOr<Value> regexp_builtin_exec(VM& vm, RegExpObject& regexp
             cap_starts[g] = (gi < total_groups) ? compiled_regex->capture_slot(gi * 2) : -1;
             cap_ends[g] = (gi < total_groups) ? compiled_regex->capture_slot(gi * 2 + 1) : -1;
         }
-        update_legacy_regexp_static_properties_lazy(realm.intrinsics().regexp_constructor(), string->utf16_string(), match_index, end_index, cap_count, cap_starts, cap_ends);
+        update_legacy_regexp_static_properties_lazy(realm.intrinsics().regexp_constructor(), utf16_string, match_index, end_index, cap_count, cap_starts, cap_ends);
     } else if (&realm == &regexp_object.realm()) {
         invalidate_legacy_regexp_static_properties(realm.intrinsics().regexp_constructor());
     }
@@ -1182,7 +1142,8 @@ ThrowCompletionOr<Value> RegExpPrototype::symbol_split_impl(VM& vm, Object& rege
                 if (limit == 0)
                     return array;
 
-                auto utf16_view = string->utf16_string_view();
+                auto utf16_string = string->utf16_string();
+                auto utf16_view = utf16_string.utf16_view();
                 auto size = utf16_view.length_in_code_units();
 
                 // Empty string case.
@@ -1237,7 +1198,7 @@ ThrowCompletionOr<Value> RegExpPrototype::symbol_split_impl(VM& vm, Object& rege
                     }
 
                     // Add substring before this match.
-                    auto substring = utf16_view.substring_view(last_match_end, next_search_from - last_match_end);
+                    auto substring = utf16_string.substring_with_shared_superstring(last_match_end, next_search_from - last_match_end);
                     array->indexed_put(array_length, PrimitiveString::create(vm, substring));
                     ++array_length;
                     if (array_length == limit)
@@ -1256,7 +1217,7 @@ ThrowCompletionOr<Value> RegExpPrototype::symbol_split_impl(VM& vm, Object& rege
                             cap_ends[g] = (gi < total_groups) ? compiled_regex->capture_slot(gi * 2 + 1) : -1;
                         }
                         update_legacy_regexp_static_properties_lazy(realm.intrinsics().regexp_constructor(),
-                            string->utf16_string(), match_start, match_end, cap_count, cap_starts, cap_ends);
+                            utf16_string, match_start, match_end, cap_count, cap_starts, cap_ends);
                     }
 
                     // Add captures.
@@ -1265,8 +1226,8 @@ ThrowCompletionOr<Value> RegExpPrototype::symbol_split_impl(VM& vm, Object& rege
                         int cap_end = (i < total_groups) ? compiled_regex->capture_slot(i * 2 + 1) : -1;
 
                         if (cap_start >= 0 && cap_end >= 0) {
-                            auto cap_view = utf16_view.substring_view(cap_start, cap_end - cap_start);
-                            array->indexed_put(array_length, PrimitiveString::create(vm, cap_view));
+                            auto cap_str = utf16_string.substring_with_shared_superstring(cap_start, cap_end - cap_start);
+                            array->indexed_put(array_length, PrimitiveString::create(vm, cap_str));
                         } else {
                             array->indexed_put(array_length, js_undefined());
                         }
@@ -1279,7 +1240,7 @@ ThrowCompletionOr<Value> RegExpPrototype::symbol_split_impl(VM& vm, Object& rege
                 }
 
                 // Add trailing substring.
-                auto trailing = utf16_view.substring_view(last_match_end);
+                auto trailing = utf16_string.substring_with_shared_superstring(last_match_end);
                 array->indexed_put(array_length, PrimitiveString::create(vm, trailing));
 
                 return array;
@@ -1379,7 +1340,7 @@ ThrowCompletionOr<Value> RegExpPrototype::symbol_split_impl(VM& vm, Object& rege
         // iv. Else,
 
         // 1. Let T be the substring of S from p to q.
-        auto substring = string->utf16_string_view().substring_view(last_match_end, next_search_from - last_match_end);
+        auto substring = string->utf16_string().substring_with_shared_superstring(last_match_end, next_search_from - last_match_end);
 
         // 2. Perform ! CreateDataPropertyOrThrow(A, ! ToString(𝔽(lengthA)), T).
         array->indexed_put(array_length, PrimitiveString::create(vm, substring));
@@ -1425,7 +1386,7 @@ ThrowCompletionOr<Value> RegExpPrototype::symbol_split_impl(VM& vm, Object& rege
     }
 
     // 20. Let T be the substring of S from p to size.
-    auto substring = string->utf16_string_view().substring_view(last_match_end);
+    auto substring = string->utf16_string().substring_with_shared_superstring(last_match_end);
 
     // 21. Perform ! CreateDataPropertyOrThrow(A, ! ToString(𝔽(lengthA)), T).
     array->indexed_put(array_length, PrimitiveString::create(vm, substring));
@@ -0,0 +1,246 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/JsonArray.h>
+#include <AK/JsonObject.h>
+#include <AK/StringBuilder.h>
+#include <LibCore/System.h>
+#include <LibJS/Bytecode/Executable.h>
+#include <LibJS/Runtime/ExecutionContext.h>
+#include <LibJS/Runtime/FunctionObject.h>
+#include <LibJS/Runtime/SamplingProfiler.h>
+#include <LibJS/Runtime/VM.h>
+#include <LibThreading/Thread.h>
+
+namespace JS {
+
+SamplingProfiler::SamplingProfiler(VM& vm)
+    : m_vm(vm)
+{
+}
+
+SamplingProfiler::~SamplingProfiler()
+{
+    stop();
+}
+
+void SamplingProfiler::start(AK::Duration sampling_interval)
+{
+    if (is_running())
+        return;
+
+    m_start_time = MonotonicTime::now();
+    m_should_stop.store(false);
+    m_pending_ticks.store(0);
+
+    auto interval_in_milliseconds = max<i64>(1, sampling_interval.to_milliseconds());
+    m_sampler_thread = Threading::Thread::construct("JS Profiler"sv, [this, interval_in_milliseconds] {
+        while (!m_should_stop.load()) {
+            (void)Core::System::sleep_ms(static_cast<u32>(interval_in_milliseconds));
+            m_pending_ticks.fetch_add(1, AK::MemoryOrder::memory_order_relaxed);
+            m_vm.request_profiler_sample();
+        }
+        return 0;
+    });
+    m_sampler_thread->start();
+}
+
+void SamplingProfiler::stop()
+{
+    if (!is_running())
+        return;
+
+    m_should_stop.store(true);
+    (void)m_sampler_thread->join();
+    m_sampler_thread = nullptr;
+}
+
+void SamplingProfiler::clear()
+{
+    m_frames.clear();
+    m_frame_indices.clear();
+    m_samples.clear();
+    m_oldest_sample_index = 0;
+}
+
+unsigned SamplingProfiler::FrameTraits::hash(Frame const& frame)
+{
+    auto hash = pair_int_hash(frame.function_name.hash(), frame.filename.hash());
+    return pair_int_hash(hash, pair_int_hash(frame.line, frame.column));
+}
+
+String SamplingProfiler::Frame::to_string() const
+{
+    auto name = function_name.is_empty() ? "(anonymous)"_string : function_name.to_utf8();
+    if (filename.is_empty() && line == 0)
+        return name;
+    return MUST(String::formatted("{} ({}:{}:{})", name, filename, line, column));
+}
+
+u32 SamplingProfiler::intern_frame(Frame&& frame)
+{
+    if (auto index = m_frame_indices.get(frame); index.has_value())
+        return *index;
+
+    auto index = static_cast<u32>(m_frames.size());
+    m_frame_indices.set(frame, index);
+    m_frames.append(move(frame));
+    return index;
+}
+
+static bool is_running_javascript(Vector<ExecutionContext*> const& execution_context_stack)
+{
+    for (ssize_t i = execution_context_stack.size() - 1; i >= 0; --i) {
+        if (execution_context_stack[i]->executable)
+            return true;
+    }
+    return false;
+}
+
+void SamplingProfiler::take_sample(Badge<VM>)
+{
+    // NB: A tick that came in after the previous request was taken may already have been counted by that sample.
+    auto weight = m_pending_ticks.exchange(0, AK::MemoryOrder::memory_order_relaxed);
+    if (weight == 0)
+        return;
+
+    // NB: The sampler thread keeps ticking while the VM is idle, e.g. between event loop tasks. Those ticks are dropped
+    //     here, at the safe point reached when execution starts again, before any JavaScript frame is on the stack.
+    //     Otherwise they would be charged to whatever code happens to run next.
+    auto const& execution_context_stack = m_vm.execution_context_stack();
+    if (!is_running_javascript(execution_context_stack))
+        return;
+
+    auto first_context_index = execution_context_stack.size() > maximum_stack_depth ? execution_context_stack.size() - maximum_stack_depth : 0;
+
+    Sample sample { .timestamp = MonotonicTime::now(), .weight = weight, .frames = {} };
+    sample.frames.ensure_capacity(execution_context_stack.size() - first_context_index);
+
+    for (size_t i = first_context_index; i < execution_context_stack.size(); ++i) {
+        auto const& context = *execution_context_stack[i];
+
+        Frame frame;
+        if (context.function)
+            frame.function_name = context.function->name_for_call_stack();
+        else if (context.executable)
+            frame.function_name = "(program)"_utf16;
+
+        if (context.executable) {
+            auto const& source_range = context.executable->get_source_range(context.program_counter);
+            frame.filename = source_range.code->filename();
+            frame.line = source_range.start.line;
+            frame.column = source_range.start.column;
+        }
+
+        sample.frames.unchecked_append(intern_frame(move(frame)));
+    }
+
+    if (m_samples.size() < maximum_sample_count) {
+        m_samples.append(move(sample));
+        return;
+    }
+
+    m_samples[m_oldest_sample_index] = move(sample);
+    m_oldest_sample_index = (m_oldest_sample_index + 1) % maximum_sample_count;
+}
+
+template<typename Callback>
+void SamplingProfiler::for_each_sample_in_order(Callback callback) const
+{
+    for (size_t i = 0; i < m_samples.size(); ++i)
+        callback(m_samples[(m_oldest_sample_index + i) % m_samples.size()]);
+}
+
+String SamplingProfiler::to_collapsed_stacks() const
+{
+    Vector<String> frame_names;
+    frame_names.ensure_capacity(m_frames.size());
+    for (auto const& frame : m_frames) {
+        // NB: Semicolons separate frames in this format, so they can't appear in frame names.
+        frame_names.unchecked_append(MUST(frame.to_string().replace(";"sv, ","sv, ReplaceMode::All)));
+    }
+
+    OrderedHashMap<String, size_t> sample_weights_by_stack;
+    for_each_sample_in_order([&](Sample const& sample) {
+        if (sample.frames.is_empty())
+            return;
+        StringBuilder stack_builder;
+        for (size_t i = 0; i < sample.frames.size(); ++i) {
+            if (i != 0)
+                stack_builder.append(';');
+            stack_builder.append(frame_names[sample.frames[i]]);
+        }
+        sample_weights_by_stack.ensure(MUST(stack_builder.to_string()), [] { return 0; }) += sample.weight;
+    });
+
+    StringBuilder builder;
+    for (auto const& [stack, weight] : sample_weights_by_stack)
+        builder.appendff("{} {}\n", stack, weight);
+    return MUST(builder.to_string());
+}
+
+String SamplingProfiler::to_chrome_trace() const
+{
+    static constexpr auto thread_id = 1;
+    auto process_id = Core::System::getpid();
+
+    // Chrome trace stack frames form a tree, so each distinct (parent, frame) pair becomes its own node.
+    JsonObject stack_frames;
+    HashMap<u64, u32> stack_frame_nodes;
+    u32 next_node = 0;
+    auto node_for = [&](Optional<u32> parent_node, u32 frame_index) {
+        auto key = (static_cast<u64>(parent_node.value_or(NumericLimits<u32>::max())) << 32) | frame_index;
+        return stack_frame_nodes.ensure(key, [&] {
+            auto node = next_node++;
+            JsonObject stack_frame;
+            stack_frame.set("category"sv, "js"sv);
+            stack_frame.set("name"sv, m_frames[frame_index].to_string());
+            if (parent_node.has_value())
+                stack_frame.set("parent"sv, String::number(*parent_node));
+            stack_frames.set(String::number(node), move(stack_frame));
+            return node;
+        });
+    };
+
+    JsonArray samples;
+    for_each_sample_in_order([&](Sample const& sample) {
+        if (sample.frames.is_empty())
+            return;
+        Optional<u32> node;
+        for (auto frame_index : sample.frames)
+            node = node_for(node, frame_index);
+
+        JsonObject trace_sample;
+        trace_sample.set("cat"sv, "js"sv);
+        trace_sample.set("name"sv, "sample"sv);
+        trace_sample.set("ph"sv, "P"sv);
+        trace_sample.set("pid"sv, process_id);
+        trace_sample.set("tid"sv, thread_id);
+        trace_sample.set("ts"sv, (sample.timestamp - m_start_time).to_microseconds());
+        trace_sample.set("sf"sv, String::number(*node));
+        trace_sample.set("weight"sv, sample.weight);
+        samples.must_append(move(trace_sample));
+    });
+
+    JsonObject thread_name_arguments;
+    thread_name_arguments.set("name"sv, "JavaScript"sv);
+    JsonObject thread_name;
+    thread_name.set("ph"sv, "M"sv);
+    thread_name.set("name"sv, "thread_name"sv);
+    thread_name.set("pid"sv, process_id);
+    thread_name.set("tid"sv, thread_id);
+    thread_name.set("args"sv, move(thread_name_arguments));
+    JsonArray trace_events;
+    trace_events.must_append(move(thread_name));
+
+    JsonObject trace;
+    trace.set("traceEvents"sv, move(trace_events));
+    trace.set("stackFrames"sv, move(stack_frames));
+    trace.set("samples"sv, move(samples));
+    return trace.serialized();
+}
+
+}
@@ -0,0 +1,106 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/Atomic.h>
+#include <AK/Badge.h>
+#include <AK/HashMap.h>
+#include <AK/Noncopyable.h>
+#include <AK/RefPtr.h>
+#include <AK/String.h>
+#include <AK/Time.h>
+#include <AK/Utf16String.h>
+#include <AK/Vector.h>
+#include <LibJS/Export.h>
+#include <LibJS/Forward.h>
+#include <LibThreading/Forward.h>
+
+namespace JS {
+
+// A sampling profiler for JavaScript execution.
+//
+// While the profiler is running, a helper thread periodically asks the VM for a sample. The VM takes it on its own
+// thread at the next safe point (when a function is entered or a loop jumps back), by walking the execution context
+// stack and mapping each frame's program counter to a source position through its executable's source map.
+//
+// If the VM doesn't reach a safe point before the next timer tick (e.g. while it's in a long-running native call),
+// the ticks are coalesced into one sample. Each sample remembers how many ticks it stands for, and that count is
+// its weight in the exported profiles. Ticks that elapse while no JavaScript is on the stack are dropped.
+class JS_API SamplingProfiler {
+    AK_MAKE_NONCOPYABLE(SamplingProfiler);
+    AK_MAKE_NONMOVABLE(SamplingProfiler);
+
+public:
+    static constexpr AK::Duration default_sampling_interval = AK::Duration::from_milliseconds(1);
+
+    // Once this many samples have been taken, the oldest ones are overwritten.
+    static constexpr size_t maximum_sample_count = 256 * 1024;
+
+    // Only the innermost frames of deeper stacks are recorded.
+    static constexpr size_t maximum_stack_depth = 256;
+
+    explicit SamplingProfiler(VM&);
+    ~SamplingProfiler();
+
+    void start(AK::Duration sampling_interval = default_sampling_interval);
+    void stop();
+    bool is_running() const { return m_sampler_thread; }
+
+    void take_sample(Badge<VM>);
+
+    size_t sample_count() const { return m_samples.size(); }
+    void clear();
+
+    // One line per distinct stack, outermost frame first and frames separated by semicolons, followed by the total
+    // weight of its samples. This is the format consumed by flamegraph.pl, speedscope and similar tools.
+    String to_collapsed_stacks() const;
+
+    // The Chrome trace event format with stack frames and samples, as consumed by Perfetto and chrome://tracing.
+    String to_chrome_trace() const;
+
+private:
+    struct Frame {
+        Utf16String function_name;
+        String filename;
+        size_t line { 0 };
+        size_t column { 0 };
+
+        bool operator==(Frame const&) const = default;
+        String to_string() const;
+    };
+
+    struct FrameTraits : public DefaultTraits<Frame> {
+        static unsigned hash(Frame const&);
+    };
+
+    struct Sample {
+        MonotonicTime timestamp;
+        u32 weight { 1 };   // The number of timer ticks this sample stands for.
+        Vector<u32> frames; // Indices into m_frames, outermost frame first.
+    };
+
+    u32 intern_frame(Frame&&);
+
+    template<typename Callback>
+    void for_each_sample_in_order(Callback) const;
+
+    VM& m_vm;
+
+    Vector<Frame> m_frames;
+    HashMap<Frame, u32, FrameTraits> m_frame_indices;
+
+    Vector<Sample> m_samples;
+    size_t m_oldest_sample_index { 0 };
+
+    MonotonicTime m_start_time { MonotonicTime::now() };
+
+    RefPtr<Threading::Thread> m_sampler_thread;
+    Atomic<bool> m_should_stop { false };
+    Atomic<u32> m_pending_ticks { 0 };
+};
+
+}
@@ -5,6 +5,7 @@
  */
 
 #include <LibJS/Runtime/SharedFunctionInstanceData.h>
+#include <LibJS/Runtime/VM.h>
 #include <LibJS/RustIntegration.h>
 
 namespace JS {
@@ -55,6 +56,13 @@ SharedFunctionInstanceData::~SharedFunctionInstanceData() = default;
 void SharedFunctionInstanceData::finalize()
 {
     Base::finalize();
+    if (m_rust_function_ast) {
+        auto& statistics = VM::the().lazy_compilation_statistics();
+        --statistics.functions_awaiting_compilation;
+        statistics.source_code_units_awaiting_compilation -= m_source_length_awaiting_compilation;
+        ++statistics.functions_never_compiled;
+        statistics.source_code_units_never_compiled += m_source_length_awaiting_compilation;
+    }
     RustIntegration::free_function_ast(m_rust_function_ast);
     m_rust_function_ast = nullptr;
 }
@@ -132,11 +132,17 @@ public:
     ConstructorKind m_constructor_kind : 1 { ConstructorKind::Base };        // [[ConstructorKind]]
     bool m_is_class_constructor : 1 { false };                               // [[IsClassConstructor]]
 
-    // NB: When non-null, points to a Rust Box<FunctionData> used for
-    //     lazy compilation through the Rust pipeline.
+    // NB: When non-null, points to a Rust Box<FunctionPayload> used for
+    //     lazy compilation through the Rust pipeline. For function declarations
+    //     and expressions, this is only what's needed to parse the function again
+    //     from m_source_code, not its AST.
     void* m_rust_function_ast { nullptr };
     bool m_use_rust_compilation { false };
 
+    // NB: The length of the source text that was accounted for in VM::LazyCompilationStatistics while
+    //     m_rust_function_ast is pending compilation.
+    u32 m_source_length_awaiting_compilation { 0 };
+
     void clear_compile_inputs();
 
 private:
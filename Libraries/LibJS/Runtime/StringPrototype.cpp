@@ -624,7 +624,7 @@ JS_DEFINE_NATIVE_FUNCTION(StringPrototype::locale_compare)
     auto options = vm.argument(2);
 
     // OPTIMIZATION: If both locales and options are undefined, we can use a cached default-constructed Collator.
-    GC::Ptr<Object> collator;
+    GC::Ptr<Intl::Collator> collator;
     if (locales.is_undefined() && options.is_undefined()) {
         // OPTIMIZATION: Identical strings are equal with the default options.
         if (string == that_value)
@@ -636,11 +636,14 @@ JS_DEFINE_NATIVE_FUNCTION(StringPrototype::locale_compare)
         }
         collator = realm.intrinsics().default_collator();
     } else {
-        collator = TRY(construct(vm, realm.intrinsics().intl_collator_constructor(), locales, options));
+        // OPTIMIZATION: The Collator is not observable by script, so we reuse one from the realm's formatter cache if we can.
+        collator = TRY(realm.intl_formatter_cache().ensure<Intl::Collator>(Intl::FormatterCache::Type::Collator, locales, options, [&] {
+            return construct(vm, realm.intrinsics().intl_collator_constructor(), locales, options);
+        }));
     }
 
     // 5. Return CompareStrings(collator, S, thatValue).
-    return Intl::compare_strings(static_cast<Intl::Collator const&>(*collator), string, that_value);
+    return Intl::compare_strings(*collator, string, that_value);
 }
 
 // 22.1.3.13 String.prototype.match ( regexp ), https://tc39.es/ecma262/#sec-string.prototype.match
@@ -1147,7 +1150,7 @@ JS_DEFINE_NATIVE_FUNCTION(StringPrototype::slice)
         return PrimitiveString::create(vm, String {});
 
     // 13. Return the substring of S from from to to.
-    return PrimitiveString::create(vm, string->utf16_string_view().substring_view(int_start, int_end - int_start));
+    return PrimitiveString::create(vm, string->utf16_string().substring_with_shared_superstring(int_start, int_end - int_start));
 }
 
 // 22.1.3.23 String.prototype.split ( separator, limit ), https://tc39.es/ecma262/#sec-string.prototype.split
@@ -1232,7 +1235,7 @@ JS_DEFINE_NATIVE_FUNCTION(StringPrototype::split)
             ++position;
             continue;
         }
-        auto segment = string->utf16_string_view().substring_view(start, position - start);
+        auto segment = string->utf16_string().substring_with_shared_superstring(start, position - start);
 
         // b. Append T to substrings.
         MUST(array->create_data_property_or_throw(array_length, PrimitiveString::create(vm, segment)));
@@ -1250,7 +1253,7 @@ JS_DEFINE_NATIVE_FUNCTION(StringPrototype::split)
     }
 
     // 15. Let T be the substring of S from i.
-    auto rest = string->utf16_string_view().substring_view(start);
+    auto rest = string->utf16_string().substring_with_shared_superstring(start);
 
     // 16. Append T to substrings.
     MUST(array->create_data_property_or_throw(array_length, PrimitiveString::create(vm, rest)));
@@ -1345,7 +1348,7 @@ JS_DEFINE_NATIVE_FUNCTION(StringPrototype::substring)
     size_t to = max(final_start, final_end);
 
     // 10. Return the substring of S from from to to.
-    return PrimitiveString::create(vm, string->utf16_string_view().substring_view(from, to - from));
+    return PrimitiveString::create(vm, string->utf16_string().substring_with_shared_superstring(from, to - from));
 }
 
 enum class TargetCase {
@@ -1588,7 +1591,7 @@ JS_DEFINE_NATIVE_FUNCTION(StringPrototype::substr)
         return PrimitiveString::create(vm, String {});
 
     // 11. Return the substring of S from intStart to intEnd.
-    return PrimitiveString::create(vm, string->utf16_string_view().substring_view(int_start, int_end - int_start));
+    return PrimitiveString::create(vm, string->utf16_string().substring_with_shared_superstring(int_start, int_end - int_start));
 }
 
 // B.2.2.2.1 CreateHTML ( string, tag, attribute, value ), https://tc39.es/ecma262/#sec-createhtml
@@ -0,0 +1,486 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/ScopeGuard.h>
+#include <AK/Span.h>
+#include <AK/Vector.h>
+#include <LibJS/Runtime/Completion.h>
+
+namespace JS {
+
+// A stable, adaptive merge sort after Tim Peters' listsort.txt. It finds runs that are already in order (reversing
+// strictly descending ones), extends short runs with a binary insertion sort, and merges runs with galloping so that
+// partially sorted input needs far fewer comparisons than a plain merge sort.
+//
+// The less-than predicate returns a ThrowCompletionOr<bool>, as it may call into user code. If it fails, sorting stops
+// and the error is returned. The elements are then left in an unspecified order, but each of them is still present
+// exactly once. The scratch buffer is caller-provided so that it can be rooted when sorting GC-managed values.
+template<typename T, typename Buffer, typename LessThan>
+class TimSort {
+public:
+    TimSort(Span<T> elements, Buffer& buffer, LessThan& less_than)
+        : m_elements(elements)
+        , m_buffer(buffer)
+        , m_less_than(less_than)
+    {
+    }
+
+    ThrowCompletionOr<void> sort()
+    {
+        auto remaining = m_elements.size();
+        if (remaining < 2)
+            return {};
+
+        auto minimum_run_length = compute_minimum_run_length(remaining);
+        size_t low = 0;
+
+        while (remaining > 0) {
+            auto run_length = TRY(count_run_and_make_ascending(low, low + remaining));
+
+            // Extend short runs to the minimum run length.
+            if (run_length < minimum_run_length) {
+                auto forced_length = min(remaining, minimum_run_length);
+                TRY(binary_insertion_sort(low, low + forced_length, low + run_length));
+                run_length = forced_length;
+            }
+
+            m_runs.append({ low, run_length });
+            TRY(merge_collapse());
+
+            low += run_length;
+            remaining -= run_length;
+        }
+
+        return merge_force_collapse();
+    }
+
+private:
+    static constexpr size_t initial_minimum_gallop = 7;
+
+    struct Run {
+        size_t base { 0 };
+        size_t length { 0 };
+    };
+
+    static size_t compute_minimum_run_length(size_t length)
+    {
+        size_t low_bits = 0;
+        while (length >= 64) {
+            low_bits |= length & 1;
+            length >>= 1;
+        }
+        return length + low_bits;
+    }
+
+    // Copies count elements from source to destination, which may overlap as long as destination comes first.
+    static void copy_forward(T* destination, T const* source, size_t count)
+    {
+        for (size_t i = 0; i < count; ++i)
+            destination[i] = source[i];
+    }
+
+    // Copies count elements from source to destination, which may overlap as long as source comes first.
+    static void copy_backward(T* destination, T const* source, size_t count)
+    {
+        for (size_t i = count; i > 0; --i)
+            destination[i - 1] = source[i - 1];
+    }
+
+    T* buffer_with_capacity(size_t capacity)
+    {
+        if (m_buffer.size() < capacity)
+            m_buffer.resize(capacity);
+        return m_buffer.data();
+    }
+
+    // Returns the length of the run starting at low, reversing it first if it is strictly descending.
+    ThrowCompletionOr<size_t> count_run_and_make_ascending(size_t low, size_t high)
+    {
+        auto run_high = low + 1;
+        if (run_high == high)
+            return 1;
+
+        if (TRY(m_less_than(m_elements[run_high++], m_elements[low]))) {
+            while (run_high < high && TRY(m_less_than(m_elements[run_high], m_elements[run_high - 1])))
+                ++run_high;
+            m_elements.slice(low, run_high - low).reverse();
+        } else {
+            while (run_high < high && !TRY(m_less_than(m_elements[run_high], m_elements[run_high - 1])))
+                ++run_high;
+        }
+
+        return run_high - low;
+    }
+
+    // Sorts [low, high), of which [low, start) is already sorted.
+    ThrowCompletionOr<void> binary_insertion_sort(size_t low, size_t high, size_t start)
+    {
+        for (; start < high; ++start) {
+            auto pivot = m_elements[start];
+
+            size_t left = low;
+            size_t right = start;
+            while (left < right) {
+                auto middle = left + (right - left) / 2;
+                if (TRY(m_less_than(pivot, m_elements[middle])))
+                    right = middle;
+                else
+                    left = middle + 1;
+            }
+
+            copy_backward(m_elements.data() + left + 1, m_elements.data() + left, start - left);
+            m_elements[left] = pivot;
+        }
+        return {};
+    }
+
+    // Returns the leftmost position at which key could be inserted into the sorted range [elements, elements + length),
+    // starting the search at hint.
+    ThrowCompletionOr<size_t> gallop_left(T const& key, T const* elements, size_t length, size_t hint)
+    {
+        ssize_t last_offset = 0;
+        ssize_t offset = 1;
+        auto signed_hint = static_cast<ssize_t>(hint);
+
+        if (TRY(m_less_than(elements[hint], key))) {
+            // Gallop right until elements[hint + last_offset] < key <= elements[hint + offset].
+            auto max_offset = static_cast<ssize_t>(length - hint);
+            while (offset < max_offset && TRY(m_less_than(elements[signed_hint + offset], key))) {
+                last_offset = offset;
+                offset = (offset << 1) + 1;
+            }
+            offset = min(offset, max_offset);
+            last_offset += signed_hint;
+            offset += signed_hint;
+        } else {
+            // Gallop left until elements[hint - offset] < key <= elements[hint - last_offset].
+            auto max_offset = signed_hint + 1;
+            while (offset < max_offset && !TRY(m_less_than(elements[signed_hint - offset], key))) {
+                last_offset = offset;
+                offset = (offset << 1) + 1;
+            }
+            offset = min(offset, max_offset);
+            auto previous_last_offset = last_offset;
+            last_offset = signed_hint - offset;
+            offset = signed_hint - previous_last_offset;
+        }
+
+        // Now elements[last_offset] < key <= elements[offset], so binary search the range in between.
+        ++last_offset;
+        while (last_offset < offset) {
+            auto middle = last_offset + (offset - last_offset) / 2;
+            if (TRY(m_less_than(elements[middle], key)))
+                last_offset = middle + 1;
+            else
+                offset = middle;
+        }
+        return static_cast<size_t>(offset);
+    }
+
+    // Like gallop_left, but returns the rightmost position, so that key is placed after any elements equal to it.
+    ThrowCompletionOr<size_t> gallop_right(T const& key, T const* elements, size_t length, size_t hint)
+    {
+        ssize_t last_offset = 0;
+        ssize_t offset = 1;
+        auto signed_hint = static_cast<ssize_t>(hint);
+
+        if (TRY(m_less_than(key, elements[hint]))) {
+            // Gallop left until elements[hint - offset] <= key < elements[hint - last_offset].
+            auto max_offset = signed_hint + 1;
+            while (offset < max_offset && TRY(m_less_than(key, elements[signed_hint - offset]))) {
+                last_offset = offset;
+                offset = (offset << 1) + 1;
+            }
+            offset = min(offset, max_offset);
+            auto previous_last_offset = last_offset;
+            last_offset = signed_hint - offset;
+            offset = signed_hint - previous_last_offset;
+        } else {
+            // Gallop right until elements[hint + last_offset] <= key < elements[hint + offset].
+            auto max_offset = static_cast<ssize_t>(length - hint);
+            while (offset < max_offset && !TRY(m_less_than(key, elements[signed_hint + offset]))) {
+                last_offset = offset;
+                offset = (offset << 1) + 1;
+            }
+            offset = min(offset, max_offset);
+            last_offset += signed_hint;
+            offset += signed_hint;
+        }
+
+        // Now elements[last_offset] <= key < elements[offset], so binary search the range in between.
+        ++last_offset;
+        while (last_offset < offset) {
+            auto middle = last_offset + (offset - last_offset) / 2;
+            if (TRY(m_less_than(key, elements[middle])))
+                offset = middle;
+            else
+                last_offset = middle + 1;
+        }
+        return static_cast<size_t>(offset);
+    }
+
+    // Merges runs until the run lengths on the stack satisfy the TimSort invariants, which keep merges balanced.
+    ThrowCompletionOr<void> merge_collapse()
+    {
+        while (m_runs.size() > 1) {
+            auto n = m_runs.size() - 2;
+            if ((n > 0 && m_runs[n - 1].length <= m_runs[n].length + m_runs[n + 1].length)
+                || (n > 1 && m_runs[n - 2].length <= m_runs[n - 1].length + m_runs[n].length)) {
+                if (m_runs[n - 1].length < m_runs[n + 1].length)
+                    --n;
+            } else if (m_runs[n].length > m_runs[n + 1].length) {
+                break;
+            }
+            TRY(merge_at(n));
+        }
+        return {};
+    }
+
+    ThrowCompletionOr<void> merge_force_collapse()
+    {
+        while (m_runs.size() > 1) {
+            auto n = m_runs.size() - 2;
+            if (n > 0 && m_runs[n - 1].length < m_runs[n + 1].length)
+                --n;
+            TRY(merge_at(n));
+        }
+        return {};
+    }
+
+    // Merges the runs at stack indices i and i + 1.
+    ThrowCompletionOr<void> merge_at(size_t i)
+    {
+        auto [base1, length1] = m_runs[i];
+        auto [base2, length2] = m_runs[i + 1];
+
+        m_runs[i].length = length1 + length2;
+        m_runs.remove(i + 1);
+
+        // Elements of the first run that are not greater than the second run's first element are already in place.
+        auto skipped = TRY(gallop_right(m_elements[base2], m_elements.data() + base1, length1, 0));
+        base1 += skipped;
+        length1 -= skipped;
+        if (length1 == 0)
+            return {};
+
+        // Elements of the second run that are not less than the first run's last element are already in place.
+        length2 = TRY(gallop_left(m_elements[base1 + length1 - 1], m_elements.data() + base2, length2, length2 - 1));
+        if (length2 == 0)
+            return {};
+
+        if (length1 <= length2)
+            return merge_low(base1, length1, base2, length2);
+        return merge_high(base1, length1, base2, length2);
+    }
+
+    // Merges two adjacent runs by moving the (shorter) first run into the buffer and merging from the left.
+    ThrowCompletionOr<void> merge_low(size_t base1, size_t length1, size_t base2, size_t length2)
+    {
+        auto* elements = m_elements.data();
+        auto* buffer = buffer_with_capacity(length1);
+        copy_forward(buffer, elements + base1, length1);
+
+        size_t cursor1 = 0;
+        size_t cursor2 = base2;
+        size_t destination = base1;
+
+        // Whatever remains of the first run fills the gap left between the merged elements and the second run. This
+        // also restores every element to the array if the comparison fails.
+        ScopeGuard move_remaining_elements_back = [&] {
+            copy_forward(elements + destination, buffer + cursor1, length1);
+        };
+
+        elements[destination++] = elements[cursor2++];
+        if (--length2 == 0)
+            return {};
+
+        auto minimum_gallop = m_minimum_gallop;
+        while (length1 > 1 && length2 > 0) {
+            size_t count1 = 0;
+            size_t count2 = 0;
+
+            // Merge one element at a time until one run consistently wins.
+            do {
+                if (TRY(m_less_than(elements[cursor2], buffer[cursor1]))) {
+                    elements[destination++] = elements[cursor2++];
+                    ++count2;
+                    count1 = 0;
+                    if (--length2 == 0)
+                        break;
+                } else {
+                    elements[destination++] = buffer[cursor1++];
+                    ++count1;
+                    count2 = 0;
+                    if (--length1 == 1)
+                        break;
+                }
+            } while ((count1 | count2) < minimum_gallop);
+            if (length1 <= 1 || length2 == 0)
+                break;
+
+            // Then gallop, moving whole stretches at once, for as long as that keeps paying off.
+            do {
+                count1 = TRY(gallop_right(elements[cursor2], buffer + cursor1, length1, 0));
+                if (count1 != 0) {
+                    copy_forward(elements + destination, buffer + cursor1, count1);
+                    destination += count1;
+                    cursor1 += count1;
+                    length1 -= count1;
+                    if (length1 <= 1)
+                        break;
+                }
+                elements[destination++] = elements[cursor2++];
+                if (--length2 == 0)
+                    break;
+
+                count2 = TRY(gallop_left(buffer[cursor1], elements + cursor2, length2, 0));
+                if (count2 != 0) {
+                    copy_forward(elements + destination, elements + cursor2, count2);
+                    destination += count2;
+                    cursor2 += count2;
+                    length2 -= count2;
+                    if (length2 == 0)
+                        break;
+                }
+                elements[destination++] = buffer[cursor1++];
+                if (--length1 == 1)
+                    break;
+
+                if (minimum_gallop > 0)
+                    --minimum_gallop;
+            } while (count1 >= initial_minimum_gallop || count2 >= initial_minimum_gallop);
+            if (length1 <= 1 || length2 == 0)
+                break;
+
+            minimum_gallop += 2;
+        }
+        m_minimum_gallop = max<size_t>(minimum_gallop, 1);
+
+        // If only one element of the first run is left, it belongs after everything that remains of the second run.
+        if (length1 == 1 && length2 > 0) {
+            copy_forward(elements + destination, elements + cursor2, length2);
+            elements[destination + length2] = buffer[cursor1];
+            length1 = 0;
+        }
+
+        // NB: With an inconsistent comparator, the first run may also have run out, in which case nothing is left to do.
+        return {};
+    }
+
+    // Merges two adjacent runs by moving the (shorter) second run into the buffer and merging from the right.
+    ThrowCompletionOr<void> merge_high(size_t base1, size_t length1, size_t base2, size_t length2)
+    {
+        auto* elements = m_elements.data();
+        auto* buffer = buffer_with_capacity(length2);
+        copy_forward(buffer, elements + base2, length2);
+
+        // NB: These are signed, as the cursor into the first run ends up before its base once the run is exhausted.
+        auto cursor1 = static_cast<ssize_t>(base1 + length1) - 1;
+        auto cursor2 = static_cast<ssize_t>(length2) - 1;
+        auto destination = static_cast<ssize_t>(base2 + length2) - 1;
+
+        // Whatever remains of the second run fills the gap left between the first run and the merged elements. This
+        // also restores every element to the array if the comparison fails.
+        ScopeGuard move_remaining_elements_back = [&] {
+            copy_forward(elements + destination - length2 + 1, buffer, length2);
+        };
+
+        elements[destination--] = elements[cursor1--];
+        if (--length1 == 0)
+            return {};
+
+        auto minimum_gallop = m_minimum_gallop;
+        while (length2 > 1 && length1 > 0) {
+            size_t count1 = 0;
+            size_t count2 = 0;
+
+            // Merge one element at a time until one run consistently wins.
+            do {
+                if (TRY(m_less_than(buffer[cursor2], elements[cursor1]))) {
+                    elements[destination--] = elements[cursor1--];
+                    ++count1;
+                    count2 = 0;
+                    if (--length1 == 0)
+                        break;
+                } else {
+                    elements[destination--] = buffer[cursor2--];
+                    ++count2;
+                    count1 = 0;
+                    if (--length2 == 1)
+                        break;
+                }
+            } while ((count1 | count2) < minimum_gallop);
+            if (length2 <= 1 || length1 == 0)
+                break;
+
+            // Then gallop, moving whole stretches at once, for as long as that keeps paying off.
+            do {
+                count1 = length1 - TRY(gallop_right(buffer[cursor2], elements + base1, length1, length1 - 1));
+                if (count1 != 0) {
+                    destination -= count1;
+                    cursor1 -= count1;
+                    length1 -= count1;
+                    copy_backward(elements + destination + 1, elements + cursor1 + 1, count1);
+                    if (length1 == 0)
+                        break;
+                }
+                elements[destination--] = buffer[cursor2--];
+                if (--length2 == 1)
+                    break;
+
+                count2 = length2 - TRY(gallop_left(elements[cursor1], buffer, length2, length2 - 1));
+                if (count2 != 0) {
+                    destination -= count2;
+                    cursor2 -= count2;
+                    length2 -= count2;
+                    copy_forward(elements + destination + 1, buffer + cursor2 + 1, count2);
+                    if (length2 <= 1)
+                        break;
+                }
+                elements[destination--] = elements[cursor1--];
+                if (--length1 == 0)
+                    break;
+
+                if (minimum_gallop > 0)
+                    --minimum_gallop;
+            } while (count1 >= initial_minimum_gallop || count2 >= initial_minimum_gallop);
+            if (length2 <= 1 || length1 == 0)
+                break;
+
+            minimum_gallop += 2;
+        }
+        m_minimum_gallop = max<size_t>(minimum_gallop, 1);
+
+        // If only one element of the second run is left, it belongs before everything that remains of the first run.
+        if (length2 == 1 && length1 > 0) {
+            destination -= length1;
+            cursor1 -= length1;
+            copy_backward(elements + destination + 1, elements + cursor1 + 1, length1);
+            elements[destination] = buffer[0];
+            length2 = 0;
+        }
+
+        // NB: With an inconsistent comparator, the second run may also have run out, in which case nothing is left to do.
+        return {};
+    }
+
+    Span<T> m_elements;
+    Buffer& m_buffer;
+    LessThan& m_less_than;
+
+    Vector<Run, 85> m_runs;
+    size_t m_minimum_gallop { initial_minimum_gallop };
+};
+
+template<typename T, typename Buffer, typename LessThan>
+ThrowCompletionOr<void> tim_sort(Span<T> elements, Buffer& buffer, LessThan less_than)
+{
+    return TimSort<T, Buffer, LessThan> { elements, buffer, less_than }.sort();
+}
+
+}
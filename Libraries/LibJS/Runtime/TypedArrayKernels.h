@@ -0,0 +1,253 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/BitCast.h>
+#include <AK/Optional.h>
+#include <AK/SIMD.h>
+#include <AK/SIMDExtras.h>
+#include <AK/StdLibExtras.h>
+#include <AK/Types.h>
+
+// See the note in AK/SIMDExtras.h, the vector functions below are never visible outside of the including translation unit.
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wpsabi"
+
+namespace JS {
+
+// Element-wise kernels for the TypedArray builtins. They work directly on the elements of an attached, non-shared,
+// fixed-length buffer (see TypedArrayBase::cached_data_ptr()), processing 16 bytes at a time where the element type
+// has a matching SIMD vector, and one element at a time for the remainder and for Float16.
+
+namespace Detail {
+
+template<typename T>
+struct TypedArrayVector {
+    using Type = void;
+};
+
+#define JS_DEFINE_TYPED_ARRAY_VECTOR(ElementType, VectorType) \
+    template<>                                                \
+    struct TypedArrayVector<ElementType> {                    \
+        using Type = AK::SIMD::VectorType;                    \
+    };
+
+JS_DEFINE_TYPED_ARRAY_VECTOR(u8, u8x16)
+JS_DEFINE_TYPED_ARRAY_VECTOR(i8, i8x16)
+JS_DEFINE_TYPED_ARRAY_VECTOR(u16, u16x8)
+JS_DEFINE_TYPED_ARRAY_VECTOR(i16, i16x8)
+JS_DEFINE_TYPED_ARRAY_VECTOR(u32, u32x4)
+JS_DEFINE_TYPED_ARRAY_VECTOR(i32, i32x4)
+JS_DEFINE_TYPED_ARRAY_VECTOR(u64, u64x2)
+JS_DEFINE_TYPED_ARRAY_VECTOR(i64, i64x2)
+JS_DEFINE_TYPED_ARRAY_VECTOR(float, f32x4)
+JS_DEFINE_TYPED_ARRAY_VECTOR(double, f64x2)
+
+#undef JS_DEFINE_TYPED_ARRAY_VECTOR
+
+template<typename T>
+using TypedArrayVectorFor = typename TypedArrayVector<T>::Type;
+
+template<typename T>
+constexpr bool has_typed_array_vector = !IsVoid<TypedArrayVectorFor<T>>;
+
+// Fill, reverse and copy only move bit patterns around, so they treat every element as an unsigned integer of its size.
+template<typename T>
+using TypedArrayBitsFor = Conditional<sizeof(T) == 1, u8, Conditional<sizeof(T) == 2, u16, Conditional<sizeof(T) == 4, u32, u64>>>;
+
+template<AK::SIMD::SIMDVector V>
+ALWAYS_INLINE static V broadcast(AK::SIMD::ElementOf<V> value)
+{
+    V result;
+    for (size_t i = 0; i < AK::SIMD::vector_length<V>; ++i)
+        result[i] = value;
+    return result;
+}
+
+template<AK::SIMD::SIMDVector Mask>
+ALWAYS_INLINE static bool any_lane_set(Mask mask)
+{
+    static_assert(sizeof(Mask) == sizeof(AK::SIMD::u64x2));
+    auto bits = bit_cast<AK::SIMD::u64x2>(mask);
+    return (bits[0] | bits[1]) != 0;
+}
+
+template<typename T, typename VectorMatches, typename ElementMatches>
+ALWAYS_INLINE static Optional<size_t> find_first_matching(T const* data, size_t start, size_t end, VectorMatches vector_matches, ElementMatches element_matches)
+{
+    if (start >= end)
+        return {};
+
+    auto index = start;
+
+    if constexpr (has_typed_array_vector<T>) {
+        using Vector = TypedArrayVectorFor<T>;
+        constexpr auto lanes = AK::SIMD::vector_length<Vector>;
+
+        // Skip over chunks without a match, the scalar loop below then finds the exact index within the matching chunk.
+        for (; end - index >= lanes; index += lanes) {
+            if (any_lane_set(vector_matches(AK::SIMD::load_unaligned<Vector>(data + index))))
+                break;
+        }
+    }
+
+    for (; index < end; ++index) {
+        if (element_matches(data[index]))
+            return index;
+    }
+    return {};
+}
+
+template<typename T, typename VectorMatches, typename ElementMatches>
+ALWAYS_INLINE static Optional<size_t> find_last_matching(T const* data, size_t end, VectorMatches vector_matches, ElementMatches element_matches)
+{
+    auto index = end;
+
+    if constexpr (has_typed_array_vector<T>) {
+        using Vector = TypedArrayVectorFor<T>;
+        constexpr auto lanes = AK::SIMD::vector_length<Vector>;
+
+        for (; index >= lanes; index -= lanes) {
+            if (any_lane_set(vector_matches(AK::SIMD::load_unaligned<Vector>(data + index - lanes))))
+                break;
+        }
+    }
+
+    while (index > 0) {
+        --index;
+        if (element_matches(data[index]))
+            return index;
+    }
+    return {};
+}
+
+template<typename T>
+static void fill_bits(T* data, size_t count, T value)
+{
+    size_t index = 0;
+
+    using Vector = TypedArrayVectorFor<T>;
+    constexpr auto lanes = AK::SIMD::vector_length<Vector>;
+    auto vector_value = broadcast<Vector>(value);
+    for (; count - index >= lanes; index += lanes)
+        AK::SIMD::store_unaligned(data + index, vector_value);
+
+    for (; index < count; ++index)
+        data[index] = value;
+}
+
+template<typename T>
+static void reverse_bits(T* data, size_t count)
+{
+    size_t lower = 0;
+    size_t upper = count;
+
+    using Vector = TypedArrayVectorFor<T>;
+    constexpr auto lanes = AK::SIMD::vector_length<Vector>;
+    for (; upper - lower >= 2 * lanes; lower += lanes, upper -= lanes) {
+        auto lower_chunk = AK::SIMD::load_unaligned<Vector>(data + lower);
+        auto upper_chunk = AK::SIMD::load_unaligned<Vector>(data + upper - lanes);
+        AK::SIMD::store_unaligned(data + lower, AK::SIMD::item_reverse(upper_chunk));
+        AK::SIMD::store_unaligned(data + upper - lanes, AK::SIMD::item_reverse(lower_chunk));
+    }
+
+    for (; upper - lower >= 2; ++lower) {
+        --upper;
+        swap(data[lower], data[upper]);
+    }
+}
+
+template<typename T>
+static void copy_bits_reversed(T* destination, T const* source, size_t count)
+{
+    size_t index = 0;
+
+    using Vector = TypedArrayVectorFor<T>;
+    constexpr auto lanes = AK::SIMD::vector_length<Vector>;
+    for (; count - index >= lanes; index += lanes) {
+        auto chunk = AK::SIMD::load_unaligned<Vector>(source + count - index - lanes);
+        AK::SIMD::store_unaligned(destination + index, AK::SIMD::item_reverse(chunk));
+    }
+
+    for (; index < count; ++index)
+        destination[index] = source[count - index - 1];
+}
+
+}
+
+// Sets the first count elements at data to value.
+template<typename T>
+void typed_array_fill(T* data, size_t count, T value)
+{
+    using Bits = Detail::TypedArrayBitsFor<T>;
+    Detail::fill_bits(reinterpret_cast<Bits*>(data), count, bit_cast<Bits>(value));
+}
+
+// Reverses the order of the first count elements at data.
+template<typename T>
+void typed_array_reverse(T* data, size_t count)
+{
+    using Bits = Detail::TypedArrayBitsFor<T>;
+    Detail::reverse_bits(reinterpret_cast<Bits*>(data), count);
+}
+
+// Copies count elements from source to destination in reverse order. The ranges must not overlap.
+template<typename T>
+void typed_array_copy_reversed(T* destination, T const* source, size_t count)
+{
+    using Bits = Detail::TypedArrayBitsFor<T>;
+    Detail::copy_bits_reversed(reinterpret_cast<Bits*>(destination), reinterpret_cast<Bits const*>(source), count);
+}
+
+// Returns the index of the first element in [start, end) that is equal to needle. As with IsStrictlyEqual, a NaN needle
+// never matches and -0 matches +0.
+template<typename T>
+Optional<size_t> typed_array_find_first(T const* data, size_t start, size_t end, T needle)
+{
+    if constexpr (Detail::has_typed_array_vector<T>) {
+        auto vector_needle = Detail::broadcast<Detail::TypedArrayVectorFor<T>>(needle);
+        return Detail::find_first_matching(
+            data, start, end,
+            [&](auto chunk) { return chunk == vector_needle; },
+            [&](T element) { return element == needle; });
+    } else {
+        return Detail::find_first_matching(data, start, end, nullptr, [&](T element) { return element == needle; });
+    }
+}
+
+// Returns the index of the last element in [0, end) that is equal to needle, with the same semantics as above.
+template<typename T>
+Optional<size_t> typed_array_find_last(T const* data, size_t end, T needle)
+{
+    if constexpr (Detail::has_typed_array_vector<T>) {
+        auto vector_needle = Detail::broadcast<Detail::TypedArrayVectorFor<T>>(needle);
+        return Detail::find_last_matching(
+            data, end,
+            [&](auto chunk) { return chunk == vector_needle; },
+            [&](T element) { return element == needle; });
+    } else {
+        return Detail::find_last_matching(data, end, nullptr, [&](T element) { return element == needle; });
+    }
+}
+
+// Returns the index of the first NaN element in [start, end).
+template<FloatingPoint T>
+Optional<size_t> typed_array_find_first_nan(T const* data, size_t start, size_t end)
+{
+    if constexpr (Detail::has_typed_array_vector<T>) {
+        return Detail::find_first_matching(
+            data, start, end,
+            [](auto chunk) { return chunk != chunk; },
+            [](T element) { return element != element; });
+    } else {
+        return Detail::find_first_matching(data, start, end, nullptr, [](T element) { return element != element; });
+    }
+}
+
+}
+
+#pragma GCC diagnostic pop
@@ -11,7 +11,9 @@
 #include <LibJS/Runtime/Array.h>
 #include <LibJS/Runtime/ArrayIterator.h>
 #include <LibJS/Runtime/GlobalObject.h>
+#include <LibJS/Runtime/TimSort.h>
 #include <LibJS/Runtime/TypedArray.h>
+#include <LibJS/Runtime/TypedArrayKernels.h>
 #include <LibJS/Runtime/TypedArrayPrototype.h>
 #include <LibJS/Runtime/ValueInlines.h>
 
@@ -475,32 +477,113 @@ JS_DEFINE_NATIVE_FUNCTION(TypedArrayPrototype::every)
     return true;
 }
 
-// NOTE: This function assumes that the index is valid within the TypedArray,
-//       and that the TypedArray is not detached.
-template<typename T>
-inline void fast_typed_array_fill(TypedArrayBase& typed_array, u32 begin, u32 end, T value)
+// Returns a pointer to the TypedArray's elements if they can be accessed directly, i.e. if its buffer is attached, not
+// shared and fixed-length. Otherwise, the caller must go through the generic element accessors.
+static u8* typed_array_direct_data(TypedArrayBase const& typed_array)
 {
-    Checked<size_t> computed_begin = begin;
-    computed_begin *= sizeof(T);
-    computed_begin += typed_array.byte_offset();
+    if (typed_array.viewed_array_buffer()->is_shared_array_buffer())
+        return nullptr;
+    return typed_array.cached_data_ptr();
+}
 
-    Checked<size_t> computed_end = end;
-    computed_end *= sizeof(T);
-    computed_end += typed_array.byte_offset();
+// Returns the element of the given type that is strictly equal to the given value, if there is one.
+template<typename T>
+static Optional<T> typed_array_element_strictly_equal_to(Value value)
+{
+    if constexpr (IsSame<T, i64> || IsSame<T, u64>) {
+        if (!value.is_bigint())
+            return {};
+
+        auto const& big_integer = value.as_bigint().big_integer();
+        if constexpr (IsSame<T, i64>) {
+            auto element = big_integer.to_i64();
+            if (big_integer != Crypto::SignedBigInteger { element })
+                return {};
+            return element;
+        } else {
+            auto element = big_integer.to_u64();
+            if (big_integer != Crypto::UnsignedBigInteger { element })
+                return {};
+            return element;
+        }
+    } else {
+        if (!value.is_number())
+            return {};
+
+        auto number = value.as_double();
+        if constexpr (IsIntegral<T>) {
+            if (!(number >= static_cast<double>(NumericLimits<T>::min()) && number <= static_cast<double>(NumericLimits<T>::max())))
+                return {};
+        }
 
-    if (computed_begin.has_overflow() || computed_end.has_overflow()) [[unlikely]] {
-        return;
+        // NB: This also rejects NaN, which is not strictly equal to anything.
+        auto element = static_cast<T>(number);
+        if (static_cast<double>(element) != number)
+            return {};
+        return element;
     }
+}
 
-    if (computed_begin.value() >= typed_array.viewed_array_buffer()->byte_length()
-        || computed_end.value() > typed_array.viewed_array_buffer()->byte_length()) [[unlikely]] {
+template<typename T>
+static void fast_typed_array_fill(VM& vm, u8* data, u32 begin, u32 end, Value value)
+{
+    using UnderlyingBufferDataType = Conditional<IsSame<ClampedU8, T>, u8, T>;
+
+    if (begin >= end)
         return;
+
+    UnderlyingBufferDataType element;
+    numeric_to_raw_bytes<T>(vm, value, true, Bytes { &element, sizeof(element) });
+    typed_array_fill(reinterpret_cast<UnderlyingBufferDataType*>(data) + begin, end - begin, element);
+}
+
+template<typename T>
+static Optional<size_t> fast_typed_array_index_of(u8 const* data, u32 begin, u32 end, Value search_element)
+{
+    using UnderlyingBufferDataType = Conditional<IsSame<ClampedU8, T>, u8, T>;
+
+    auto needle = typed_array_element_strictly_equal_to<UnderlyingBufferDataType>(search_element);
+    if (!needle.has_value())
+        return {};
+    return typed_array_find_first(reinterpret_cast<UnderlyingBufferDataType const*>(data), begin, end, *needle);
+}
+
+template<typename T>
+static Optional<size_t> fast_typed_array_last_index_of(u8 const* data, u32 end, Value search_element)
+{
+    using UnderlyingBufferDataType = Conditional<IsSame<ClampedU8, T>, u8, T>;
+
+    auto needle = typed_array_element_strictly_equal_to<UnderlyingBufferDataType>(search_element);
+    if (!needle.has_value())
+        return {};
+    return typed_array_find_last(reinterpret_cast<UnderlyingBufferDataType const*>(data), end, *needle);
+}
+
+template<typename T>
+static bool fast_typed_array_includes(u8 const* data, u32 begin, u32 end, Value search_element)
+{
+    using UnderlyingBufferDataType = Conditional<IsSame<ClampedU8, T>, u8, T>;
+
+    // NB: Unlike IsStrictlyEqual, SameValueZero considers NaN to be equal to itself.
+    if constexpr (IsFloatingPoint<UnderlyingBufferDataType>) {
+        if (search_element.is_nan())
+            return typed_array_find_first_nan(reinterpret_cast<UnderlyingBufferDataType const*>(data), begin, end).has_value();
     }
+    return fast_typed_array_index_of<T>(data, begin, end, search_element).has_value();
+}
+
+template<typename T>
+static void fast_typed_array_reverse(u8* data, u32 length)
+{
+    using UnderlyingBufferDataType = Conditional<IsSame<ClampedU8, T>, u8, T>;
+    typed_array_reverse(reinterpret_cast<UnderlyingBufferDataType*>(data), length);
+}
 
-    auto& array_buffer = *typed_array.viewed_array_buffer();
-    auto* slot = reinterpret_cast<T*>(array_buffer.buffer().offset_pointer(computed_begin.value()));
-    for (auto i = begin; i < end; ++i)
-        *(slot++) = value;
+template<typename T>
+static void fast_typed_array_copy_reversed(u8* destination, u8 const* source, u32 length)
+{
+    using UnderlyingBufferDataType = Conditional<IsSame<ClampedU8, T>, u8, T>;
+    typed_array_copy_reversed(reinterpret_cast<UnderlyingBufferDataType*>(destination), reinterpret_cast<UnderlyingBufferDataType const*>(source), length);
 }
 
 // 23.2.3.9 %TypedArray%.prototype.fill ( value [ , start [ , end ] ] ), https://tc39.es/ecma262/#sec-%typedarray%.prototype.fill
@@ -571,33 +654,18 @@ JS_DEFINE_NATIVE_FUNCTION(TypedArrayPrototype::fill)
     // 17. Set final to min(final, len).
     final = min(final, length);
 
-    if (value.is_int32()) {
+    // OPTIMIZATION: Convert the value to its raw element once, and write it to the buffer directly.
+    if (auto* data = typed_array_direct_data(*typed_array)) {
         switch (typed_array->kind()) {
-        case TypedArrayBase::Kind::Uint8Array:
-            fast_typed_array_fill<u8>(*typed_array, k, final, static_cast<u8>(value.as_i32()));
-            return typed_array;
-        case TypedArrayBase::Kind::Uint16Array:
-            fast_typed_array_fill<u16>(*typed_array, k, final, static_cast<u16>(value.as_i32()));
-            return typed_array;
-        case TypedArrayBase::Kind::Uint32Array:
-            fast_typed_array_fill<u32>(*typed_array, k, final, static_cast<u32>(value.as_i32()));
-            return typed_array;
-        case TypedArrayBase::Kind::Int8Array:
-            fast_typed_array_fill<i8>(*typed_array, k, final, static_cast<i8>(value.as_i32()));
-            return typed_array;
-        case TypedArrayBase::Kind::Int16Array:
-            fast_typed_array_fill<i16>(*typed_array, k, final, static_cast<i16>(value.as_i32()));
-            return typed_array;
-        case TypedArrayBase::Kind::Int32Array:
-            fast_typed_array_fill<i32>(*typed_array, k, final, value.as_i32());
-            return typed_array;
-        case TypedArrayBase::Kind::Uint8ClampedArray:
-            fast_typed_array_fill<u8>(*typed_array, k, final, clamp(value.as_i32(), 0, 255));
-            return typed_array;
-        default:
-            // FIXME: Support more TypedArray kinds.
-            break;
+#define __JS_ENUMERATE(ClassName, snake_name, PrototypeName, ConstructorName, Type) \
+    case TypedArrayBase::Kind::ClassName:                                           \
+        fast_typed_array_fill<Type>(vm, data, k, final, value);                     \
+        break;
+            JS_ENUMERATE_TYPED_ARRAYS
+#undef __JS_ENUMERATE
         }
+
+        return typed_array;
     }
 
     // 18. Repeat, while k < final,
@@ -923,6 +991,18 @@ JS_DEFINE_NATIVE_FUNCTION(TypedArrayPrototype::includes)
         k = relative_k;
     }
 
+    // OPTIMIZATION: Compare the elements in the buffer directly, rather than converting each of them to a Value.
+    if (auto const* data = typed_array_direct_data(*typed_array)) {
+        switch (typed_array->kind()) {
+#define __JS_ENUMERATE(ClassName, snake_name, PrototypeName, ConstructorName, Type) \
+    case TypedArrayBase::Kind::ClassName:                                           \
+        return Value { fast_typed_array_includes<Type>(data, k, length, search_element) };
+            JS_ENUMERATE_TYPED_ARRAYS
+#undef __JS_ENUMERATE
+        }
+        VERIFY_NOT_REACHED();
+    }
+
     // 11. Repeat, while k < len,
     while (k < length) {
         // a. Let elementK be ! Get(O, ! ToString(𝔽(k))).
@@ -992,6 +1072,20 @@ JS_DEFINE_NATIVE_FUNCTION(TypedArrayPrototype::index_of)
         k = relative_k;
     }
 
+    // OPTIMIZATION: Compare the elements in the buffer directly, rather than converting each of them to a Value.
+    if (auto const* data = typed_array_direct_data(*typed_array)) {
+        Optional<size_t> index;
+        switch (typed_array->kind()) {
+#define __JS_ENUMERATE(ClassName, snake_name, PrototypeName, ConstructorName, Type) \
+    case TypedArrayBase::Kind::ClassName:                                           \
+        index = fast_typed_array_index_of<Type>(data, k, length, search_element);   \
+        break;
+            JS_ENUMERATE_TYPED_ARRAYS
+#undef __JS_ENUMERATE
+        }
+        return index.has_value() ? Value { *index } : Value { -1 };
+    }
+
     // 11. Repeat, while k < len,
     while (k < length) {
         // a. Let kPresent be ! HasProperty(O, ! ToString(𝔽(k))).
@@ -1129,6 +1223,20 @@ JS_DEFINE_NATIVE_FUNCTION(TypedArrayPrototype::last_index_of)
         k = relative_k;
     }
 
+    // OPTIMIZATION: Compare the elements in the buffer directly, rather than converting each of them to a Value.
+    if (auto const* data = typed_array_direct_data(*typed_array)) {
+        Optional<size_t> index;
+        switch (typed_array->kind()) {
+#define __JS_ENUMERATE(ClassName, snake_name, PrototypeName, ConstructorName, Type) \
+    case TypedArrayBase::Kind::ClassName:                                           \
+        index = fast_typed_array_last_index_of<Type>(data, k + 1, search_element);  \
+        break;
+            JS_ENUMERATE_TYPED_ARRAYS
+#undef __JS_ENUMERATE
+        }
+        return index.has_value() ? Value { *index } : Value { -1 };
+    }
+
     // 9. Repeat, while k ≥ 0,
     while (k >= 0) {
         // a. Let kPresent be ! HasProperty(O, ! ToString(𝔽(k))).
@@ -1356,6 +1464,20 @@ JS_DEFINE_NATIVE_FUNCTION(TypedArrayPrototype::reverse)
     // 3. Let len be TypedArrayLength(taRecord).
     auto length = typed_array_length(typed_array_record);
 
+    // OPTIMIZATION: Swap the elements in the buffer directly, rather than getting and setting each of them as a Value.
+    if (auto* data = typed_array_direct_data(*typed_array)) {
+        switch (typed_array->kind()) {
+#define __JS_ENUMERATE(ClassName, snake_name, PrototypeName, ConstructorName, Type) \
+    case TypedArrayBase::Kind::ClassName:                                           \
+        fast_typed_array_reverse<Type>(data, length);                               \
+        break;
+            JS_ENUMERATE_TYPED_ARRAYS
+#undef __JS_ENUMERATE
+        }
+
+        return typed_array;
+    }
+
     // 4. Let middle be floor(len / 2).
     auto middle = length / 2;
 
@@ -1829,6 +1951,59 @@ JS_DEFINE_NATIVE_FUNCTION(TypedArrayPrototype::some)
     return false;
 }
 
+// Orders two elements the way CompareTypedArrayElements does with an undefined comparefn.
+template<typename T>
+static bool typed_array_element_less_than(T x, T y)
+{
+    if constexpr (IsFloatingPoint<T>) {
+        auto x_double = static_cast<double>(x);
+        auto y_double = static_cast<double>(y);
+
+        // NaN is ordered after all other values.
+        if (isnan(x_double))
+            return false;
+        if (isnan(y_double))
+            return true;
+
+        // -0 is ordered before +0.
+        if (x_double == y_double)
+            return signbit(x_double) && !signbit(y_double);
+
+        return x_double < y_double;
+    } else {
+        return x < y;
+    }
+}
+
+template<typename T>
+static void sort_typed_array_elements(Span<T> elements)
+{
+    Vector<T> buffer;
+    MUST(tim_sort(elements, buffer, [](T x, T y) -> ThrowCompletionOr<bool> {
+        return typed_array_element_less_than(x, y);
+    }));
+}
+
+// OPTIMIZATION: With the default comparator, CompareTypedArrayElements is an unobservable numeric comparison, so we can
+//               sort the elements in place in the underlying buffer instead of going through a list of Values.
+static bool sort_typed_array_with_default_comparison(TypedArrayBase& typed_array)
+{
+    // NB: Other agents may write to a shared buffer while we sort it, so that is left to the generic path, which reads
+    //     each element exactly once.
+    if (typed_array.viewed_array_buffer()->is_shared_array_buffer())
+        return false;
+
+    switch (typed_array.kind()) {
+#define __JS_ENUMERATE(ClassName, snake_name, PrototypeName, ConstructorName, Type) \
+    case TypedArrayBase::Kind::ClassName:                                           \
+        sort_typed_array_elements(static_cast<ClassName&>(typed_array).data());     \
+        return true;
+        JS_ENUMERATE_TYPED_ARRAYS
+#undef __JS_ENUMERATE
+    }
+    VERIFY_NOT_REACHED();
+}
+
 // 23.2.3.29 %TypedArray%.prototype.sort ( comparefn ), https://tc39.es/ecma262/#sec-%typedarray%.prototype.sort
 JS_DEFINE_NATIVE_FUNCTION(TypedArrayPrototype::sort)
 {
@@ -1847,6 +2022,9 @@ JS_DEFINE_NATIVE_FUNCTION(TypedArrayPrototype::sort)
     // 4. Let len be TypedArrayLength(taRecord).
     auto length = typed_array_length(typed_array_record);
 
+    if (compare_function.is_undefined() && sort_typed_array_with_default_comparison(*typed_array))
+        return typed_array;
+
     // 5. NOTE: The following closure performs a numeric comparison rather than the string comparison used in 23.1.3.30.
     // 6. Let SortCompare be a new Abstract Closure with parameters (x, y) that captures comparefn and performs the following steps when called:
     Function<ThrowCompletionOr<double>(Value, Value)> sort_compare = [&](auto x, auto y) -> ThrowCompletionOr<double> {
@@ -2040,6 +2218,22 @@ JS_DEFINE_NATIVE_FUNCTION(TypedArrayPrototype::to_reversed)
     arguments.empend(length);
     auto* array = TRY(typed_array_create_same_type(vm, *typed_array, move(arguments)));
 
+    // OPTIMIZATION: Copy the elements from buffer to buffer directly, rather than getting and setting each of them as a Value.
+    auto const* source_data = typed_array_direct_data(*typed_array);
+    auto* target_data = typed_array_direct_data(*array);
+    if (source_data && target_data) {
+        switch (typed_array->kind()) {
+#define __JS_ENUMERATE(ClassName, snake_name, PrototypeName, ConstructorName, Type) \
+    case TypedArrayBase::Kind::ClassName:                                           \
+        fast_typed_array_copy_reversed<Type>(target_data, source_data, length);     \
+        break;
+            JS_ENUMERATE_TYPED_ARRAYS
+#undef __JS_ENUMERATE
+        }
+
+        return array;
+    }
+
     // 5. Let k be 0.
     // 6. Repeat, while k < length,
     for (size_t k = 0; k < length; ++k) {
@@ -2085,6 +2279,16 @@ JS_DEFINE_NATIVE_FUNCTION(TypedArrayPrototype::to_sorted)
     arguments.empend(length);
     auto* array = TRY(typed_array_create_same_type(vm, *typed_array, move(arguments)));
 
+    // OPTIMIZATION: With the default comparator, copy the elements into A as they are and sort them in place there.
+    if (compare_function.is_undefined() && !typed_array->viewed_array_buffer()->is_shared_array_buffer()) {
+        auto const* source = typed_array->viewed_array_buffer()->buffer().data() + typed_array->byte_offset();
+        auto* destination = array->viewed_array_buffer()->buffer().data() + array->byte_offset();
+        memcpy(destination, source, length * typed_array->element_size());
+
+        if (sort_typed_array_with_default_comparison(*array))
+            return array;
+    }
+
     // 6. NOTE: The following closure performs a numeric comparison rather than the string comparison used in 23.1.3.34.
     Function<ThrowCompletionOr<double>(Value, Value)> sort_compare = [&](auto x, auto y) -> ThrowCompletionOr<double> {
         // a. Return ? CompareTypedArrayElements(x, y, comparefn).
@@ -16,6 +16,7 @@
 #include <LibFileSystem/FileSystem.h>
 #include <LibJS/Bytecode/Executable.h>
 #include <LibJS/Bytecode/Interpreter.h>
+#include <LibJS/CompiledProgramCache.h>
 #include <LibJS/Runtime/AbstractOperations.h>
 #include <LibJS/Runtime/Array.h>
 #include <LibJS/Runtime/ArrayBuffer.h>
@@ -29,6 +30,7 @@
 #include <LibJS/Runtime/NativeFunction.h>
 #include <LibJS/Runtime/PromiseCapability.h>
 #include <LibJS/Runtime/Reference.h>
+#include <LibJS/Runtime/SamplingProfiler.h>
 #include <LibJS/Runtime/Symbol.h>
 #include <LibJS/Runtime/Temporal/Instant.h>
 #include <LibJS/Runtime/VM.h>
@@ -79,9 +81,12 @@ VM::VM(ErrorMessages error_messages)
 {
     s_the = this;
     m_bytecode_interpreter = make<Bytecode::Interpreter>();
+    m_compiled_program_cache = make<CompiledProgramCache>();
+    m_megamorphic_property_cache = make<Bytecode::MegamorphicPropertyCache>();
 
-    m_heap.register_sweep_callback([] {
+    m_heap.register_sweep_callback([this] {
         Bytecode::StaticPropertyLookupCache::sweep_all();
+        m_megamorphic_property_cache->remove_dead_cells();
     });
 
     m_empty_string = m_heap.allocate<PrimitiveString>(String {});
@@ -114,12 +119,12 @@ VM::VM(ErrorMessages error_messages)
         enqueue_finalization_registry_cleanup_job(finalization_registry);
     };
 
-    host_enqueue_promise_job = [this](GC::Ref<GC::Function<ThrowCompletionOr<Value>()>> job, Realm* realm) {
+    host_enqueue_promise_job = [this](PromiseJob job, Realm* realm) {
         enqueue_promise_job(job, realm);
     };
 
     host_promise_job_queue_is_empty = [this]() -> bool {
-        return m_promise_jobs.is_empty();
+        return !has_queued_promise_jobs();
     };
 
     host_make_job_callback = [](FunctionObject& function_object) {
@@ -318,8 +323,11 @@ void VM::gather_roots(HashMap<GC::Cell*, GC::HeapRoot>& roots)
     for (auto& saved_stack : m_saved_execution_context_stacks)
         gather_roots_from_execution_context_stack(saved_stack);
 
-    for (auto& job : m_promise_jobs)
-        roots.set(job, GC::HeapRoot { .type = GC::HeapRoot::Type::VM });
+    ExecutionContextRootsCollector promise_job_visitor;
+    for (size_t i = 0; i < m_promise_job_count; ++i)
+        m_promise_jobs[(m_first_promise_job_index + i) % m_promise_jobs.size()].visit_edges(promise_job_visitor);
+    for (auto cell : promise_job_visitor.roots)
+        roots.set(cell, GC::HeapRoot { .type = GC::HeapRoot::Type::VM });
 }
 
 // 9.1.2.1 GetIdentifierReference ( env, name, strict ), https://tc39.es/ecma262/#sec-getidentifierreference
@@ -462,23 +470,44 @@ void VM::run_queued_promise_jobs_impl()
 {
     dbgln_if(PROMISE_DEBUG, "Running queued promise jobs");
 
-    while (!m_promise_jobs.is_empty()) {
-        auto job = m_promise_jobs.take_first();
+    while (has_queued_promise_jobs()) {
+        // NB: Copy the job out, as running it may enqueue more jobs and reallocate the queue.
+        auto job = m_promise_jobs[m_first_promise_job_index];
+        m_first_promise_job_index = (m_first_promise_job_index + 1) % m_promise_jobs.size();
+        --m_promise_job_count;
         dbgln_if(PROMISE_DEBUG, "Calling promise job function");
 
-        [[maybe_unused]] auto result = job->function()();
+        [[maybe_unused]] auto result = job.run(*this);
     }
+
+    m_first_promise_job_index = 0;
 }
 
 // 9.5.4 HostEnqueuePromiseJob ( job, realm ), https://tc39.es/ecma262/#sec-hostenqueuepromisejob
-void VM::enqueue_promise_job(GC::Ref<GC::Function<ThrowCompletionOr<Value>()>> job, Realm*)
+void VM::enqueue_promise_job(PromiseJob job, Realm*)
 {
     // An implementation of HostEnqueuePromiseJob must conform to the requirements in 9.5 as well as the following:
     // - FIXME: If realm is not null, each time job is invoked the implementation must perform implementation-defined steps such that execution is prepared to evaluate ECMAScript code at the time of job's invocation.
     // - FIXME: Let scriptOrModule be GetActiveScriptOrModule() at the time HostEnqueuePromiseJob is invoked. If realm is not null, each time job is invoked the implementation must perform implementation-defined steps
     //          such that scriptOrModule is the active script or module at the time of job's invocation.
     // - Jobs must run in the same order as the HostEnqueuePromiseJob invocations that scheduled them.
+    if (m_promise_job_count < m_promise_jobs.size()) {
+        m_promise_jobs[(m_first_promise_job_index + m_promise_job_count) % m_promise_jobs.size()] = job;
+        ++m_promise_job_count;
+        return;
+    }
+
+    // Every slot is queued, so grow the storage. If the queue wraps around, unwrap it first so the new job goes last.
+    if (m_first_promise_job_index != 0) {
+        Vector<PromiseJob> jobs;
+        jobs.ensure_capacity(m_promise_jobs.size() * 2);
+        for (size_t i = 0; i < m_promise_job_count; ++i)
+            jobs.unchecked_append(m_promise_jobs[(m_first_promise_job_index + i) % m_promise_jobs.size()]);
+        m_promise_jobs = move(jobs);
+        m_first_promise_job_index = 0;
+    }
     m_promise_jobs.append(job);
+    ++m_promise_job_count;
 }
 
 void VM::run_queued_finalization_registry_cleanup_jobs()
@@ -515,6 +544,21 @@ void VM::promise_rejection_tracker(Promise& promise, Promise::RejectionOperation
     }
 }
 
+SamplingProfiler& VM::ensure_sampling_profiler()
+{
+    if (!m_sampling_profiler)
+        m_sampling_profiler = make<SamplingProfiler>(*this);
+    return *m_sampling_profiler;
+}
+
+void VM::take_profiler_sample()
+{
+    if (!m_profiler_sample_requested.exchange(false, AK::MemoryOrder::memory_order_relaxed))
+        return;
+    if (m_sampling_profiler && m_sampling_profiler->is_running())
+        m_sampling_profiler->take_sample({});
+}
+
 void VM::dump_backtrace() const
 {
     for (ssize_t i = m_execution_context_stack.size() - 1; i >= 0; --i) {
@@ -610,7 +654,7 @@ ThrowCompletionOr<void> VM::link_and_eval_module(CyclicModule& module)
     auto const& evaluated_value = static_cast<Promise&>(*evaluated_or_error.value()->promise());
 
     run_queued_promise_jobs();
-    VERIFY(m_promise_jobs.is_empty());
+    VERIFY(!has_queued_promise_jobs());
 
     // FIXME: This will break if we start doing promises actually asynchronously.
     VERIFY(evaluated_value.state() != Promise::State::Pending);
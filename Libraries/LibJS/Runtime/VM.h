@@ -9,6 +9,7 @@
 
 #pragma once
 
+#include <AK/Atomic.h>
 #include <AK/FlyString.h>
 #include <AK/Function.h>
 #include <AK/HashMap.h>
@@ -30,6 +31,7 @@
 #include <LibJS/Runtime/ExecutionContext.h>
 #include <LibJS/Runtime/InterpreterStack.h>
 #include <LibJS/Runtime/Promise.h>
+#include <LibJS/Runtime/PromiseJobs.h>
 #include <LibJS/Runtime/Value.h>
 
 namespace JS {
@@ -65,6 +67,23 @@ public:
 
     Bytecode::Interpreter& bytecode_interpreter() { return *m_bytecode_interpreter; }
 
+    CompiledProgramCache& compiled_program_cache() { return *m_compiled_program_cache; }
+    Bytecode::MegamorphicPropertyCache& megamorphic_property_cache() { return *m_megamorphic_property_cache; }
+
+    SamplingProfiler& ensure_sampling_profiler();
+    SamplingProfiler* sampling_profiler() { return m_sampling_profiler.ptr(); }
+
+    // NB: May be called from any thread. The sample is taken on the VM's own thread at the next function entry or
+    //     loop back-edge.
+    void request_profiler_sample() { m_profiler_sample_requested.store(true, AK::MemoryOrder::memory_order_relaxed); }
+    Atomic<bool> const& profiler_sample_requested() const { return m_profiler_sample_requested; }
+
+    ALWAYS_INLINE void take_profiler_sample_if_requested()
+    {
+        if (m_profiler_sample_requested.load(AK::MemoryOrder::memory_order_relaxed)) [[unlikely]]
+            take_profiler_sample();
+    }
+
     void dump_backtrace() const;
 
     void gather_roots(HashMap<GC::Cell*, GC::HeapRoot>&);
@@ -127,12 +146,14 @@ public:
         if (did_reach_stack_space_limit()) [[unlikely]] {
             return throw_completion<InternalError>(ErrorType::CallStackSizeExceeded);
         }
+        take_profiler_sample_if_requested();
         m_execution_context_stack.append(&context);
         return {};
     }
 
     void push_execution_context(ExecutionContext& context)
     {
+        take_profiler_sample_if_requested();
         m_execution_context_stack.append(&context);
     }
 
@@ -247,12 +268,12 @@ public:
 
     void run_queued_promise_jobs()
     {
-        if (m_promise_jobs.is_empty())
+        if (!has_queued_promise_jobs())
             return;
         run_queued_promise_jobs_impl();
     }
 
-    void enqueue_promise_job(GC::Ref<GC::Function<ThrowCompletionOr<Value>()>> job, Realm*);
+    void enqueue_promise_job(PromiseJob, Realm*);
 
     void run_queued_finalization_registry_cleanup_jobs();
     void enqueue_finalization_registry_cleanup_job(FinalizationRegistry&);
@@ -289,7 +310,7 @@ public:
     Function<void(Promise&, Promise::RejectionOperation)> host_promise_rejection_tracker;
     Function<ThrowCompletionOr<Value>(JobCallback&, Value, ReadonlySpan<Value>)> host_call_job_callback;
     Function<void(FinalizationRegistry&)> host_enqueue_finalization_registry_cleanup_job;
-    Function<void(GC::Ref<GC::Function<ThrowCompletionOr<Value>()>>, Realm*)> host_enqueue_promise_job;
+    Function<void(PromiseJob, Realm*)> host_enqueue_promise_job;
     Function<GC::Ref<JobCallback>(FunctionObject&)> host_make_job_callback;
     Function<GC::Ptr<PrimitiveString>(Object const&)> host_get_code_for_eval;
     Function<ThrowCompletionOr<void>(Realm&, ReadonlySpan<String>, StringView, StringView, CompilationType, ReadonlySpan<Value>, Value)> host_ensure_can_compile_strings;
@@ -302,6 +323,24 @@ public:
 
     [[nodiscard]] Vector<StackTraceElement> stack_trace() const;
 
+    // Functions only get bytecode on their first call. This keeps track of how much of the parsed
+    // code was actually compiled, and how much was thrown away without ever being run.
+    struct LazyCompilationStatistics {
+        size_t functions_awaiting_compilation { 0 };
+        size_t source_code_units_awaiting_compilation { 0 };
+        size_t functions_compiled { 0 };
+        size_t source_code_units_compiled { 0 };
+        size_t bytecode_bytes_compiled { 0 };
+        size_t functions_never_compiled { 0 };
+        size_t source_code_units_never_compiled { 0 };
+    };
+    LazyCompilationStatistics& lazy_compilation_statistics() { return m_lazy_compilation_statistics; }
+
+    // NB: Serial numbers are unique across all environments of this VM, not just within one. Compiled scripts (and with
+    //     them their GlobalVariableCaches) are shared between realms, so a cache must never mistake one realm's global
+    //     environment for another one that happens to have created the same number of bindings.
+    u64 next_environment_serial_number() { return m_next_environment_serial_number++; }
+
 private:
     using ErrorMessages = AK::Array<Utf16String, to_underlying(ErrorMessage::__Count)>;
 
@@ -320,6 +359,9 @@ private:
     void set_well_known_symbols(WellKnownSymbols well_known_symbols) { m_well_known_symbols = move(well_known_symbols); }
 
     void run_queued_promise_jobs_impl();
+    bool has_queued_promise_jobs() const { return m_promise_job_count > 0; }
+
+    void take_profiler_sample();
 
     static VM* s_the;
 
@@ -329,6 +371,9 @@ private:
     static constexpr size_t numeric_string_cache_size = 1000;
     AK::Array<GC::Ptr<PrimitiveString>, numeric_string_cache_size> m_numeric_string_cache;
 
+    // NB: Updated when SharedFunctionInstanceData is finalized, so it must outlive m_heap.
+    LazyCompilationStatistics m_lazy_compilation_statistics;
+
     GC::Heap m_heap;
 
     Vector<ExecutionContext*> m_execution_context_stack;
@@ -342,7 +387,13 @@ private:
     // GlobalSymbolRegistry, https://tc39.es/ecma262/#table-globalsymbolregistry-record-fields
     HashMap<Utf16String, GC::Ref<Symbol>> m_global_symbol_registry;
 
-    Vector<GC::Ref<GC::Function<ThrowCompletionOr<Value>()>>> m_promise_jobs;
+    // NB: A ring buffer of pending jobs. The queued jobs are the m_promise_job_count slots starting at
+    //     m_first_promise_job_index, wrapping around at the end of m_promise_jobs. The other slots hold jobs that
+    //     already ran and are overwritten by the next ones. The storage only grows when every slot is queued, so
+    //     enqueuing a job doesn't allocate in the steady state, even if jobs keep enqueuing more jobs.
+    Vector<PromiseJob> m_promise_jobs;
+    size_t m_first_promise_job_index { 0 };
+    size_t m_promise_job_count { 0 };
 
     Vector<GC::Ref<FinalizationRegistry>> m_finalization_registry_cleanup_jobs;
 
@@ -366,9 +417,18 @@ private:
 
     u32 m_execution_generation { 0 };
 
+    u64 m_next_environment_serial_number { 1 };
+
     OwnPtr<Agent> m_agent;
 
     OwnPtr<Bytecode::Interpreter> m_bytecode_interpreter;
+    OwnPtr<Bytecode::MegamorphicPropertyCache> m_megamorphic_property_cache;
+
+    OwnPtr<SamplingProfiler> m_sampling_profiler;
+    Atomic<bool> m_profiler_sample_requested { false };
+
+    // NB: Holds GC roots, so it must be destroyed before m_heap.
+    OwnPtr<CompiledProgramCache> m_compiled_program_cache;
 
     bool m_dynamic_imports_allowed { false };
 };
@@ -28,6 +28,8 @@ use std::rc::Rc;
 
 use std::collections::HashMap;
 
+use crate::parser::FunctionReparseContext;
+
 // =============================================================================
 // Function table (side table for FunctionData)
 // =============================================================================
@@ -94,7 +96,7 @@ impl FunctionTable {
     }
 
     /// Take ownership if the slot is still present; returns None if already taken.
-    fn try_take(&mut self, id: FunctionId) -> Option<Box<FunctionData>> {
+    pub(crate) fn try_take(&mut self, id: FunctionId) -> Option<Box<FunctionData>> {
         self.functions.remove(&id)
     }
 
@@ -452,11 +454,56 @@ impl FunctionTable {
     }
 }
 
-/// Bundles a `FunctionData` with a subtable of all nested functions
-/// reachable from its body. Stored as the raw pointer in C++ SFDs.
-pub struct FunctionPayload {
-    pub data: FunctionData,
-    pub function_table: FunctionTable,
+/// What a C++ SFD holds on to until its function is compiled. Stored as the
+/// raw pointer in C++ SFDs.
+pub enum FunctionPayload {
+    /// The function's AST, bundled with a subtable of all nested functions
+    /// reachable from its body.
+    Parsed {
+        data: FunctionData,
+        function_table: FunctionTable,
+    },
+    /// The function will be parsed again from its source text when it's
+    /// compiled, which is much smaller than its AST for functions that are
+    /// never called.
+    Unparsed {
+        context: FunctionReparseContext,
+        outer_bindings: Vec<OuterBinding>,
+    },
+}
+
+/// How a name that a function uses but doesn't declare was resolved by the
+/// scope analysis of the code around the function.
+#[derive(Clone, Debug)]
+pub struct OuterBinding {
+    pub name: Utf16String,
+    pub declaration_kind: Option<DeclarationKind>,
+    pub is_global: bool,
+    pub is_inside_scope_with_eval: bool,
+}
+
+impl OuterBinding {
+    pub fn from_probe(probe: &Identifier) -> Self {
+        Self {
+            name: probe.name.clone(),
+            declaration_kind: probe.declaration_kind.get(),
+            is_global: probe.is_global.get(),
+            is_inside_scope_with_eval: probe.is_inside_scope_with_eval.get(),
+        }
+    }
+
+    /// Annotate an identifier the same way as the outer scopes did the first time around.
+    pub fn apply_to(&self, identifier: &Identifier) {
+        if let Some(declaration_kind) = self.declaration_kind {
+            identifier.declaration_kind.set(Some(declaration_kind));
+        }
+        if self.is_inside_scope_with_eval {
+            identifier.is_inside_scope_with_eval.set(true);
+        }
+        if self.is_global && !identifier.is_inside_scope_with_eval.get() {
+            identifier.is_global.set(true);
+        }
+    }
 }
 
 // =============================================================================
@@ -550,14 +597,14 @@ impl Utf16String {
     }
 }
 
-#[derive(Clone, Copy, Debug)]
+#[derive(Clone, Copy, Debug, Default)]
 pub struct Position {
     pub line: u32,
     pub column: u32,
     pub offset: u32,
 }
 
-#[derive(Clone, Copy, Debug)]
+#[derive(Clone, Copy, Debug, Default)]
 pub struct SourceRange {
     pub start: Position,
     pub end: Position,
@@ -802,6 +849,9 @@ pub struct FunctionData {
     pub is_strict_mode: bool,
     pub is_arrow_function: bool,
     pub parsing_insights: FunctionParsingInsights,
+    /// Set for function declarations and expressions, which can be parsed
+    /// again instead of keeping their AST until they're compiled.
+    pub reparse_context: Option<FunctionReparseContext>,
 }
 
 // =============================================================================
@@ -1275,6 +1325,10 @@ pub struct FunctionScopeData {
     pub has_lexically_declared_arguments: bool,
     pub non_local_var_count: usize,
     pub non_local_var_count_for_parameter_expressions: usize,
+    /// One identifier for each name the function uses but doesn't declare,
+    /// which is never part of the AST. The scope analysis of the outer scopes
+    /// annotates it like the real uses, see `OuterBinding`.
+    pub outer_binding_probes: Vec<Rc<Identifier>>,
 }
 
 /// Reference to a function declaration that needs hoisting/initialization.
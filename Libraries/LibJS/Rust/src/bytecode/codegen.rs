@@ -6110,6 +6110,7 @@ fn generate_class_expression(
                                 uses_this_from_environment: true,
                                 ..Default::default()
                             },
+                            reparse_context: None,
                         });
                         let index =
                             emit_new_function(generator, function_data, Some(utf16!("field")));
@@ -6186,6 +6187,7 @@ fn generate_class_expression(
                         uses_this_from_environment: true,
                         ..Default::default()
                     },
+                    reparse_context: None,
                 });
                 let sfd_index = super::ffi::FFIOptionalU32::some(emit_new_function(
                     generator,
@@ -6319,6 +6321,8 @@ fn emit_default_constructor(generator: &mut Generator, has_super: bool) -> u32 {
     // not part of the original source code buffer.
     function_data.source_text_start = 0;
     function_data.source_text_end = 0;
+    // The synthetic source is gone by the time the constructor is compiled.
+    function_data.reparse_context = None;
 
     let subtable = parser.function_table.extract_reachable(&function_data);
     let sfd_ptr = unsafe {
@@ -357,11 +357,37 @@ pub unsafe fn create_shared_function_data(
         let uses_this = function_data.parsing_insights.uses_this;
         let uses_this_from_environment = function_data.parsing_insights.uses_this_from_environment;
 
-        let payload = Box::new(crate::ast::FunctionPayload {
-            data: *function_data,
-            function_table: subtable,
-        });
-        let rust_ast_ptr = Box::into_raw(payload) as *mut c_void;
+        // NB: Declarations and expressions are parsed again when they're compiled,
+        //     so their AST can be dropped as soon as the SFD exists. The name and
+        //     parameter name slices above point into it until then.
+        let (payload, ast_to_drop) = if let Some(context) = function_data.reparse_context {
+            let outer_bindings = match &function_data.body.inner {
+                crate::ast::StatementKind::FunctionBody { scope, .. } => scope
+                    .borrow()
+                    .function_scope_data
+                    .as_ref()
+                    .map(|fsd| {
+                        fsd.outer_binding_probes
+                            .iter()
+                            .map(|probe| crate::ast::OuterBinding::from_probe(probe))
+                            .collect()
+                    })
+                    .unwrap_or_default(),
+                _ => Vec::new(),
+            };
+            let payload = crate::ast::FunctionPayload::Unparsed {
+                context,
+                outer_bindings,
+            };
+            (payload, Some((function_data, subtable)))
+        } else {
+            let payload = crate::ast::FunctionPayload::Parsed {
+                data: *function_data,
+                function_table: subtable,
+            };
+            (payload, None)
+        };
+        let rust_ast_ptr = Box::into_raw(Box::new(payload)) as *mut c_void;
 
         let ffi_data = FFISharedFunctionData {
             name: name_ptr,
@@ -382,6 +408,7 @@ pub unsafe fn create_shared_function_data(
         };
 
         let sfd_ptr = rust_create_sfd(vm_ptr, source_code_ptr, &raw const ffi_data);
+        drop(ast_to_drop);
 
         assert!(
             !sfd_ptr.is_null(),
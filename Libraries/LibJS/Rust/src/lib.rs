@@ -884,6 +884,9 @@ pub unsafe extern "C" fn rust_compile_dynamic_function(
             // Dynamic functions always need an arguments object, matching the C++
             // path in FunctionConstructor::create_dynamic_function.
             function_data.parsing_insights.might_need_arguments_object = true;
+            // NB: Parsing the function again would lose the above, and it's about
+            //     to be called anyway.
+            function_data.reparse_context = None;
 
             let is_strict = function_data.is_strict_mode;
             let subtable = parser.function_table.extract_reachable(&function_data);
@@ -2007,13 +2010,13 @@ fn for_each_bound_name_in_pattern(pattern: &ast::BindingPattern, f: &mut dyn FnM
 // FFI entry points: memory management and function compilation
 // =============================================================================
 
-/// Free a `Box<FunctionData>` stored in a C++ SharedFunctionInstanceData.
+/// Free a `Box<FunctionPayload>` stored in a C++ SharedFunctionInstanceData.
 ///
 /// Called from the SFD's `finalize()` or `clear_compile_inputs()` when the
 /// AST is no longer needed.
 ///
 /// # Safety
-/// `ast` must be a valid pointer returned by `Box::into_raw(Box<FunctionData>)`.
+/// `ast` must be a valid pointer returned by `Box::into_raw(Box<FunctionPayload>)`.
 #[unsafe(no_mangle)]
 pub unsafe extern "C" fn rust_free_function_ast(ast: *mut c_void) {
     unsafe {
@@ -2042,20 +2045,23 @@ pub unsafe extern "C" fn rust_free_string(ptr: *mut u8, len: usize) {
 
 /// Compile a function body.
 ///
-/// Takes ownership of the `Box<FunctionData>` and compiles it into a
-/// C++ `Bytecode::Executable`. Also populates FDI runtime metadata on the
-/// `SharedFunctionInstanceData`.
+/// Takes ownership of the `Box<FunctionPayload>` and compiles it into a
+/// C++ `Bytecode::Executable`, parsing the function again from `source` if
+/// its AST wasn't kept. Also populates FDI runtime metadata on the
+/// `SharedFunctionInstanceData`. Returns null if the function could not be
+/// parsed again.
 ///
 /// # Safety
 /// - `vm_ptr` must be a valid `JS::VM*`.
 /// - `source_code_ptr` must be a valid `JS::SourceCode const*`.
 /// - `sfd_ptr` must be a valid `JS::SharedFunctionInstanceData*`.
-/// - `rust_function_ast` must be a valid `Box<FunctionData>` pointer.
+/// - `source`/`source_len` must be the source code the function was parsed from.
+/// - `rust_function_ast` must be a valid `Box<FunctionPayload>` pointer.
 #[unsafe(no_mangle)]
 pub unsafe extern "C" fn rust_compile_function(
     vm_ptr: *mut c_void,
     source_code_ptr: *const c_void,
-    _source: *const u16,
+    source: *const u16,
     source_len: usize,
     sfd_ptr: *mut c_void,
     rust_function_ast: *mut c_void,
@@ -2067,7 +2073,26 @@ pub unsafe extern "C" fn rust_compile_function(
                 return std::ptr::null_mut();
             }
             let payload = Box::from_raw(rust_function_ast as *mut ast::FunctionPayload);
-            let function_data = Box::new(payload.data);
+            let (function_data, function_table) = match *payload {
+                ast::FunctionPayload::Parsed {
+                    data,
+                    function_table,
+                } => (Box::new(data), function_table),
+                ast::FunctionPayload::Unparsed {
+                    context,
+                    outer_bindings,
+                } => {
+                    let Some(source_slice) = source_from_raw(source, source_len) else {
+                        return std::ptr::null_mut();
+                    };
+                    let mut parser = Parser::new(source_slice, context.program_type);
+                    let Some(function_data) = parser.reparse_function(&context, &outer_bindings)
+                    else {
+                        return std::ptr::null_mut();
+                    };
+                    (function_data, parser.function_table)
+                }
+            };
 
             let body_scope = match &function_data.body.inner {
                 StatementKind::FunctionBody { scope, .. } => Some(scope),
@@ -2083,7 +2108,7 @@ pub unsafe extern "C" fn rust_compile_function(
             generator.strict = function_data.is_strict_mode;
             generator.function_environment_needed = sfd_metadata.function_environment_needed;
             generator.builtin_abstract_operations_enabled = builtin_abstract_operations_enabled;
-            generator.function_table = payload.function_table;
+            generator.function_table = function_table;
             generator.vm_ptr = vm_ptr;
             generator.source_code_ptr = source_code_ptr;
             generator.source_len = source_len;
@@ -37,8 +37,9 @@ use std::collections::{HashMap, HashSet};
 use std::rc::Rc;
 
 use crate::ast::{
-    BindingPattern, Expression, ExpressionKind, FunctionParameter, FunctionTable, Identifier,
-    PrivateIdentifier, ProgramData, ScopeData, SourceRange, Statement, StatementKind, Utf16String,
+    BindingPattern, Expression, ExpressionKind, FunctionData, FunctionParameter, FunctionTable,
+    Identifier, OuterBinding, PrivateIdentifier, ProgramData, ScopeData, SourceRange, Statement,
+    StatementKind, Utf16String,
 };
 use crate::lexer::{Lexer, ch};
 use crate::scope_collector::{ScopeCollector, ScopeCollectorState};
@@ -180,7 +181,7 @@ pub struct ParseError {
 }
 
 /// Boolean flags that are saved/restored during speculative parsing.
-#[derive(Clone, Copy, Default)]
+#[derive(Clone, Copy, Debug, Default)]
 pub(crate) struct ParserFlags {
     pub strict_mode: bool,
     pub allow_super_property_lookup: bool,
@@ -206,6 +207,21 @@ pub(crate) struct ParserFlags {
     pub in_property_key_context: bool,
 }
 
+/// The parser state at the start of a function declaration or expression.
+///
+/// This is enough to parse the function again from the same source text once
+/// it is about to be compiled, so its AST doesn't have to be kept around until
+/// then. See `Parser::reparse_function()`.
+#[derive(Clone, Copy, Debug)]
+pub struct FunctionReparseContext {
+    pub start: Position,
+    pub program_type: ProgramType,
+    pub(crate) flags: ParserFlags,
+    pub is_declaration: bool,
+    pub has_default_export_name: bool,
+    pub in_class_body: bool,
+}
+
 /// Snapshot of parser state for speculative parsing (backtracking).
 struct SavedState {
     token: Token,
@@ -963,6 +979,78 @@ impl<'a> Parser<'a> {
         matches!(&expression.inner, ExpressionKind::Update(_))
     }
 
+    pub(crate) fn function_reparse_context(&self, is_declaration: bool) -> FunctionReparseContext {
+        FunctionReparseContext {
+            start: self.position(),
+            program_type: self.program_type,
+            flags: self.flags,
+            is_declaration,
+            has_default_export_name: self.has_default_export_name,
+            in_class_body: self.class_scope_depth > 0,
+        }
+    }
+
+    /// Parse a function declaration or expression again from its source text,
+    /// which must be the same text it was first parsed from.
+    ///
+    /// The function's own scopes are analyzed as usual. Names it doesn't declare
+    /// itself are resolved using `outer_bindings`, which were recorded when the
+    /// code around it was analyzed, so the result matches the original parse.
+    ///
+    /// Returns `None` if the function doesn't parse the same way again, e.g.
+    /// because the saved context doesn't reproduce the original parser state.
+    /// The caller reports that as a `SyntaxError` rather than aborting.
+    pub fn reparse_function(
+        &mut self,
+        context: &FunctionReparseContext,
+        outer_bindings: &[OuterBinding],
+    ) -> Option<Box<FunctionData>> {
+        // NB: The lexer advances the column as it reads the first code unit.
+        self.lexer = Lexer::new_at_offset(
+            self.source,
+            context.start.offset as usize,
+            context.start.line,
+            context.start.column - 1,
+        );
+        if self.program_type == ProgramType::Module {
+            self.lexer.disallow_html_comments();
+        }
+        self.current_token = self.lexer.next();
+        self.flags = context.flags;
+        self.has_default_export_name = context.has_default_export_name;
+        // NB: Private names were already checked against the enclosing class
+        //     bodies, so all that matters here is that they're allowed at all.
+        if context.in_class_body {
+            self.class_scope_depth = 1;
+            self.referenced_private_names_stack.push(HashSet::new());
+        }
+
+        // The function's free names end up in this scope, where they are resolved
+        // from outer_bindings instead of being looked up as globals.
+        self.scope_collector.open_program_scope(ProgramType::Script);
+        let function_id = if context.is_declaration {
+            match self.parse_function_declaration().inner {
+                StatementKind::FunctionDeclaration(declaration) => Some(declaration.function_id),
+                _ => None,
+            }
+        } else {
+            match self.parse_function_expression().inner {
+                ExpressionKind::Function(function_id) => Some(function_id),
+                _ => None,
+            }
+        };
+        self.scope_collector.close_scope();
+
+        if self.has_errors() || self.scope_collector.has_errors() {
+            return None;
+        }
+        let function_id = function_id?;
+        self.scope_collector
+            .analyze_reparsed_function(outer_bindings);
+
+        self.function_table.try_take(function_id)
+    }
+
     // === Main entry point ===
 
     pub fn parse_program(&mut self, starts_in_strict_mode: bool) -> Statement {
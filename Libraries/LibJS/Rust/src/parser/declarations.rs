@@ -374,6 +374,7 @@ impl Parser<'_> {
         let start = self.position();
         let declaration_line = self.current_token().line_number;
         let declaration_column = self.current_token().line_column;
+        let reparse_context = self.function_reparse_context(true);
 
         let saved_might_need_arguments = self.flags.function_might_need_arguments_object;
         self.flags.function_might_need_arguments_object = false;
@@ -419,8 +420,9 @@ impl Parser<'_> {
         };
         self.scope_collector.open_function_scope(fn_name_for_scope);
         self.scope_collector.set_is_function_declaration();
+        self.scope_collector.set_may_be_reparsed();
 
-        let fd = self.parse_function_common(
+        let mut fd = self.parse_function_common(
             name,
             &fn_name,
             kind,
@@ -429,6 +431,7 @@ impl Parser<'_> {
             start,
             saved_might_need_arguments,
         );
+        fd.reparse_context = Some(reparse_context);
         let decl_name = fd.name.clone();
         let decl_kind = fd.kind;
         let function_id = self.function_table.insert(fd);
@@ -449,6 +452,7 @@ impl Parser<'_> {
     // (not the enclosing scope), allowing recursive self-reference.
     pub(crate) fn parse_function_expression(&mut self) -> Expression {
         let start = self.position();
+        let reparse_context = self.function_reparse_context(false);
 
         let saved_might_need_arguments = self.flags.function_might_need_arguments_object;
         self.flags.function_might_need_arguments_object = false;
@@ -489,8 +493,9 @@ impl Parser<'_> {
             Some(fn_name_value.as_slice())
         };
         self.scope_collector.open_function_scope(fn_name_for_scope);
+        self.scope_collector.set_may_be_reparsed();
 
-        let fd = self.parse_function_common(
+        let mut fd = self.parse_function_common(
             name,
             &fn_name_value,
             kind,
@@ -499,6 +504,7 @@ impl Parser<'_> {
             start,
             saved_might_need_arguments,
         );
+        fd.reparse_context = Some(reparse_context);
         let function_id = self.function_table.insert(fd);
         self.expression(start, ExpressionKind::Function(function_id))
     }
@@ -589,6 +595,7 @@ impl Parser<'_> {
             is_strict_mode: self.flags.strict_mode || has_use_strict,
             is_arrow_function: false,
             parsing_insights: insights,
+            reparse_context: None,
         }
     }
 
@@ -828,6 +835,7 @@ impl Parser<'_> {
                     uses_this_from_environment: true,
                     ..FunctionParsingInsights::default()
                 },
+                reparse_context: None,
             });
             self.expression(start, ExpressionKind::Function(function_id))
         } else {
@@ -851,6 +859,7 @@ impl Parser<'_> {
                     uses_this_from_environment: true,
                     ..FunctionParsingInsights::default()
                 },
+                reparse_context: None,
             });
             self.expression(start, ExpressionKind::Function(function_id))
         }
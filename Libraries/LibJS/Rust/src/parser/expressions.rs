@@ -2521,6 +2521,7 @@ impl Parser<'_> {
                 is_strict_mode: self.flags.strict_mode || has_use_strict,
                 is_arrow_function: true,
                 parsing_insights: insights,
+                reparse_context: None,
             });
             Some(self.expression(start, ExpressionKind::Function(function_id)))
         } else {
@@ -2569,6 +2570,7 @@ impl Parser<'_> {
                 is_strict_mode: self.flags.strict_mode,
                 is_arrow_function: true,
                 parsing_insights: insights,
+                reparse_context: None,
             });
             Some(self.expression(start, ExpressionKind::Function(function_id)))
         }
@@ -2669,6 +2671,7 @@ impl Parser<'_> {
             is_strict_mode: self.flags.strict_mode || has_use_strict,
             is_arrow_function: false,
             parsing_insights: insights,
+            reparse_context: None,
         });
         self.expression(start, ExpressionKind::Function(function_id))
     }
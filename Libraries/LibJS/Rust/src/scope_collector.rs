@@ -54,8 +54,8 @@ use std::collections::{HashMap, HashSet};
 use std::rc::Rc;
 
 use crate::ast::{
-    FunctionScopeData, Identifier, LocalBinding, LocalVarKind, LocalVariable, ScopeData,
-    Utf16String, VarToInit,
+    FunctionScopeData, Identifier, LocalBinding, LocalVarKind, LocalVariable, OuterBinding,
+    ScopeData, SourceRange, Utf16String, VarToInit,
 };
 use crate::parser::{DeclarationKind, FunctionKind, ParseError, ProgramType};
 use crate::u32_from_usize;
@@ -209,6 +209,10 @@ struct ScopeRecord {
     is_function_declaration: bool,
     has_parameter_expressions: bool,
 
+    // Set for functions that can be parsed again on their own, see
+    // FunctionScopeData::outer_binding_probes.
+    outer_binding_probes: Option<Vec<Rc<Identifier>>>,
+
     // Tree (indices into ScopeCollector::records)
     parent: Option<usize>,
     top_level: Option<usize>,
@@ -240,6 +244,7 @@ impl ScopeRecord {
             is_arrow_function: false,
             is_function_declaration: false,
             has_parameter_expressions: false,
+            outer_binding_probes: None,
             parent: None,
             top_level: None,
             children: Vec::new(),
@@ -827,6 +832,11 @@ impl ScopeCollector {
         self.records[index].is_function_declaration = true;
     }
 
+    pub fn set_may_be_reparsed(&mut self) {
+        let index = self.current.expect("no current scope");
+        self.records[index].outer_binding_probes = Some(Vec::new());
+    }
+
     // === Getters ===
 
     pub fn contains_direct_call_to_eval(&self) -> bool {
@@ -911,6 +921,29 @@ impl ScopeCollector {
         }
     }
 
+    /// Analyze a function that was parsed again on its own (see
+    /// Parser::reparse_function). The program scope wrapping it only stands in
+    /// for the code around the function, so instead of resolving the names
+    /// that reach it, they get the annotations the first analysis gave them.
+    pub fn analyze_reparsed_function(&mut self, outer_bindings: &[OuterBinding]) {
+        if self.records.is_empty() {
+            return;
+        }
+        let children = std::mem::take(&mut self.records[0].children);
+        for child_index in children {
+            self.analyze_recursive(child_index, false, false);
+        }
+        let groups = std::mem::take(&mut self.records[0].identifier_groups);
+        for (name, group) in groups {
+            let Ok(binding_index) = outer_bindings.binary_search_by(|b| b.name.cmp(&name)) else {
+                continue;
+            };
+            for id in &group.identifiers {
+                outer_bindings[binding_index].apply_to(id);
+            }
+        }
+    }
+
     /// Analyze a scope and all its descendants, bottom-up.
     /// Children are analyzed first so that unresolved identifiers bubble up
     /// to their parent, and eval poisoning propagates outward.
@@ -1217,6 +1250,12 @@ impl ScopeCollector {
                     }
                 }
 
+                if let Some(ref mut probes) = records[index].outer_binding_probes {
+                    let probe = Rc::new(Identifier::new(SourceRange::default(), name.clone()));
+                    group.identifiers.push(probe.clone());
+                    probes.push(probe);
+                }
+
                 propagate_to_parent.push((name, group));
             }
         }
@@ -1343,6 +1382,7 @@ impl ScopeCollector {
             has_lexically_declared_arguments,
             non_local_var_count,
             non_local_var_count_for_parameter_expressions,
+            outer_binding_probes: record.outer_binding_probes.clone().unwrap_or_default(),
         };
 
         {
@@ -16,6 +16,7 @@
 #include <LibJS/Bytecode/PropertyKeyTable.h>
 #include <LibJS/Bytecode/RegexTable.h>
 #include <LibJS/Bytecode/StringTable.h>
+#include <LibJS/CompiledProgramCache.h>
 #include <LibJS/Runtime/BigInt.h>
 #include <LibJS/Runtime/Intrinsics.h>
 #include <LibJS/Runtime/NativeJavaScriptBackedFunction.h>
@@ -369,7 +370,7 @@ void free_parsed_program(ParsedProgram* parsed)
     rust_free_parsed_program(parsed);
 }
 
-Optional<Result<ScriptResult, Vector<ParserError>>> compile_parsed_script(ParsedProgram* parsed, NonnullRefPtr<SourceCode const> source_code, Realm& realm)
+static Optional<Result<ScriptResult, Vector<ParserError>>> compile_and_cache_parsed_script(ParsedProgram* parsed, NonnullRefPtr<SourceCode const> source_code, Realm& realm, size_t line_number_offset)
 {
     if (!parsed)
         return {};
@@ -392,21 +393,40 @@ Optional<Result<ScriptResult, Vector<ParserError>>> compile_parsed_script(Parsed
         return Vector<ParserError> {};
 
     builder.result.executable = static_cast<Bytecode::Executable*>(exec_ptr);
+    realm.vm().compiled_program_cache().add_script(move(source_code), line_number_offset, builder.result);
     return builder.result;
 }
 
+Optional<Result<ScriptResult, Vector<ParserError>>> compile_parsed_script(ParsedProgram* parsed, NonnullRefPtr<SourceCode const> source_code, Realm& realm, size_t line_number_offset)
+{
+    if (auto cached_result = realm.vm().compiled_program_cache().find_script(*source_code, line_number_offset); cached_result.has_value()) {
+        if (parsed)
+            rust_free_parsed_program(parsed);
+        return cached_result.release_value();
+    }
+
+    // NB: The caller may have skipped parsing because the cache had this program, but it has been evicted since.
+    if (!parsed)
+        parsed = rust_parse_program(source_code->utf16_data(), source_code->length_in_code_units(), static_cast<u8>(ProgramType::Script), line_number_offset, g_dump_ast, g_dump_ast_use_color);
+
+    return compile_and_cache_parsed_script(parsed, move(source_code), realm, line_number_offset);
+}
+
 Optional<Result<ScriptResult, Vector<ParserError>>> compile_script(StringView source_text, Realm& realm, StringView filename, size_t line_number_offset)
 {
     auto source_code = SourceCode::create(
         String::from_utf8(filename).release_value_but_fixme_should_propagate_errors(),
         Utf16String::from_utf8(source_text));
 
+    if (auto cached_result = realm.vm().compiled_program_cache().find_script(*source_code, line_number_offset); cached_result.has_value())
+        return cached_result.release_value();
+
     auto const* source_ptr = source_code->utf16_data();
     auto length = source_code->length_in_code_units();
 
     auto* parsed = rust_parse_program(source_ptr, length, static_cast<u8>(ProgramType::Script), line_number_offset, g_dump_ast, g_dump_ast_use_color);
 
-    return compile_parsed_script(parsed, source_code, realm);
+    return compile_and_cache_parsed_script(parsed, source_code, realm, line_number_offset);
 }
 
 Optional<Result<EvalResult, String>> compile_eval(
@@ -444,7 +464,7 @@ Optional<Result<EvalResult, String>> compile_eval(
     return result;
 }
 
-Optional<Result<ModuleResult, Vector<ParserError>>> compile_parsed_module(ParsedProgram* parsed, NonnullRefPtr<SourceCode const> source_code, Realm& realm)
+static Optional<Result<ModuleResult, Vector<ParserError>>> compile_and_cache_parsed_module(ParsedProgram* parsed, NonnullRefPtr<SourceCode const> source_code, Realm& realm)
 {
     if (!parsed)
         return {};
@@ -498,18 +518,37 @@ Optional<Result<ModuleResult, Vector<ParserError>>> compile_parsed_module(Parsed
         builder.result.executable = static_cast<Bytecode::Executable*>(exec_ptr);
     }
 
+    realm.vm().compiled_program_cache().add_module(move(source_code), builder.result);
     return builder.result;
 }
 
+Optional<Result<ModuleResult, Vector<ParserError>>> compile_parsed_module(ParsedProgram* parsed, NonnullRefPtr<SourceCode const> source_code, Realm& realm)
+{
+    if (auto cached_result = realm.vm().compiled_program_cache().find_module(*source_code); cached_result.has_value()) {
+        if (parsed)
+            rust_free_parsed_program(parsed);
+        return cached_result.release_value();
+    }
+
+    // NB: The caller may have skipped parsing because the cache had this program, but it has been evicted since.
+    if (!parsed)
+        parsed = rust_parse_program(source_code->utf16_data(), source_code->length_in_code_units(), static_cast<u8>(ProgramType::Module), 0, g_dump_ast, g_dump_ast_use_color);
+
+    return compile_and_cache_parsed_module(parsed, move(source_code), realm);
+}
+
 Optional<Result<ModuleResult, Vector<ParserError>>> compile_module(StringView source_text, Realm& realm, StringView filename)
 {
     auto source_code = SourceCode::create(String::from_utf8(filename).release_value_but_fixme_should_propagate_errors(), Utf16String::from_utf8(source_text));
 
+    if (auto cached_result = realm.vm().compiled_program_cache().find_module(*source_code); cached_result.has_value())
+        return cached_result.release_value();
+
     auto const* source_ptr = source_code->utf16_data();
     auto length = source_code->length_in_code_units();
     auto* parsed = rust_parse_program(source_ptr, length, static_cast<u8>(ProgramType::Module), 0, g_dump_ast, g_dump_ast_use_color);
 
-    return compile_parsed_module(parsed, source_code, realm);
+    return compile_and_cache_parsed_module(parsed, source_code, realm);
 }
 
 Optional<Result<GC::Ref<SharedFunctionInstanceData>, String>> compile_dynamic_function(
@@ -587,7 +626,9 @@ GC::Ptr<Bytecode::Executable> compile_function(VM& vm, SharedFunctionInstanceDat
     if (!shared_data.m_use_rust_compilation)
         return nullptr;
 
-    VERIFY(shared_data.m_rust_function_ast);
+    // NB: The AST is consumed by the first attempt, so there is nothing left to compile if that attempt failed.
+    if (!shared_data.m_rust_function_ast)
+        return nullptr;
     GC::DeferGC defer_gc(vm.heap());
     auto const* source_ptr = shared_data.m_source_code->utf16_data();
     auto* exec = static_cast<Bytecode::Executable*>(rust_compile_function(
@@ -600,6 +641,16 @@ GC::Ptr<Bytecode::Executable> compile_function(VM& vm, SharedFunctionInstanceDat
         builtin_abstract_operations_enabled));
     shared_data.m_rust_function_ast = nullptr;
 
+    auto& statistics = vm.lazy_compilation_statistics();
+    auto source_length = exchange(shared_data.m_source_length_awaiting_compilation, 0);
+    --statistics.functions_awaiting_compilation;
+    statistics.source_code_units_awaiting_compilation -= source_length;
+    if (!exec)
+        return nullptr;
+    ++statistics.functions_compiled;
+    statistics.source_code_units_compiled += source_length;
+    statistics.bytecode_bytes_compiled += exec->bytecode.size();
+
     return exec;
 }
 
@@ -616,7 +667,7 @@ void free_function_ast(void* ast)
 namespace JS::FFI {
 
 struct RustCompiledRegex {
-    String parsed_pattern;
+    NonnullRefPtr<JS::CompiledRegExp> compiled;
 };
 
 static Utf16View view_from_ffi(FFIUtf16Slice slice)
@@ -873,6 +924,13 @@ extern "C" void* rust_create_sfd(
         shared->m_source_text = code_view.substring_view(data->source_text_offset, data->source_text_length);
     }
 
+    if (data->rust_function_ast) {
+        shared->m_source_length_awaiting_compilation = static_cast<u32>(data->source_text_length);
+        auto& statistics = vm.lazy_compilation_statistics();
+        ++statistics.functions_awaiting_compilation;
+        statistics.source_code_units_awaiting_compilation += shared->m_source_length_awaiting_compilation;
+    }
+
     return shared.ptr();
 }
 
@@ -992,28 +1050,6 @@ extern "C" void* rust_compile_regex(
     auto pattern = JS::RustIntegration::utf16_view_from_bytes(pattern_data, pattern_len);
     auto flags_view = JS::RustIntegration::utf16_view_from_bytes(flags_data, flags_len);
 
-    // Extract unicode/unicode_sets from flags for parse_regex_pattern.
-    bool is_unicode = false;
-    bool is_unicode_sets = false;
-    for (size_t i = 0; i < flags_view.length_in_code_units(); ++i) {
-        auto ch = flags_view.code_unit_at(i);
-        if (ch == 'u')
-            is_unicode = true;
-        else if (ch == 'v')
-            is_unicode_sets = true;
-    }
-
-    auto parsed_pattern = JS::parse_regex_pattern(pattern, is_unicode, is_unicode_sets);
-    if (parsed_pattern.is_error()) {
-        auto msg = MUST(String::formatted("RegExp compile error: {}", parsed_pattern.release_error().error));
-        auto* buf = static_cast<char*>(kmalloc(msg.byte_count() + 1));
-        memcpy(buf, msg.bytes().data(), msg.byte_count());
-        buf[msg.byte_count()] = '\0';
-        *error_out = buf;
-        return nullptr;
-    }
-    auto pattern_str = parsed_pattern.release_value();
-
     // Build compile flags from the flag characters.
     regex::ECMAScriptCompileFlags compile_flags {};
     for (size_t i = 0; i < flags_view.length_in_code_units(); ++i) {
@@ -1048,7 +1084,8 @@ extern "C" void* rust_compile_regex(
         }
     }
 
-    auto compiled = regex::ECMAScriptRegex::compile(pattern_str.bytes_as_string_view(), compile_flags);
+    // NB: This goes through the process-wide cache, so evaluating the literal later finds the program compiled here.
+    auto compiled = JS::RegExpCache::the().get_or_compile(Utf16String::from_utf16(pattern), compile_flags);
     if (compiled.is_error()) {
         auto msg = MUST(String::formatted("RegExp compile error: {}", compiled.release_error()));
         auto* buf = static_cast<char*>(kmalloc(msg.byte_count() + 1));
@@ -1058,7 +1095,7 @@ extern "C" void* rust_compile_regex(
         return nullptr;
     }
 
-    return new RustCompiledRegex { move(pattern_str) };
+    return new RustCompiledRegex { compiled.release_value() };
 }
 
 extern "C" void rust_free_compiled_regex(void* ptr)
@@ -96,9 +96,9 @@ JS_API bool parsed_program_has_errors(FFI::ParsedProgram const*);
 JS_API void free_parsed_program(FFI::ParsedProgram*);
 
 // Compile a previously parsed script. Must be called on the main thread.
-// Consumes and frees the Rust ParsedProgram.
+// Consumes and frees the Rust ParsedProgram. If parsed is null, the script is parsed here, unless it's cached.
 // Returns nullopt if Rust is not available.
-Optional<Result<ScriptResult, Vector<ParserError>>> compile_parsed_script(FFI::ParsedProgram* parsed, NonnullRefPtr<SourceCode const> source_code, Realm& realm);
+Optional<Result<ScriptResult, Vector<ParserError>>> compile_parsed_script(FFI::ParsedProgram* parsed, NonnullRefPtr<SourceCode const> source_code, Realm& realm, size_t line_number_offset);
 
 // Compile a script. Returns nullopt if Rust is not available.
 Optional<Result<ScriptResult, Vector<ParserError>>> compile_script(StringView source_text, Realm& realm, StringView filename, size_t line_number_offset);
@@ -111,7 +111,7 @@ Optional<Result<EvalResult, String>> compile_eval(
     bool in_derived_constructor, bool in_class_field_initializer);
 
 // Compile a previously parsed module. Must be called on the main thread.
-// Consumes and frees the Rust ParsedProgram.
+// Consumes and frees the Rust ParsedProgram. If parsed is null, the module is parsed here, unless it's cached.
 // Returns nullopt if Rust is not available.
 Optional<Result<ModuleResult, Vector<ParserError>>> compile_parsed_module(FFI::ParsedProgram* parsed, NonnullRefPtr<SourceCode const> source_code, Realm& realm);
 
@@ -129,7 +129,8 @@ Optional<Vector<GC::Root<SharedFunctionInstanceData>>> compile_builtin_file(
     unsigned char const* script_text, VM& vm);
 
 // Compile a function body for lazy compilation.
-// Returns nullptr if Rust is not available or the SFD doesn't use Rust compilation.
+// Returns nullptr if Rust is not available, the SFD doesn't use Rust compilation, or a function whose AST was dropped
+// could not be parsed again from its source.
 GC::Ptr<Bytecode::Executable> compile_function(VM& vm, SharedFunctionInstanceData& shared_data, bool builtin_abstract_operations_enabled);
 
 // Free a Rust function AST pointer. No-op if Rust is not available.
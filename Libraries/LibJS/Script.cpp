@@ -31,10 +31,10 @@ Result<GC::Ref<Script>, Vector<ParserError>> Script::parse(StringView source_tex
     return realm.heap().allocate<Script>(realm, filename, move(rust_compilation->value()), host_defined);
 }
 
-Result<GC::Ref<Script>, Vector<ParserError>> Script::create_from_parsed(FFI::ParsedProgram* parsed, NonnullRefPtr<SourceCode const> source_code, Realm& realm, HostDefined* host_defined)
+Result<GC::Ref<Script>, Vector<ParserError>> Script::create_from_parsed(FFI::ParsedProgram* parsed, NonnullRefPtr<SourceCode const> source_code, Realm& realm, size_t line_number_offset, HostDefined* host_defined)
 {
     auto filename = source_code->filename();
-    auto rust_compilation = RustIntegration::compile_parsed_script(parsed, move(source_code), realm);
+    auto rust_compilation = RustIntegration::compile_parsed_script(parsed, move(source_code), realm, line_number_offset);
     if (!rust_compilation.has_value())
         return Vector<ParserError> {};
     if (rust_compilation->is_error())
@@ -415,7 +415,7 @@ InstantiationResult AbstractMachine::instantiate(Module const& module, Vector<Ex
                     };
                 }
                 if (!data.init.is_empty())
-                    instance->data().overwrite(offset, data.init.data(), data.init.size());
+                    instance->bytes().overwrite(offset, data.init.data(), data.init.size());
                 return {};
             },
             [&](DataSection::Data::Passive const& passive) -> Optional<InstantiationError> {
@@ -560,6 +560,7 @@ Result AbstractMachine::invoke(Interpreter& interpreter, FunctionAddress address
     Configuration configuration { m_store };
     if (m_should_limit_instruction_count)
         configuration.enable_instruction_count_limit();
+    configuration.set_can_block(m_can_block);
 
     Vector<Value, ArgumentsStaticSize> args = move(arguments);
     return configuration.call(interpreter, address, args);
@@ -10,9 +10,12 @@
 #include <AK/Function.h>
 #include <AK/HashMap.h>
 #include <AK/HashTable.h>
+#include <AK/Atomic.h>
 #include <AK/NonnullOwnPtr.h>
+#include <AK/ScopeGuard.h>
 #include <AK/StackInfo.h>
 #include <AK/UFixedBigInt.h>
+#include <LibThreading/Mutex.h>
 #include <LibWasm/Export.h>
 #include <LibWasm/Types.h>
 
@@ -463,14 +466,38 @@ public:
     {
         MemoryInstance instance { type };
 
+        // A shared memory may be accessed by other threads while it grows, so its buffer must never move. Reserve all
+        // the space it can ever grow into up front, see reserve_for_growth().
+        if (type.limits().is_shared()) {
+            instance.m_grow_lock = make<Threading::Mutex>();
+            instance.reserve_for_growth();
+            if (instance.m_data.capacity() < type.limits().min() * Constants::page_size)
+                return Error::from_string_literal("Failed to reserve space for shared memory");
+        }
+
         if (!instance.grow(type.limits().min() * Constants::page_size, GrowType::No))
             return Error::from_string_literal("Failed to grow to requested size");
 
+        instance.m_should_reserve_on_grow = !instance.is_shared();
         return { move(instance) };
     }
 
-    auto& type() const { return m_type; }
-    auto size() const { return m_size; }
+    // NB: The type of a shared memory is updated by grow(), which may be running on another thread.
+    MemoryType type() const
+    {
+        if (!m_grow_lock)
+            return m_type;
+        Threading::MutexLocker locker { *m_grow_lock };
+        return m_type;
+    }
+    bool is_shared() const { return m_is_shared; }
+    // NB: The size of a shared memory may be changed by another thread at any time. It only ever increases though, and
+    //     the buffer never moves, so a stale size is still a valid bound for accesses.
+    auto size() const { return AK::atomic_load(&m_size, AK::memory_order_relaxed); }
+    // NB: The contents of the memory, bounded by size(). Accesses must go through these rather than data(), since the
+    //     size of the underlying buffer is written by grow() without synchronizing with other threads.
+    Bytes bytes() { return { m_data.data(), size() }; }
+    ReadonlyBytes bytes() const { return { m_data.data(), size() }; }
     auto& data() const { return m_data; }
     auto& data() { return m_data; }
 
@@ -488,7 +515,15 @@ public:
     {
         if (size_to_grow == 0)
             return true;
-        u64 new_size = m_data.size() + size_to_grow;
+
+        if (m_grow_lock)
+            m_grow_lock->lock();
+        ScopeGuard unlock_grow_lock = [&] {
+            if (m_grow_lock)
+                m_grow_lock->unlock();
+        };
+
+        u64 new_size = m_size + size_to_grow;
         // Can't grow past 2^16 pages.
         if (new_size >= Constants::page_size * 65536)
             return false;
@@ -496,12 +531,18 @@ public:
             if (max.value() * Constants::page_size < new_size)
                 return false;
         }
+        // A shared memory can only grow into the space reserved for it, as moving it would pull it out from under
+        // the other threads.
+        if (is_shared() && new_size > m_data.capacity())
+            return false;
         auto previous_size = m_size;
+        if (m_should_reserve_on_grow)
+            reserve_for_growth();
         if (m_data.try_resize(new_size).is_error())
             return false;
-        m_size = new_size;
         // The spec requires that we zero out everything on grow
         __builtin_memset(m_data.offset_pointer(previous_size), 0, size_to_grow);
+        AK::atomic_store(&m_size, static_cast<size_t>(new_size), AK::memory_order_release);
 
         // NOTE: This exists because wasm-js-api wants to execute code after a successful grow,
         //       See [this issue](https://github.com/WebAssembly/spec/issues/1635) for more details.
@@ -513,7 +554,7 @@ public:
             //
             // See relevant spec link:
             // https://www.w3.org/TR/wasm-core-2/#growing-memories%E2%91%A0
-            m_type = MemoryType { Limits(m_type.limits().address_type(), m_type.limits().min() + size_to_grow / Constants::page_size, m_type.limits().max()) };
+            m_type = MemoryType { Limits(m_type.limits().address_type(), m_type.limits().min() + size_to_grow / Constants::page_size, m_type.limits().max(), m_type.limits().share()) };
         }
 
         return true;
@@ -524,12 +565,36 @@ public:
 private:
     explicit MemoryInstance(MemoryType const& type)
         : m_type(type)
+        , m_is_shared(type.limits().is_shared())
+    {
+    }
+
+    // A memory that is grown after instantiation is likely to keep growing, and every reallocation of the buffer has to
+    // copy all of its contents. So on the first such grow, we reserve enough capacity for the memory to reach its maximum
+    // size without being moved again. The OS only commits the pages of such a large allocation once they're written to,
+    // i.e. as the memory actually grows into them, so this costs address space rather than memory.
+    void reserve_for_growth()
     {
+        m_should_reserve_on_grow = false;
+
+        auto maximum_pages = min(m_type.limits().max().value_or(65536), Constants::max_memory_reservation / Constants::page_size);
+        auto maximum_size = maximum_pages * Constants::page_size;
+        if (maximum_size <= m_data.capacity())
+            return;
+
+        // NOTE: If the reservation fails, the buffer will simply keep growing as needed. A shared memory can't move
+        //       though, so it is then limited to the capacity it has.
+        (void)m_data.try_ensure_capacity(maximum_size);
     }
 
+    // Only ever accessed while holding m_grow_lock for shared memories.
     MemoryType m_type;
+    bool m_is_shared { false };
     size_t m_size { 0 };
     ByteBuffer m_data;
+    bool m_should_reserve_on_grow { false };
+    // Only set for shared memories, serializes concurrent grows from different threads.
+    OwnPtr<Threading::Mutex> m_grow_lock;
 };
 
 class GlobalInstance {
@@ -723,6 +788,9 @@ public:
     auto& store() { return m_store; }
 
     void enable_instruction_count_limit() { m_should_limit_instruction_count = true; }
+    // Embedders whose agent can't suspend (e.g. the main thread of a window) must disallow blocking, which makes
+    // memory.atomic.wait trap instead.
+    void set_can_block(bool can_block) { m_can_block = can_block; }
 
     void visit_external_resources(HostVisitOps const&);
 
@@ -757,6 +825,7 @@ private:
     StackInfo m_stack_info;
     HashTable<Interpreter*> m_active_interpreters;
     bool m_should_limit_instruction_count { false };
+    bool m_can_block { true };
 };
 
 class WASM_API Linker {
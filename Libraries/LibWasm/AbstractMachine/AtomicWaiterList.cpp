@@ -0,0 +1,101 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/Atomic.h>
+#include <LibThreading/ConditionVariable.h>
+#include <LibWasm/AbstractMachine/AtomicWaiterList.h>
+
+namespace Wasm {
+
+struct AtomicWaiterList::Waiter {
+    explicit Waiter(Threading::Mutex& mutex)
+        : condition(mutex)
+    {
+    }
+
+    Threading::ConditionVariable condition;
+    bool notified { false };
+};
+
+AtomicWaiterList& AtomicWaiterList::the()
+{
+    static AtomicWaiterList s_the;
+    return s_the;
+}
+
+template<typename T>
+AtomicWaiterList::WaitResult AtomicWaiterList::wait_impl(T const volatile* address, T expected, Optional<AK::Duration> timeout)
+{
+    Threading::MutexLocker locker { m_mutex };
+
+    // NB: Notifiers take the same lock, so a store followed by a notify can't slip in between this load and the wait.
+    if (AK::atomic_load(address) != expected)
+        return WaitResult::NotEqual;
+
+    auto key = reinterpret_cast<FlatPtr>(address);
+    Waiter waiter { m_mutex };
+    m_waiters.ensure(key).append(&waiter);
+
+    if (!timeout.has_value()) {
+        while (!waiter.notified)
+            waiter.condition.wait();
+        return WaitResult::Ok;
+    }
+
+    auto deadline = MonotonicTime::now() + *timeout;
+    while (!waiter.notified) {
+        auto remaining = deadline - MonotonicTime::now();
+        if (remaining <= AK::Duration::zero())
+            break;
+        (void)waiter.condition.wait_for(remaining);
+    }
+
+    if (waiter.notified)
+        return WaitResult::Ok;
+
+    auto it = m_waiters.find(key);
+    VERIFY(it != m_waiters.end());
+    it->value.remove_first_matching([&](auto* entry) { return entry == &waiter; });
+    if (it->value.is_empty())
+        m_waiters.remove(it);
+
+    return WaitResult::TimedOut;
+}
+
+AtomicWaiterList::WaitResult AtomicWaiterList::wait(u32 const volatile* address, u32 expected, Optional<AK::Duration> timeout)
+{
+    return wait_impl(address, expected, timeout);
+}
+
+AtomicWaiterList::WaitResult AtomicWaiterList::wait(u64 const volatile* address, u64 expected, Optional<AK::Duration> timeout)
+{
+    return wait_impl(address, expected, timeout);
+}
+
+u32 AtomicWaiterList::notify(void const volatile* address, u32 count)
+{
+    Threading::MutexLocker locker { m_mutex };
+
+    auto it = m_waiters.find(reinterpret_cast<FlatPtr>(address));
+    if (it == m_waiters.end())
+        return 0;
+
+    auto& waiters = it->value;
+    u32 woken = 0;
+    while (woken < count && !waiters.is_empty()) {
+        auto* waiter = waiters.take_first();
+        waiter->notified = true;
+        waiter->condition.signal();
+        ++woken;
+    }
+
+    if (waiters.is_empty())
+        m_waiters.remove(it);
+
+    return woken;
+}
+
+}
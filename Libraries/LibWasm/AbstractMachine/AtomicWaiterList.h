@@ -0,0 +1,55 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/HashMap.h>
+#include <AK/Noncopyable.h>
+#include <AK/Optional.h>
+#include <AK/Time.h>
+#include <AK/Vector.h>
+#include <LibThreading/Mutex.h>
+#include <LibWasm/Export.h>
+
+namespace Wasm {
+
+// https://webassembly.github.io/threads/core/exec/runtime.html#waiter-queues
+// The threads blocked in memory.atomic.wait, keyed by the address they're waiting on. A shared memory never moves (see
+// MemoryInstance), so the host address of a cell identifies it across every store and thread of the process.
+class WASM_API AtomicWaiterList {
+    AK_MAKE_NONCOPYABLE(AtomicWaiterList);
+    AK_MAKE_NONMOVABLE(AtomicWaiterList);
+
+public:
+    static AtomicWaiterList& the();
+
+    // The values returned by memory.atomic.wait.
+    enum class WaitResult : u32 {
+        Ok = 0,
+        NotEqual = 1,
+        TimedOut = 2,
+    };
+
+    // Blocks until the cell at address is notified, unless it doesn't hold the expected value. An empty timeout waits forever.
+    WaitResult wait(u32 const volatile* address, u32 expected, Optional<AK::Duration> timeout);
+    WaitResult wait(u64 const volatile* address, u64 expected, Optional<AK::Duration> timeout);
+
+    // Wakes up to count threads waiting on address, in the order they started waiting. Returns how many were woken.
+    u32 notify(void const volatile* address, u32 count);
+
+private:
+    AtomicWaiterList() = default;
+
+    struct Waiter;
+
+    template<typename T>
+    WaitResult wait_impl(T const volatile* address, T expected, Optional<AK::Duration> timeout);
+
+    Threading::Mutex m_mutex;
+    HashMap<FlatPtr, Vector<Waiter*>> m_waiters;
+};
+
+}
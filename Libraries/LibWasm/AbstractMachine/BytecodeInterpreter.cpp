@@ -5,6 +5,7 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <AK/Atomic.h>
 #include <AK/Bitmap.h>
 #include <AK/ByteReader.h>
 #include <AK/Debug.h>
@@ -20,6 +21,7 @@
 #include <AK/Time.h>
 #include <LibCore/File.h>
 #include <LibWasm/AbstractMachine/AbstractMachine.h>
+#include <LibWasm/AbstractMachine/AtomicWaiterList.h>
 #include <LibWasm/AbstractMachine/BytecodeInterpreter.h>
 #include <LibWasm/AbstractMachine/Configuration.h>
 #include <LibWasm/AbstractMachine/Operators.h>
@@ -80,6 +82,37 @@ struct ConvertToRaw<double> {
     u64 operator()(double value) const { return bit_cast<LittleEndian<u64>>(value); }
 };
 
+// The read-modify-write operations of the threads proposal, each returns the value the cell held before.
+struct AtomicAdd {
+    template<typename T>
+    static T operator()(T volatile* cell, T value) { return AK::atomic_fetch_add(cell, value); }
+};
+
+struct AtomicSub {
+    template<typename T>
+    static T operator()(T volatile* cell, T value) { return AK::atomic_fetch_sub(cell, value); }
+};
+
+struct AtomicAnd {
+    template<typename T>
+    static T operator()(T volatile* cell, T value) { return AK::atomic_fetch_and(cell, value); }
+};
+
+struct AtomicOr {
+    template<typename T>
+    static T operator()(T volatile* cell, T value) { return AK::atomic_fetch_or(cell, value); }
+};
+
+struct AtomicXor {
+    template<typename T>
+    static T operator()(T volatile* cell, T value) { return AK::atomic_fetch_xor(cell, value); }
+};
+
+struct AtomicExchange {
+    template<typename T>
+    static T operator()(T volatile* cell, T value) { return AK::atomic_exchange(cell, value); }
+};
+
 #define TRAP_IF_NOT(x, ...)                                                                    \
     do {                                                                                       \
         if (trap_if_not(x, #x##sv __VA_OPT__(, ) __VA_ARGS__)) {                               \
@@ -2419,7 +2452,7 @@ HANDLE_INSTRUCTION(memory_fill)
 
         Checked<u64> checked_end = destination_offset;
         checked_end += count;
-        TRAP_IN_LOOP_IF_NOT(!checked_end.has_overflow() && static_cast<size_t>(checked_end.value()) <= instance->data().size());
+        TRAP_IN_LOOP_IF_NOT(!checked_end.has_overflow() && static_cast<size_t>(checked_end.value()) <= instance->size());
 
         if (count == 0)
             TAILCALL return continue_(HANDLER_PARAMS(DECOMPOSE_PARAMS_NAME_ONLY));
@@ -2450,21 +2483,21 @@ HANDLE_INSTRUCTION(memory_copy)
 
     auto source_position = saturating_add(static_cast<size_t>(source_offset), static_cast<size_t>(count));
     auto destination_position = saturating_add(static_cast<size_t>(destination_offset), static_cast<size_t>(count));
-    TRAP_IN_LOOP_IF_NOT(source_position <= source_instance->data().size());
-    TRAP_IN_LOOP_IF_NOT(destination_position <= destination_instance->data().size());
+    TRAP_IN_LOOP_IF_NOT(source_position <= source_instance->size());
+    TRAP_IN_LOOP_IF_NOT(destination_position <= destination_instance->size());
 
     if (count == 0)
         TAILCALL return continue_(HANDLER_PARAMS(DECOMPOSE_PARAMS_NAME_ONLY));
 
     if (destination_offset <= source_offset) {
         for (auto i = 0; i < count; ++i) {
-            auto value = source_instance->data()[source_offset + i];
+            auto value = source_instance->bytes()[source_offset + i];
             if (interpreter.store_to_memory(*destination_instance, destination_offset + i, value))
                 return Outcome::Return;
         }
     } else {
         for (auto i = count - 1; i >= 0; --i) {
-            auto value = source_instance->data()[source_offset + i];
+            auto value = source_instance->bytes()[source_offset + i];
             if (interpreter.store_to_memory(*destination_instance, destination_offset + i, value))
                 return Outcome::Return;
         }
@@ -2490,7 +2523,7 @@ HANDLE_INSTRUCTION(memory_init)
     auto source_position = saturating_add(static_cast<size_t>(source_offset), static_cast<size_t>(count));
     auto destination_position = saturating_add(static_cast<size_t>(destination_offset), static_cast<size_t>(count));
     TRAP_IN_LOOP_IF_NOT(source_position <= data.data().size());
-    TRAP_IN_LOOP_IF_NOT(destination_position <= memory->data().size());
+    TRAP_IN_LOOP_IF_NOT(destination_position <= memory->size());
 
     if (count == 0)
         TAILCALL return continue_(HANDLER_PARAMS(DECOMPOSE_PARAMS_NAME_ONLY));
@@ -5063,212 +5096,813 @@ HANDLE_INSTRUCTION(i32x4_relaxed_dot_i8x16_i7x16_add_s)
     TAILCALL return continue_(HANDLER_PARAMS(DECOMPOSE_PARAMS_NAME_ONLY));
 }
 
-HANDLE_INSTRUCTION(throw_ref)
+HANDLE_INSTRUCTION(memory_atomic_notify)
 {
     LOG_INSN;
-    interpreter.set_trap("Not Implemented: Proposal 'Exception-handling'"sv);
-    return Outcome::Return;
+    LOAD_ADDRESSES();
+    if (interpreter.atomic_notify(configuration, *instruction, addresses))
+        return Outcome::Return;
+    TAILCALL return continue_(HANDLER_PARAMS(DECOMPOSE_PARAMS_NAME_ONLY));
 }
 
-HANDLE_INSTRUCTION(throw_)
+HANDLE_INSTRUCTION(memory_atomic_wait32)
 {
     LOG_INSN;
-    {
-        auto tag_address = configuration.frame().module().tags()[instruction->arguments().get<TagIndex>().value()];
-        auto& tag_instance = *configuration.store().get(tag_address);
-        auto& type = tag_instance.type();
-        auto values = Vector<Value>(configuration.value_stack().span().slice_from_end(type.parameters().size()));
-        configuration.value_stack().shrink(configuration.value_stack().size() - type.parameters().size());
-        auto exception_address = configuration.store().allocate(tag_instance, move(values));
-        if (!exception_address.has_value()) {
-            interpreter.set_trap("Out of memory"sv);
-            return Outcome::Return;
-        }
-        configuration.value_stack().append(Value(Reference { Reference::Exception { *exception_address } }));
-    }
-    TAILCALL return InstructionHandler<Instructions::throw_ref.value()>::operator()<HasDynamicInsnLimit, Continue, SourceAddressMix::Any>(HANDLER_PARAMS(DECOMPOSE_PARAMS_NAME_ONLY));
+    LOAD_ADDRESSES();
+    if (interpreter.atomic_wait<u32>(configuration, *instruction, addresses))
+        return Outcome::Return;
+    TAILCALL return continue_(HANDLER_PARAMS(DECOMPOSE_PARAMS_NAME_ONLY));
 }
 
-HANDLE_INSTRUCTION(try_table)
+HANDLE_INSTRUCTION(memory_atomic_wait64)
 {
     LOG_INSN;
-    interpreter.set_trap("Not Implemented: Proposal 'Exception-handling'"sv);
-    return Outcome::Return;
+    LOAD_ADDRESSES();
+    if (interpreter.atomic_wait<u64>(configuration, *instruction, addresses))
+        return Outcome::Return;
+    TAILCALL return continue_(HANDLER_PARAMS(DECOMPOSE_PARAMS_NAME_ONLY));
 }
 
-template<u64 opcode, bool HasDynamicInsnLimit, typename Continue, SourceAddressMix mix, typename... Args>
-constexpr static auto handle_instruction(Args&&... a)
+HANDLE_INSTRUCTION(atomic_fence)
 {
-    return InstructionHandler<opcode>::template operator()<HasDynamicInsnLimit, Continue, mix>(forward<Args>(a)...);
+    LOG_INSN;
+    AK::atomic_thread_fence(AK::memory_order_seq_cst);
+    TAILCALL return continue_(HANDLER_PARAMS(DECOMPOSE_PARAMS_NAME_ONLY));
 }
 
-template<bool HasCompiledList, bool HasDynamicInsnLimit, bool HaveDirectThreadingInfo>
-FLATTEN void BytecodeInterpreter::interpret_impl(Configuration& configuration, Expression const& expression)
+HANDLE_INSTRUCTION(i32_atomic_load)
 {
-    auto& instructions = expression.instructions();
-    u64 executed_instructions = 0;
-    ShortenedIP short_ip { .current_ip_value = static_cast<u32>(configuration.ip()) };
-
-    auto cc = expression.compiled_instructions.dispatches.data();
-    auto addresses_ptr = expression.compiled_instructions.src_dst_mappings.data();
-
-    if constexpr (HaveDirectThreadingInfo) {
-        static_assert(HasCompiledList, "Direct threading requires a compiled instruction list");
-        auto const instruction = cc[short_ip.current_ip_value].instruction;
-        auto const handler = bit_cast<Outcome (*)(HANDLER_PARAMS(DECOMPOSE_PARAMS_TYPE_ONLY))>(cc[short_ip.current_ip_value].handler_ptr);
-        handler(*this, configuration, instruction, short_ip, cc, addresses_ptr);
-        return;
-    }
+    LOG_INSN;
+    LOAD_ADDRESSES();
+    if (interpreter.atomic_load_and_push<u32, i32, source_address_mix>(configuration, *instruction, addresses))
+        return Outcome::Return;
+    TAILCALL return continue_(HANDLER_PARAMS(DECOMPOSE_PARAMS_NAME_ONLY));
+}
 
-    while (true) {
-        if constexpr (HasDynamicInsnLimit) {
-            if (executed_instructions++ >= Constants::max_allowed_executed_instructions_per_call) [[unlikely]] {
-                m_trap = Trap::from_string("Exceeded maximum allowed number of instructions");
-                return;
-            }
-        }
-        // bounds checked by loop condition.
-        auto const instruction = HasCompiledList
-            ? cc[short_ip.current_ip_value].instruction
-            : &instructions.data()[short_ip.current_ip_value];
-        auto const opcode = (HasCompiledList && !HaveDirectThreadingInfo
-                ? cc[short_ip.current_ip_value].instruction_opcode
-                : instruction->opcode())
-                                .value();
+HANDLE_INSTRUCTION(i64_atomic_load)
+{
+    LOG_INSN;
+    LOAD_ADDRESSES();
+    if (interpreter.atomic_load_and_push<u64, i64, source_address_mix>(configuration, *instruction, addresses))
+        return Outcome::Return;
+    TAILCALL return continue_(HANDLER_PARAMS(DECOMPOSE_PARAMS_NAME_ONLY));
+}
 
-#define RUN_NEXT_INSTRUCTION()       \
-    {                                \
-        ++short_ip.current_ip_value; \
-        break;                       \
-    }
+HANDLE_INSTRUCTION(i32_atomic_load8_u)
+{
+    LOG_INSN;
+    LOAD_ADDRESSES();
+    if (interpreter.atomic_load_and_push<u8, i32, source_address_mix>(configuration, *instruction, addresses))
+        return Outcome::Return;
+    TAILCALL return continue_(HANDLER_PARAMS(DECOMPOSE_PARAMS_NAME_ONLY));
+}
 
-#define HANDLE_INSTRUCTION_NEW(name, ...)                                                                                                                                                \
-    case Instructions::name.value(): {                                                                                                                                                   \
-        auto outcome = handle_instruction<Instructions::name.value(), HasDynamicInsnLimit, Skip, SourceAddressMix::Any>(*this, configuration, instruction, short_ip, cc, addresses_ptr); \
-        if (outcome == Outcome::Return)                                                                                                                                                  \
-            return;                                                                                                                                                                      \
-        short_ip.current_ip_value = to_underlying(outcome);                                                                                                                              \
-        if constexpr (first_is_one_of(Instructions::name, Instructions::return_call, Instructions::return_call_indirect, Instructions::return_call_ref)) {                               \
-            cc = configuration.frame().expression().compiled_instructions.dispatches.data();                                                                                             \
-            addresses_ptr = configuration.frame().expression().compiled_instructions.src_dst_mappings.data();                                                                            \
-        }                                                                                                                                                                                \
-        RUN_NEXT_INSTRUCTION();                                                                                                                                                          \
-    }
+HANDLE_INSTRUCTION(i32_atomic_load16_u)
+{
+    LOG_INSN;
+    LOAD_ADDRESSES();
+    if (interpreter.atomic_load_and_push<u16, i32, source_address_mix>(configuration, *instruction, addresses))
+        return Outcome::Return;
+    TAILCALL return continue_(HANDLER_PARAMS(DECOMPOSE_PARAMS_NAME_ONLY));
+}
 
-        dbgln_if(WASM_TRACE_DEBUG, "Executing instruction {} at current_ip_value {}", instruction_name(instruction->opcode()), short_ip.current_ip_value);
-        if ((opcode & Instructions::SyntheticInstructionBase.value()) != Instructions::SyntheticInstructionBase.value())
-            __builtin_prefetch(&instruction->arguments(), /* read */ 0, /* low temporal locality */ 1);
+HANDLE_INSTRUCTION(i64_atomic_load8_u)
+{
+    LOG_INSN;
+    LOAD_ADDRESSES();
+    if (interpreter.atomic_load_and_push<u8, i64, source_address_mix>(configuration, *instruction, addresses))
+        return Outcome::Return;
+    TAILCALL return continue_(HANDLER_PARAMS(DECOMPOSE_PARAMS_NAME_ONLY));
+}
 
-        switch (opcode) {
-            ENUMERATE_WASM_OPCODES(HANDLE_INSTRUCTION_NEW)
-        default:
-            dbgln("Bad opcode {} in insn {} (ip {})", opcode, instruction_name(instruction->opcode()), short_ip.current_ip_value);
-            VERIFY_NOT_REACHED();
-        }
-    }
+HANDLE_INSTRUCTION(i64_atomic_load16_u)
+{
+    LOG_INSN;
+    LOAD_ADDRESSES();
+    if (interpreter.atomic_load_and_push<u16, i64, source_address_mix>(configuration, *instruction, addresses))
+        return Outcome::Return;
+    TAILCALL return continue_(HANDLER_PARAMS(DECOMPOSE_PARAMS_NAME_ONLY));
 }
 
-template<bool NeedsStackAdjustment>
-InstructionPointer BytecodeInterpreter::branch_to_label(Configuration& configuration, LabelIndex index, InstructionPointer current_ip, bool actually_branching)
+HANDLE_INSTRUCTION(i64_atomic_load32_u)
 {
-    dbgln_if(WASM_TRACE_DEBUG, "Branch to label with index {}...", index.value());
-    auto& label_stack = configuration.label_stack();
-    label_stack.unsafe_shrink(actually_branching ? label_stack.size() - index.value() : label_stack.size());
-    auto const& label = configuration.label_stack().unsafe_last();
-    dbgln_if(WASM_TRACE_DEBUG, "...which is actually IP {}, and has {} result(s)", label.continuation().value(), label.arity());
+    LOG_INSN;
+    LOAD_ADDRESSES();
+    if (interpreter.atomic_load_and_push<u32, i64, source_address_mix>(configuration, *instruction, addresses))
+        return Outcome::Return;
+    TAILCALL return continue_(HANDLER_PARAMS(DECOMPOSE_PARAMS_NAME_ONLY));
+}
 
-    if constexpr (NeedsStackAdjustment) {
-        if (actually_branching)
-            configuration.value_stack().remove(label.stack_height(), configuration.value_stack().size() - label.stack_height() - label.arity());
-    }
-    return actually_branching ? label.continuation().value() - 1 : current_ip;
+HANDLE_INSTRUCTION(i32_atomic_store)
+{
+    LOG_INSN;
+    LOAD_ADDRESSES();
+    if (interpreter.atomic_pop_and_store<i32, u32>(configuration, *instruction, addresses))
+        return Outcome::Return;
+    TAILCALL return continue_(HANDLER_PARAMS(DECOMPOSE_PARAMS_NAME_ONLY));
 }
 
-template<typename ReadType, typename PushType, SourceAddressMix mix>
-bool BytecodeInterpreter::load_and_push(Configuration& configuration, Instruction const& instruction, SourcesAndDestination const& addresses)
+HANDLE_INSTRUCTION(i64_atomic_store)
 {
-    auto& arg = instruction.arguments().unsafe_get<Instruction::MemoryArgument>();
-    auto& address = configuration.frame().module().memories().data()[arg.memory_index.value()];
-    auto memory = configuration.store().unsafe_get(address);
-    auto& entry = configuration.source_value<mix>(0, addresses.sources); // bounds checked by verifier.
-    auto base = entry.template to<i32>();
-    u64 instance_address = static_cast<u64>(bit_cast<u32>(base)) + arg.offset;
-    dbgln_if(WASM_TRACE_DEBUG, "load({} : {}) -> stack", instance_address, sizeof(ReadType));
-    if (instance_address + sizeof(ReadType) > memory->size()) {
-        m_trap = Trap::from_string("Memory access out of bounds");
-        dbgln_if(WASM_TRACE_DEBUG, "LibWasm: load_and_push - Memory access out of bounds (expected {} to be less than or equal to {})", instance_address + sizeof(ReadType), memory->size());
-        return true;
-    }
-    auto slice = memory->data().bytes().slice(instance_address, sizeof(ReadType));
-    entry = Value(static_cast<PushType>(read_value<ReadType>(slice)));
-    dbgln_if(WASM_TRACE_DEBUG, "  loaded value: {}", entry.value());
-    return false;
+    LOG_INSN;
+    LOAD_ADDRESSES();
+    if (interpreter.atomic_pop_and_store<i64, u64>(configuration, *instruction, addresses))
+        return Outcome::Return;
+    TAILCALL return continue_(HANDLER_PARAMS(DECOMPOSE_PARAMS_NAME_ONLY));
 }
 
-template<typename TDst, typename TSrc>
-ALWAYS_INLINE static TDst convert_vector(TSrc v)
+HANDLE_INSTRUCTION(i32_atomic_store8)
 {
-    return __builtin_convertvector(v, TDst);
+    LOG_INSN;
+    LOAD_ADDRESSES();
+    if (interpreter.atomic_pop_and_store<i32, u8>(configuration, *instruction, addresses))
+        return Outcome::Return;
+    TAILCALL return continue_(HANDLER_PARAMS(DECOMPOSE_PARAMS_NAME_ONLY));
 }
 
-template<size_t M, size_t N, template<typename> typename SetSign>
-bool BytecodeInterpreter::load_and_push_mxn(Configuration& configuration, Instruction const& instruction, SourcesAndDestination const& addresses)
+HANDLE_INSTRUCTION(i32_atomic_store16)
 {
-    auto& arg = instruction.arguments().unsafe_get<Instruction::MemoryArgument>();
-    auto& address = configuration.frame().module().memories().data()[arg.memory_index.value()];
-    auto memory = configuration.store().unsafe_get(address);
-    auto& entry = configuration.source_value<SourceAddressMix::Any>(0, addresses.sources); // bounds checked by verifier.
-    auto base = entry.template to<i32>();
-    u64 instance_address = static_cast<u64>(bit_cast<u32>(base)) + arg.offset;
-    dbgln_if(WASM_TRACE_DEBUG, "vec-load({} : {}) -> stack", instance_address, M * N / 8);
-    if (instance_address + M * N / 8 > memory->size()) {
-        m_trap = Trap::from_string("Memory access out of bounds");
-        dbgln("LibWasm: load_and_push_mxn - Memory access out of bounds (expected {} to be less than or equal to {})", instance_address + M * N / 8, memory->size());
-        return true;
-    }
-    auto slice = memory->data().bytes().slice(instance_address, M * N / 8);
-    using V64 = NativeVectorType<M, N, SetSign>;
-    using V128 = NativeVectorType<M * 2, N, SetSign>;
+    LOG_INSN;
+    LOAD_ADDRESSES();
+    if (interpreter.atomic_pop_and_store<i32, u16>(configuration, *instruction, addresses))
+        return Outcome::Return;
+    TAILCALL return continue_(HANDLER_PARAMS(DECOMPOSE_PARAMS_NAME_ONLY));
+}
 
-    V64 bytes { 0 };
-    if (bit_cast<FlatPtr>(slice.data()) % sizeof(V64) == 0)
-        bytes = *bit_cast<V64*>(slice.data());
-    else
-        ByteReader::load(slice.data(), bytes);
+HANDLE_INSTRUCTION(i64_atomic_store8)
+{
+    LOG_INSN;
+    LOAD_ADDRESSES();
+    if (interpreter.atomic_pop_and_store<i64, u8>(configuration, *instruction, addresses))
+        return Outcome::Return;
+    TAILCALL return continue_(HANDLER_PARAMS(DECOMPOSE_PARAMS_NAME_ONLY));
+}
 
-    entry = Value(bit_cast<u128>(convert_vector<V128>(bytes)));
-    dbgln_if(WASM_TRACE_DEBUG, "  loaded value: {}", entry.value());
-    return false;
+HANDLE_INSTRUCTION(i64_atomic_store16)
+{
+    LOG_INSN;
+    LOAD_ADDRESSES();
+    if (interpreter.atomic_pop_and_store<i64, u16>(configuration, *instruction, addresses))
+        return Outcome::Return;
+    TAILCALL return continue_(HANDLER_PARAMS(DECOMPOSE_PARAMS_NAME_ONLY));
 }
 
-template<size_t N>
-bool BytecodeInterpreter::load_and_push_lane_n(Configuration& configuration, Instruction const& instruction, SourcesAndDestination const& addresses)
+HANDLE_INSTRUCTION(i64_atomic_store32)
 {
-    auto memarg_and_lane = instruction.arguments().unsafe_get<Instruction::MemoryAndLaneArgument>();
-    auto& address = configuration.frame().module().memories().data()[memarg_and_lane.memory.memory_index.value()];
-    auto memory = configuration.store().unsafe_get(address);
-    // bounds checked by verifier.
-    auto vector = configuration.take_source<SourceAddressMix::Any>(0, addresses.sources).template to<u128>();
-    auto base = configuration.take_source<SourceAddressMix::Any>(1, addresses.sources).template to<u32>();
-    u64 instance_address = static_cast<u64>(bit_cast<u32>(base)) + memarg_and_lane.memory.offset;
-    dbgln_if(WASM_TRACE_DEBUG, "load-lane({} : {}, lane {}) -> stack", instance_address, N / 8, memarg_and_lane.lane);
-    if (instance_address + N / 8 > memory->size()) {
-        m_trap = Trap::from_string("Memory access out of bounds");
-        dbgln("LibWasm: load_and_push_lane_n - Memory access out of bounds (expected {} to be less than or equal to {})", instance_address + N / 8, memory->size());
-        return true;
-    }
-    auto slice = memory->data().bytes().slice(instance_address, N / 8);
-    auto dst = bit_cast<u8*>(&vector) + memarg_and_lane.lane * N / 8;
-    memcpy(dst, slice.data(), N / 8);
-    dbgln_if(WASM_TRACE_DEBUG, "  loaded value: {}", vector);
-    configuration.push_to_destination<SourceAddressMix::Any>(Value(vector), addresses.destination);
-    return false;
+    LOG_INSN;
+    LOAD_ADDRESSES();
+    if (interpreter.atomic_pop_and_store<i64, u32>(configuration, *instruction, addresses))
+        return Outcome::Return;
+    TAILCALL return continue_(HANDLER_PARAMS(DECOMPOSE_PARAMS_NAME_ONLY));
 }
 
-template<size_t N>
-bool BytecodeInterpreter::load_and_push_zero_n(Configuration& configuration, Instruction const& instruction, SourcesAndDestination const& addresses)
+HANDLE_INSTRUCTION(i32_atomic_rmw_add)
 {
-    auto memarg_and_lane = instruction.arguments().unsafe_get<Instruction::MemoryArgument>();
+    LOG_INSN;
+    LOAD_ADDRESSES();
+    if (interpreter.atomic_read_modify_write<i32, u32, AtomicAdd>(configuration, *instruction, addresses))
+        return Outcome::Return;
+    TAILCALL return continue_(HANDLER_PARAMS(DECOMPOSE_PARAMS_NAME_ONLY));
+}
+
+HANDLE_INSTRUCTION(i64_atomic_rmw_add)
+{
+    LOG_INSN;
+    LOAD_ADDRESSES();
+    if (interpreter.atomic_read_modify_write<i64, u64, AtomicAdd>(configuration, *instruction, addresses))
+        return Outcome::Return;
+    TAILCALL return continue_(HANDLER_PARAMS(DECOMPOSE_PARAMS_NAME_ONLY));
+}
+
+HANDLE_INSTRUCTION(i32_atomic_rmw8_add_u)
+{
+    LOG_INSN;
+    LOAD_ADDRESSES();
+    if (interpreter.atomic_read_modify_write<i32, u8, AtomicAdd>(configuration, *instruction, addresses))
+        return Outcome::Return;
+    TAILCALL return continue_(HANDLER_PARAMS(DECOMPOSE_PARAMS_NAME_ONLY));
+}
+
+HANDLE_INSTRUCTION(i32_atomic_rmw16_add_u)
+{
+    LOG_INSN;
+    LOAD_ADDRESSES();
+    if (interpreter.atomic_read_modify_write<i32, u16, AtomicAdd>(configuration, *instruction, addresses))
+        return Outcome::Return;
+    TAILCALL return continue_(HANDLER_PARAMS(DECOMPOSE_PARAMS_NAME_ONLY));
+}
+
+HANDLE_INSTRUCTION(i64_atomic_rmw8_add_u)
+{
+    LOG_INSN;
+    LOAD_ADDRESSES();
+    if (interpreter.atomic_read_modify_write<i64, u8, AtomicAdd>(configuration, *instruction, addresses))
+        return Outcome::Return;
+    TAILCALL return continue_(HANDLER_PARAMS(DECOMPOSE_PARAMS_NAME_ONLY));
+}
+
+HANDLE_INSTRUCTION(i64_atomic_rmw16_add_u)
+{
+    LOG_INSN;
+    LOAD_ADDRESSES();
+    if (interpreter.atomic_read_modify_write<i64, u16, AtomicAdd>(configuration, *instruction, addresses))
+        return Outcome::Return;
+    TAILCALL return continue_(HANDLER_PARAMS(DECOMPOSE_PARAMS_NAME_ONLY));
+}
+
+HANDLE_INSTRUCTION(i64_atomic_rmw32_add_u)
+{
+    LOG_INSN;
+    LOAD_ADDRESSES();
+    if (interpreter.atomic_read_modify_write<i64, u32, AtomicAdd>(configuration, *instruction, addresses))
+        return Outcome::Return;
+    TAILCALL return continue_(HANDLER_PARAMS(DECOMPOSE_PARAMS_NAME_ONLY));
+}
+
+HANDLE_INSTRUCTION(i32_atomic_rmw_sub)
+{
+    LOG_INSN;
+    LOAD_ADDRESSES();
+    if (interpreter.atomic_read_modify_write<i32, u32, AtomicSub>(configuration, *instruction, addresses))
+        return Outcome::Return;
+    TAILCALL return continue_(HANDLER_PARAMS(DECOMPOSE_PARAMS_NAME_ONLY));
+}
+
+HANDLE_INSTRUCTION(i64_atomic_rmw_sub)
+{
+    LOG_INSN;
+    LOAD_ADDRESSES();
+    if (interpreter.atomic_read_modify_write<i64, u64, AtomicSub>(configuration, *instruction, addresses))
+        return Outcome::Return;
+    TAILCALL return continue_(HANDLER_PARAMS(DECOMPOSE_PARAMS_NAME_ONLY));
+}
+
+HANDLE_INSTRUCTION(i32_atomic_rmw8_sub_u)
+{
+    LOG_INSN;
+    LOAD_ADDRESSES();
+    if (interpreter.atomic_read_modify_write<i32, u8, AtomicSub>(configuration, *instruction, addresses))
+        return Outcome::Return;
+    TAILCALL return continue_(HANDLER_PARAMS(DECOMPOSE_PARAMS_NAME_ONLY));
+}
+
+HANDLE_INSTRUCTION(i32_atomic_rmw16_sub_u)
+{
+    LOG_INSN;
+    LOAD_ADDRESSES();
+    if (interpreter.atomic_read_modify_write<i32, u16, AtomicSub>(configuration, *instruction, addresses))
+        return Outcome::Return;
+    TAILCALL return continue_(HANDLER_PARAMS(DECOMPOSE_PARAMS_NAME_ONLY));
+}
+
+HANDLE_INSTRUCTION(i64_atomic_rmw8_sub_u)
+{
+    LOG_INSN;
+    LOAD_ADDRESSES();
+    if (interpreter.atomic_read_modify_write<i64, u8, AtomicSub>(configuration, *instruction, addresses))
+        return Outcome::Return;
+    TAILCALL return continue_(HANDLER_PARAMS(DECOMPOSE_PARAMS_NAME_ONLY));
+}
+
+HANDLE_INSTRUCTION(i64_atomic_rmw16_sub_u)
+{
+    LOG_INSN;
+    LOAD_ADDRESSES();
+    if (interpreter.atomic_read_modify_write<i64, u16, AtomicSub>(configuration, *instruction, addresses))
+        return Outcome::Return;
+    TAILCALL return continue_(HANDLER_PARAMS(DECOMPOSE_PARAMS_NAME_ONLY));
+}
+
+HANDLE_INSTRUCTION(i64_atomic_rmw32_sub_u)
+{
+    LOG_INSN;
+    LOAD_ADDRESSES();
+    if (interpreter.atomic_read_modify_write<i64, u32, AtomicSub>(configuration, *instruction, addresses))
+        return Outcome::Return;
+    TAILCALL return continue_(HANDLER_PARAMS(DECOMPOSE_PARAMS_NAME_ONLY));
+}
+
+HANDLE_INSTRUCTION(i32_atomic_rmw_and)
+{
+    LOG_INSN;
+    LOAD_ADDRESSES();
+    if (interpreter.atomic_read_modify_write<i32, u32, AtomicAnd>(configuration, *instruction, addresses))
+        return Outcome::Return;
+    TAILCALL return continue_(HANDLER_PARAMS(DECOMPOSE_PARAMS_NAME_ONLY));
+}
+
+HANDLE_INSTRUCTION(i64_atomic_rmw_and)
+{
+    LOG_INSN;
+    LOAD_ADDRESSES();
+    if (interpreter.atomic_read_modify_write<i64, u64, AtomicAnd>(configuration, *instruction, addresses))
+        return Outcome::Return;
+    TAILCALL return continue_(HANDLER_PARAMS(DECOMPOSE_PARAMS_NAME_ONLY));
+}
+
+HANDLE_INSTRUCTION(i32_atomic_rmw8_and_u)
+{
+    LOG_INSN;
+    LOAD_ADDRESSES();
+    if (interpreter.atomic_read_modify_write<i32, u8, AtomicAnd>(configuration, *instruction, addresses))
+        return Outcome::Return;
+    TAILCALL return continue_(HANDLER_PARAMS(DECOMPOSE_PARAMS_NAME_ONLY));
+}
+
+HANDLE_INSTRUCTION(i32_atomic_rmw16_and_u)
+{
+    LOG_INSN;
+    LOAD_ADDRESSES();
+    if (interpreter.atomic_read_modify_write<i32, u16, AtomicAnd>(configuration, *instruction, addresses))
+        return Outcome::Return;
+    TAILCALL return continue_(HANDLER_PARAMS(DECOMPOSE_PARAMS_NAME_ONLY));
+}
+
+HANDLE_INSTRUCTION(i64_atomic_rmw8_and_u)
+{
+    LOG_INSN;
+    LOAD_ADDRESSES();
+    if (interpreter.atomic_read_modify_write<i64, u8, AtomicAnd>(configuration, *instruction, addresses))
+        return Outcome::Return;
+    TAILCALL return continue_(HANDLER_PARAMS(DECOMPOSE_PARAMS_NAME_ONLY));
+}
+
+HANDLE_INSTRUCTION(i64_atomic_rmw16_and_u)
+{
+    LOG_INSN;
+    LOAD_ADDRESSES();
+    if (interpreter.atomic_read_modify_write<i64, u16, AtomicAnd>(configuration, *instruction, addresses))
+        return Outcome::Return;
+    TAILCALL return continue_(HANDLER_PARAMS(DECOMPOSE_PARAMS_NAME_ONLY));
+}
+
+HANDLE_INSTRUCTION(i64_atomic_rmw32_and_u)
+{
+    LOG_INSN;
+    LOAD_ADDRESSES();
+    if (interpreter.atomic_read_modify_write<i64, u32, AtomicAnd>(configuration, *instruction, addresses))
+        return Outcome::Return;
+    TAILCALL return continue_(HANDLER_PARAMS(DECOMPOSE_PARAMS_NAME_ONLY));
+}
+
+HANDLE_INSTRUCTION(i32_atomic_rmw_or)
+{
+    LOG_INSN;
+    LOAD_ADDRESSES();
+    if (interpreter.atomic_read_modify_write<i32, u32, AtomicOr>(configuration, *instruction, addresses))
+        return Outcome::Return;
+    TAILCALL return continue_(HANDLER_PARAMS(DECOMPOSE_PARAMS_NAME_ONLY));
+}
+
+HANDLE_INSTRUCTION(i64_atomic_rmw_or)
+{
+    LOG_INSN;
+    LOAD_ADDRESSES();
+    if (interpreter.atomic_read_modify_write<i64, u64, AtomicOr>(configuration, *instruction, addresses))
+        return Outcome::Return;
+    TAILCALL return continue_(HANDLER_PARAMS(DECOMPOSE_PARAMS_NAME_ONLY));
+}
+
+HANDLE_INSTRUCTION(i32_atomic_rmw8_or_u)
+{
+    LOG_INSN;
+    LOAD_ADDRESSES();
+    if (interpreter.atomic_read_modify_write<i32, u8, AtomicOr>(configuration, *instruction, addresses))
+        return Outcome::Return;
+    TAILCALL return continue_(HANDLER_PARAMS(DECOMPOSE_PARAMS_NAME_ONLY));
+}
+
+HANDLE_INSTRUCTION(i32_atomic_rmw16_or_u)
+{
+    LOG_INSN;
+    LOAD_ADDRESSES();
+    if (interpreter.atomic_read_modify_write<i32, u16, AtomicOr>(configuration, *instruction, addresses))
+        return Outcome::Return;
+    TAILCALL return continue_(HANDLER_PARAMS(DECOMPOSE_PARAMS_NAME_ONLY));
+}
+
+HANDLE_INSTRUCTION(i64_atomic_rmw8_or_u)
+{
+    LOG_INSN;
+    LOAD_ADDRESSES();
+    if (interpreter.atomic_read_modify_write<i64, u8, AtomicOr>(configuration, *instruction, addresses))
+        return Outcome::Return;
+    TAILCALL return continue_(HANDLER_PARAMS(DECOMPOSE_PARAMS_NAME_ONLY));
+}
+
+HANDLE_INSTRUCTION(i64_atomic_rmw16_or_u)
+{
+    LOG_INSN;
+    LOAD_ADDRESSES();
+    if (interpreter.atomic_read_modify_write<i64, u16, AtomicOr>(configuration, *instruction, addresses))
+        return Outcome::Return;
+    TAILCALL return continue_(HANDLER_PARAMS(DECOMPOSE_PARAMS_NAME_ONLY));
+}
+
+HANDLE_INSTRUCTION(i64_atomic_rmw32_or_u)
+{
+    LOG_INSN;
+    LOAD_ADDRESSES();
+    if (interpreter.atomic_read_modify_write<i64, u32, AtomicOr>(configuration, *instruction, addresses))
+        return Outcome::Return;
+    TAILCALL return continue_(HANDLER_PARAMS(DECOMPOSE_PARAMS_NAME_ONLY));
+}
+
+HANDLE_INSTRUCTION(i32_atomic_rmw_xor)
+{
+    LOG_INSN;
+    LOAD_ADDRESSES();
+    if (interpreter.atomic_read_modify_write<i32, u32, AtomicXor>(configuration, *instruction, addresses))
+        return Outcome::Return;
+    TAILCALL return continue_(HANDLER_PARAMS(DECOMPOSE_PARAMS_NAME_ONLY));
+}
+
+HANDLE_INSTRUCTION(i64_atomic_rmw_xor)
+{
+    LOG_INSN;
+    LOAD_ADDRESSES();
+    if (interpreter.atomic_read_modify_write<i64, u64, AtomicXor>(configuration, *instruction, addresses))
+        return Outcome::Return;
+    TAILCALL return continue_(HANDLER_PARAMS(DECOMPOSE_PARAMS_NAME_ONLY));
+}
+
+HANDLE_INSTRUCTION(i32_atomic_rmw8_xor_u)
+{
+    LOG_INSN;
+    LOAD_ADDRESSES();
+    if (interpreter.atomic_read_modify_write<i32, u8, AtomicXor>(configuration, *instruction, addresses))
+        return Outcome::Return;
+    TAILCALL return continue_(HANDLER_PARAMS(DECOMPOSE_PARAMS_NAME_ONLY));
+}
+
+HANDLE_INSTRUCTION(i32_atomic_rmw16_xor_u)
+{
+    LOG_INSN;
+    LOAD_ADDRESSES();
+    if (interpreter.atomic_read_modify_write<i32, u16, AtomicXor>(configuration, *instruction, addresses))
+        return Outcome::Return;
+    TAILCALL return continue_(HANDLER_PARAMS(DECOMPOSE_PARAMS_NAME_ONLY));
+}
+
+HANDLE_INSTRUCTION(i64_atomic_rmw8_xor_u)
+{
+    LOG_INSN;
+    LOAD_ADDRESSES();
+    if (interpreter.atomic_read_modify_write<i64, u8, AtomicXor>(configuration, *instruction, addresses))
+        return Outcome::Return;
+    TAILCALL return continue_(HANDLER_PARAMS(DECOMPOSE_PARAMS_NAME_ONLY));
+}
+
+HANDLE_INSTRUCTION(i64_atomic_rmw16_xor_u)
+{
+    LOG_INSN;
+    LOAD_ADDRESSES();
+    if (interpreter.atomic_read_modify_write<i64, u16, AtomicXor>(configuration, *instruction, addresses))
+        return Outcome::Return;
+    TAILCALL return continue_(HANDLER_PARAMS(DECOMPOSE_PARAMS_NAME_ONLY));
+}
+
+HANDLE_INSTRUCTION(i64_atomic_rmw32_xor_u)
+{
+    LOG_INSN;
+    LOAD_ADDRESSES();
+    if (interpreter.atomic_read_modify_write<i64, u32, AtomicXor>(configuration, *instruction, addresses))
+        return Outcome::Return;
+    TAILCALL return continue_(HANDLER_PARAMS(DECOMPOSE_PARAMS_NAME_ONLY));
+}
+
+HANDLE_INSTRUCTION(i32_atomic_rmw_xchg)
+{
+    LOG_INSN;
+    LOAD_ADDRESSES();
+    if (interpreter.atomic_read_modify_write<i32, u32, AtomicExchange>(configuration, *instruction, addresses))
+        return Outcome::Return;
+    TAILCALL return continue_(HANDLER_PARAMS(DECOMPOSE_PARAMS_NAME_ONLY));
+}
+
+HANDLE_INSTRUCTION(i64_atomic_rmw_xchg)
+{
+    LOG_INSN;
+    LOAD_ADDRESSES();
+    if (interpreter.atomic_read_modify_write<i64, u64, AtomicExchange>(configuration, *instruction, addresses))
+        return Outcome::Return;
+    TAILCALL return continue_(HANDLER_PARAMS(DECOMPOSE_PARAMS_NAME_ONLY));
+}
+
+HANDLE_INSTRUCTION(i32_atomic_rmw8_xchg_u)
+{
+    LOG_INSN;
+    LOAD_ADDRESSES();
+    if (interpreter.atomic_read_modify_write<i32, u8, AtomicExchange>(configuration, *instruction, addresses))
+        return Outcome::Return;
+    TAILCALL return continue_(HANDLER_PARAMS(DECOMPOSE_PARAMS_NAME_ONLY));
+}
+
+HANDLE_INSTRUCTION(i32_atomic_rmw16_xchg_u)
+{
+    LOG_INSN;
+    LOAD_ADDRESSES();
+    if (interpreter.atomic_read_modify_write<i32, u16, AtomicExchange>(configuration, *instruction, addresses))
+        return Outcome::Return;
+    TAILCALL return continue_(HANDLER_PARAMS(DECOMPOSE_PARAMS_NAME_ONLY));
+}
+
+HANDLE_INSTRUCTION(i64_atomic_rmw8_xchg_u)
+{
+    LOG_INSN;
+    LOAD_ADDRESSES();
+    if (interpreter.atomic_read_modify_write<i64, u8, AtomicExchange>(configuration, *instruction, addresses))
+        return Outcome::Return;
+    TAILCALL return continue_(HANDLER_PARAMS(DECOMPOSE_PARAMS_NAME_ONLY));
+}
+
+HANDLE_INSTRUCTION(i64_atomic_rmw16_xchg_u)
+{
+    LOG_INSN;
+    LOAD_ADDRESSES();
+    if (interpreter.atomic_read_modify_write<i64, u16, AtomicExchange>(configuration, *instruction, addresses))
+        return Outcome::Return;
+    TAILCALL return continue_(HANDLER_PARAMS(DECOMPOSE_PARAMS_NAME_ONLY));
+}
+
+HANDLE_INSTRUCTION(i64_atomic_rmw32_xchg_u)
+{
+    LOG_INSN;
+    LOAD_ADDRESSES();
+    if (interpreter.atomic_read_modify_write<i64, u32, AtomicExchange>(configuration, *instruction, addresses))
+        return Outcome::Return;
+    TAILCALL return continue_(HANDLER_PARAMS(DECOMPOSE_PARAMS_NAME_ONLY));
+}
+
+HANDLE_INSTRUCTION(i32_atomic_rmw_cmpxchg)
+{
+    LOG_INSN;
+    LOAD_ADDRESSES();
+    if (interpreter.atomic_compare_exchange<i32, u32>(configuration, *instruction, addresses))
+        return Outcome::Return;
+    TAILCALL return continue_(HANDLER_PARAMS(DECOMPOSE_PARAMS_NAME_ONLY));
+}
+
+HANDLE_INSTRUCTION(i64_atomic_rmw_cmpxchg)
+{
+    LOG_INSN;
+    LOAD_ADDRESSES();
+    if (interpreter.atomic_compare_exchange<i64, u64>(configuration, *instruction, addresses))
+        return Outcome::Return;
+    TAILCALL return continue_(HANDLER_PARAMS(DECOMPOSE_PARAMS_NAME_ONLY));
+}
+
+HANDLE_INSTRUCTION(i32_atomic_rmw8_cmpxchg_u)
+{
+    LOG_INSN;
+    LOAD_ADDRESSES();
+    if (interpreter.atomic_compare_exchange<i32, u8>(configuration, *instruction, addresses))
+        return Outcome::Return;
+    TAILCALL return continue_(HANDLER_PARAMS(DECOMPOSE_PARAMS_NAME_ONLY));
+}
+
+HANDLE_INSTRUCTION(i32_atomic_rmw16_cmpxchg_u)
+{
+    LOG_INSN;
+    LOAD_ADDRESSES();
+    if (interpreter.atomic_compare_exchange<i32, u16>(configuration, *instruction, addresses))
+        return Outcome::Return;
+    TAILCALL return continue_(HANDLER_PARAMS(DECOMPOSE_PARAMS_NAME_ONLY));
+}
+
+HANDLE_INSTRUCTION(i64_atomic_rmw8_cmpxchg_u)
+{
+    LOG_INSN;
+    LOAD_ADDRESSES();
+    if (interpreter.atomic_compare_exchange<i64, u8>(configuration, *instruction, addresses))
+        return Outcome::Return;
+    TAILCALL return continue_(HANDLER_PARAMS(DECOMPOSE_PARAMS_NAME_ONLY));
+}
+
+HANDLE_INSTRUCTION(i64_atomic_rmw16_cmpxchg_u)
+{
+    LOG_INSN;
+    LOAD_ADDRESSES();
+    if (interpreter.atomic_compare_exchange<i64, u16>(configuration, *instruction, addresses))
+        return Outcome::Return;
+    TAILCALL return continue_(HANDLER_PARAMS(DECOMPOSE_PARAMS_NAME_ONLY));
+}
+
+HANDLE_INSTRUCTION(i64_atomic_rmw32_cmpxchg_u)
+{
+    LOG_INSN;
+    LOAD_ADDRESSES();
+    if (interpreter.atomic_compare_exchange<i64, u32>(configuration, *instruction, addresses))
+        return Outcome::Return;
+    TAILCALL return continue_(HANDLER_PARAMS(DECOMPOSE_PARAMS_NAME_ONLY));
+}
+
+HANDLE_INSTRUCTION(throw_ref)
+{
+    LOG_INSN;
+    interpreter.set_trap("Not Implemented: Proposal 'Exception-handling'"sv);
+    return Outcome::Return;
+}
+
+HANDLE_INSTRUCTION(throw_)
+{
+    LOG_INSN;
+    {
+        auto tag_address = configuration.frame().module().tags()[instruction->arguments().get<TagIndex>().value()];
+        auto& tag_instance = *configuration.store().get(tag_address);
+        auto& type = tag_instance.type();
+        auto values = Vector<Value>(configuration.value_stack().span().slice_from_end(type.parameters().size()));
+        configuration.value_stack().shrink(configuration.value_stack().size() - type.parameters().size());
+        auto exception_address = configuration.store().allocate(tag_instance, move(values));
+        if (!exception_address.has_value()) {
+            interpreter.set_trap("Out of memory"sv);
+            return Outcome::Return;
+        }
+        configuration.value_stack().append(Value(Reference { Reference::Exception { *exception_address } }));
+    }
+    TAILCALL return InstructionHandler<Instructions::throw_ref.value()>::operator()<HasDynamicInsnLimit, Continue, SourceAddressMix::Any>(HANDLER_PARAMS(DECOMPOSE_PARAMS_NAME_ONLY));
+}
+
+HANDLE_INSTRUCTION(try_table)
+{
+    LOG_INSN;
+    interpreter.set_trap("Not Implemented: Proposal 'Exception-handling'"sv);
+    return Outcome::Return;
+}
+
+template<u64 opcode, bool HasDynamicInsnLimit, typename Continue, SourceAddressMix mix, typename... Args>
+constexpr static auto handle_instruction(Args&&... a)
+{
+    return InstructionHandler<opcode>::template operator()<HasDynamicInsnLimit, Continue, mix>(forward<Args>(a)...);
+}
+
+template<bool HasCompiledList, bool HasDynamicInsnLimit, bool HaveDirectThreadingInfo>
+FLATTEN void BytecodeInterpreter::interpret_impl(Configuration& configuration, Expression const& expression)
+{
+    auto& instructions = expression.instructions();
+    u64 executed_instructions = 0;
+    ShortenedIP short_ip { .current_ip_value = static_cast<u32>(configuration.ip()) };
+
+    auto cc = expression.compiled_instructions.dispatches.data();
+    auto addresses_ptr = expression.compiled_instructions.src_dst_mappings.data();
+
+    if constexpr (HaveDirectThreadingInfo) {
+        static_assert(HasCompiledList, "Direct threading requires a compiled instruction list");
+        auto const instruction = cc[short_ip.current_ip_value].instruction;
+        auto const handler = bit_cast<Outcome (*)(HANDLER_PARAMS(DECOMPOSE_PARAMS_TYPE_ONLY))>(cc[short_ip.current_ip_value].handler_ptr);
+        handler(*this, configuration, instruction, short_ip, cc, addresses_ptr);
+        return;
+    }
+
+    while (true) {
+        if constexpr (HasDynamicInsnLimit) {
+            if (executed_instructions++ >= Constants::max_allowed_executed_instructions_per_call) [[unlikely]] {
+                m_trap = Trap::from_string("Exceeded maximum allowed number of instructions");
+                return;
+            }
+        }
+        // bounds checked by loop condition.
+        auto const instruction = HasCompiledList
+            ? cc[short_ip.current_ip_value].instruction
+            : &instructions.data()[short_ip.current_ip_value];
+        auto const opcode = (HasCompiledList && !HaveDirectThreadingInfo
+                ? cc[short_ip.current_ip_value].instruction_opcode
+                : instruction->opcode())
+                                .value();
+
+#define RUN_NEXT_INSTRUCTION()       \
+    {                                \
+        ++short_ip.current_ip_value; \
+        break;                       \
+    }
+
+#define HANDLE_INSTRUCTION_NEW(name, ...)                                                                                                                                                \
+    case Instructions::name.value(): {                                                                                                                                                   \
+        auto outcome = handle_instruction<Instructions::name.value(), HasDynamicInsnLimit, Skip, SourceAddressMix::Any>(*this, configuration, instruction, short_ip, cc, addresses_ptr); \
+        if (outcome == Outcome::Return)                                                                                                                                                  \
+            return;                                                                                                                                                                      \
+        short_ip.current_ip_value = to_underlying(outcome);                                                                                                                              \
+        if constexpr (first_is_one_of(Instructions::name, Instructions::return_call, Instructions::return_call_indirect, Instructions::return_call_ref)) {                               \
+            cc = configuration.frame().expression().compiled_instructions.dispatches.data();                                                                                             \
+            addresses_ptr = configuration.frame().expression().compiled_instructions.src_dst_mappings.data();                                                                            \
+        }                                                                                                                                                                                \
+        RUN_NEXT_INSTRUCTION();                                                                                                                                                          \
+    }
+
+        dbgln_if(WASM_TRACE_DEBUG, "Executing instruction {} at current_ip_value {}", instruction_name(instruction->opcode()), short_ip.current_ip_value);
+        if ((opcode & Instructions::SyntheticInstructionBase.value()) != Instructions::SyntheticInstructionBase.value())
+            __builtin_prefetch(&instruction->arguments(), /* read */ 0, /* low temporal locality */ 1);
+
+        switch (opcode) {
+            ENUMERATE_WASM_OPCODES(HANDLE_INSTRUCTION_NEW)
+        default:
+            dbgln("Bad opcode {} in insn {} (ip {})", opcode, instruction_name(instruction->opcode()), short_ip.current_ip_value);
+            VERIFY_NOT_REACHED();
+        }
+    }
+}
+
+template<bool NeedsStackAdjustment>
+InstructionPointer BytecodeInterpreter::branch_to_label(Configuration& configuration, LabelIndex index, InstructionPointer current_ip, bool actually_branching)
+{
+    dbgln_if(WASM_TRACE_DEBUG, "Branch to label with index {}...", index.value());
+    auto& label_stack = configuration.label_stack();
+    label_stack.unsafe_shrink(actually_branching ? label_stack.size() - index.value() : label_stack.size());
+    auto const& label = configuration.label_stack().unsafe_last();
+    dbgln_if(WASM_TRACE_DEBUG, "...which is actually IP {}, and has {} result(s)", label.continuation().value(), label.arity());
+
+    if constexpr (NeedsStackAdjustment) {
+        if (actually_branching)
+            configuration.value_stack().remove(label.stack_height(), configuration.value_stack().size() - label.stack_height() - label.arity());
+    }
+    return actually_branching ? label.continuation().value() - 1 : current_ip;
+}
+
+template<typename ReadType, typename PushType, SourceAddressMix mix>
+bool BytecodeInterpreter::load_and_push(Configuration& configuration, Instruction const& instruction, SourcesAndDestination const& addresses)
+{
+    auto& arg = instruction.arguments().unsafe_get<Instruction::MemoryArgument>();
+    auto& address = configuration.frame().module().memories().data()[arg.memory_index.value()];
+    auto memory = configuration.store().unsafe_get(address);
+    auto& entry = configuration.source_value<mix>(0, addresses.sources); // bounds checked by verifier.
+    auto base = entry.template to<i32>();
+    u64 instance_address = static_cast<u64>(bit_cast<u32>(base)) + arg.offset;
+    dbgln_if(WASM_TRACE_DEBUG, "load({} : {}) -> stack", instance_address, sizeof(ReadType));
+    if (instance_address + sizeof(ReadType) > memory->size()) {
+        m_trap = Trap::from_string("Memory access out of bounds");
+        dbgln_if(WASM_TRACE_DEBUG, "LibWasm: load_and_push - Memory access out of bounds (expected {} to be less than or equal to {})", instance_address + sizeof(ReadType), memory->size());
+        return true;
+    }
+    auto slice = memory->bytes().slice(instance_address, sizeof(ReadType));
+    entry = Value(static_cast<PushType>(read_value<ReadType>(slice)));
+    dbgln_if(WASM_TRACE_DEBUG, "  loaded value: {}", entry.value());
+    return false;
+}
+
+template<typename TDst, typename TSrc>
+ALWAYS_INLINE static TDst convert_vector(TSrc v)
+{
+    return __builtin_convertvector(v, TDst);
+}
+
+template<size_t M, size_t N, template<typename> typename SetSign>
+bool BytecodeInterpreter::load_and_push_mxn(Configuration& configuration, Instruction const& instruction, SourcesAndDestination const& addresses)
+{
+    auto& arg = instruction.arguments().unsafe_get<Instruction::MemoryArgument>();
+    auto& address = configuration.frame().module().memories().data()[arg.memory_index.value()];
+    auto memory = configuration.store().unsafe_get(address);
+    auto& entry = configuration.source_value<SourceAddressMix::Any>(0, addresses.sources); // bounds checked by verifier.
+    auto base = entry.template to<i32>();
+    u64 instance_address = static_cast<u64>(bit_cast<u32>(base)) + arg.offset;
+    dbgln_if(WASM_TRACE_DEBUG, "vec-load({} : {}) -> stack", instance_address, M * N / 8);
+    if (instance_address + M * N / 8 > memory->size()) {
+        m_trap = Trap::from_string("Memory access out of bounds");
+        dbgln("LibWasm: load_and_push_mxn - Memory access out of bounds (expected {} to be less than or equal to {})", instance_address + M * N / 8, memory->size());
+        return true;
+    }
+    auto slice = memory->bytes().slice(instance_address, M * N / 8);
+    using V64 = NativeVectorType<M, N, SetSign>;
+    using V128 = NativeVectorType<M * 2, N, SetSign>;
+
+    V64 bytes { 0 };
+    if (bit_cast<FlatPtr>(slice.data()) % sizeof(V64) == 0)
+        bytes = *bit_cast<V64*>(slice.data());
+    else
+        ByteReader::load(slice.data(), bytes);
+
+    entry = Value(bit_cast<u128>(convert_vector<V128>(bytes)));
+    dbgln_if(WASM_TRACE_DEBUG, "  loaded value: {}", entry.value());
+    return false;
+}
+
+template<size_t N>
+bool BytecodeInterpreter::load_and_push_lane_n(Configuration& configuration, Instruction const& instruction, SourcesAndDestination const& addresses)
+{
+    auto memarg_and_lane = instruction.arguments().unsafe_get<Instruction::MemoryAndLaneArgument>();
+    auto& address = configuration.frame().module().memories().data()[memarg_and_lane.memory.memory_index.value()];
+    auto memory = configuration.store().unsafe_get(address);
+    // bounds checked by verifier.
+    auto vector = configuration.take_source<SourceAddressMix::Any>(0, addresses.sources).template to<u128>();
+    auto base = configuration.take_source<SourceAddressMix::Any>(1, addresses.sources).template to<u32>();
+    u64 instance_address = static_cast<u64>(bit_cast<u32>(base)) + memarg_and_lane.memory.offset;
+    dbgln_if(WASM_TRACE_DEBUG, "load-lane({} : {}, lane {}) -> stack", instance_address, N / 8, memarg_and_lane.lane);
+    if (instance_address + N / 8 > memory->size()) {
+        m_trap = Trap::from_string("Memory access out of bounds");
+        dbgln("LibWasm: load_and_push_lane_n - Memory access out of bounds (expected {} to be less than or equal to {})", instance_address + N / 8, memory->size());
+        return true;
+    }
+    auto slice = memory->bytes().slice(instance_address, N / 8);
+    auto dst = bit_cast<u8*>(&vector) + memarg_and_lane.lane * N / 8;
+    memcpy(dst, slice.data(), N / 8);
+    dbgln_if(WASM_TRACE_DEBUG, "  loaded value: {}", vector);
+    configuration.push_to_destination<SourceAddressMix::Any>(Value(vector), addresses.destination);
+    return false;
+}
+
+template<size_t N>
+bool BytecodeInterpreter::load_and_push_zero_n(Configuration& configuration, Instruction const& instruction, SourcesAndDestination const& addresses)
+{
+    auto memarg_and_lane = instruction.arguments().unsafe_get<Instruction::MemoryArgument>();
     auto& address = configuration.frame().module().memories().data()[memarg_and_lane.memory_index.value()];
     auto memory = configuration.store().unsafe_get(address);
     // bounds checked by verifier.
@@ -5280,7 +5914,7 @@ bool BytecodeInterpreter::load_and_push_zero_n(Configuration& configuration, Ins
         dbgln("LibWasm: load_and_push_zero_n - Memory access out of bounds (expected {} to be less than or equal to {})", instance_address + N / 8, memory->size());
         return true;
     }
-    auto slice = memory->data().bytes().slice(instance_address, N / 8);
+    auto slice = memory->bytes().slice(instance_address, N / 8);
     u128 vector = 0;
     memcpy(&vector, slice.data(), N / 8);
     dbgln_if(WASM_TRACE_DEBUG, "  loaded value: {}", vector);
@@ -5303,7 +5937,7 @@ bool BytecodeInterpreter::load_and_push_m_splat(Configuration& configuration, In
         dbgln("LibWasm: load_and_push_m_splat - Memory access out of bounds (expected {} to be less than or equal to {})", instance_address + M / 8, memory->size());
         return true;
     }
-    auto slice = memory->data().bytes().slice(instance_address, M / 8);
+    auto slice = memory->bytes().slice(instance_address, M / 8);
     auto value = read_value<NativeIntegralType<M>>(slice);
     dbgln_if(WASM_TRACE_DEBUG, "  loaded value: {}", value);
     set_top_m_splat<M, NativeIntegralType>(configuration, value, addresses);
@@ -5540,9 +6174,140 @@ bool BytecodeInterpreter::store_to_memory(MemoryInstance& memory, u64 address, T
 
     dbgln_if(WASM_TRACE_DEBUG, "temporary({}b) -> store({})", data_size, address);
     if constexpr (IsSame<ReadonlyBytes, T>)
-        (void)value.copy_to(memory.data().bytes().slice(address, data_size));
+        (void)value.copy_to(memory.bytes().slice(address, data_size));
     else
-        memcpy(memory.data().bytes().offset_pointer(address), &value, data_size);
+        memcpy(memory.bytes().offset_pointer(address), &value, data_size);
+    return false;
+}
+
+// https://webassembly.github.io/threads/core/exec/instructions.html#atomic-memory-instructions
+// NB: Atomic accesses operate on the cells of the memory in place, which are little-endian like every other access.
+static_assert(HostIsLittleEndian, "Atomic memory accesses assume a little-endian host");
+
+template<typename T>
+T volatile* BytecodeInterpreter::atomic_memory_cell(Configuration& configuration, Instruction::MemoryArgument const& arg, u32 base)
+{
+    auto const& address = configuration.frame().module().memories().data()[arg.memory_index.value()];
+    auto memory = configuration.store().unsafe_get(address);
+    u64 instance_address = static_cast<u64>(base) + arg.offset;
+    if (instance_address + sizeof(T) > memory->size()) [[unlikely]] {
+        m_trap = Trap::from_string("Memory access out of bounds");
+        dbgln_if(WASM_TRACE_DEBUG, "LibWasm: atomic_memory_cell - Memory access out of bounds (expected {} to be less than or equal to {})", instance_address + sizeof(T), memory->size());
+        return nullptr;
+    }
+    // Unlike the other memory accesses, atomic ones trap unless the effective address is naturally aligned.
+    if (instance_address % sizeof(T) != 0) [[unlikely]] {
+        m_trap = Trap::from_string("Unaligned atomic memory access");
+        return nullptr;
+    }
+    return reinterpret_cast<T volatile*>(memory->bytes().data() + instance_address);
+}
+
+template<typename ReadT, typename PushT, SourceAddressMix mix>
+bool BytecodeInterpreter::atomic_load_and_push(Configuration& configuration, Instruction const& instruction, SourcesAndDestination const& addresses)
+{
+    auto& arg = instruction.arguments().unsafe_get<Instruction::MemoryArgument>();
+    auto& entry = configuration.source_value<mix>(0, addresses.sources); // bounds checked by verifier.
+    auto* cell = atomic_memory_cell<ReadT>(configuration, arg, entry.template to<u32>());
+    if (!cell)
+        return true;
+    entry = Value(static_cast<PushT>(AK::atomic_load(cell)));
+    return false;
+}
+
+template<typename PopT, typename StoreT>
+bool BytecodeInterpreter::atomic_pop_and_store(Configuration& configuration, Instruction const& instruction, SourcesAndDestination const& addresses)
+{
+    auto& arg = instruction.arguments().unsafe_get<Instruction::MemoryArgument>();
+    // bounds checked by verifier.
+    auto value = static_cast<StoreT>(configuration.take_source<SourceAddressMix::Any>(0, addresses.sources).template to<PopT>());
+    auto base = configuration.take_source<SourceAddressMix::Any>(1, addresses.sources).template to<u32>();
+    auto* cell = atomic_memory_cell<StoreT>(configuration, arg, base);
+    if (!cell)
+        return true;
+    AK::atomic_store(cell, value);
+    return false;
+}
+
+template<typename PopT, typename StoreT, typename Operation>
+bool BytecodeInterpreter::atomic_read_modify_write(Configuration& configuration, Instruction const& instruction, SourcesAndDestination const& addresses)
+{
+    auto& arg = instruction.arguments().unsafe_get<Instruction::MemoryArgument>();
+    // bounds checked by verifier.
+    auto value = static_cast<StoreT>(configuration.take_source<SourceAddressMix::Any>(0, addresses.sources).template to<PopT>());
+    auto& entry = configuration.source_value<SourceAddressMix::Any>(1, addresses.sources);
+    auto* cell = atomic_memory_cell<StoreT>(configuration, arg, entry.template to<u32>());
+    if (!cell)
+        return true;
+    // The narrow variants zero-extend the value they read.
+    entry = Value(static_cast<PopT>(Operation {}(cell, value)));
+    return false;
+}
+
+template<typename PopT, typename StoreT>
+bool BytecodeInterpreter::atomic_compare_exchange(Configuration& configuration, Instruction const& instruction, SourcesAndDestination const& addresses)
+{
+    auto& arg = instruction.arguments().unsafe_get<Instruction::MemoryArgument>();
+    // bounds checked by verifier.
+    auto replacement = static_cast<StoreT>(configuration.take_source<SourceAddressMix::Any>(0, addresses.sources).template to<PopT>());
+    // NB: The expected value is wrapped to the width of the access, so a narrow exchange compares the low bits only.
+    auto expected = static_cast<StoreT>(configuration.take_source<SourceAddressMix::Any>(1, addresses.sources).template to<PopT>());
+    auto& entry = configuration.source_value<SourceAddressMix::Any>(2, addresses.sources);
+    auto* cell = atomic_memory_cell<StoreT>(configuration, arg, entry.template to<u32>());
+    if (!cell)
+        return true;
+    // On failure, expected is updated to the value found in the cell, so it always ends up holding the loaded value.
+    (void)AK::atomic_compare_exchange_strong(cell, expected, replacement);
+    entry = Value(static_cast<PopT>(expected));
+    return false;
+}
+
+template<typename T>
+bool BytecodeInterpreter::atomic_wait(Configuration& configuration, Instruction const& instruction, SourcesAndDestination const& addresses)
+{
+    auto& arg = instruction.arguments().unsafe_get<Instruction::MemoryArgument>();
+    // bounds checked by verifier.
+    auto timeout_in_nanoseconds = configuration.take_source<SourceAddressMix::Any>(0, addresses.sources).template to<i64>();
+    auto expected = static_cast<T>(configuration.take_source<SourceAddressMix::Any>(1, addresses.sources).template to<MakeSigned<T>>());
+    auto& entry = configuration.source_value<SourceAddressMix::Any>(2, addresses.sources);
+    auto* cell = atomic_memory_cell<T>(configuration, arg, entry.template to<u32>());
+    if (!cell)
+        return true;
+
+    auto const& address = configuration.frame().module().memories().data()[arg.memory_index.value()];
+    if (trap_if_not(configuration.store().unsafe_get(address)->is_shared(), "Waiting on an unshared memory"sv))
+        return true;
+    // NB: The embedder decides whether this thread is allowed to block, e.g. the main thread of a web page is not.
+    if (trap_if_not(configuration.can_block(), "Waiting is not allowed on this thread"sv))
+        return true;
+
+    Optional<AK::Duration> timeout;
+    if (timeout_in_nanoseconds >= 0)
+        timeout = AK::Duration::from_nanoseconds(timeout_in_nanoseconds);
+
+    auto result = AtomicWaiterList::the().wait(cell, expected, timeout);
+    entry = Value(static_cast<i32>(to_underlying(result)));
+    return false;
+}
+
+bool BytecodeInterpreter::atomic_notify(Configuration& configuration, Instruction const& instruction, SourcesAndDestination const& addresses)
+{
+    auto& arg = instruction.arguments().unsafe_get<Instruction::MemoryArgument>();
+    // bounds checked by verifier.
+    auto count = configuration.take_source<SourceAddressMix::Any>(0, addresses.sources).template to<u32>();
+    auto& entry = configuration.source_value<SourceAddressMix::Any>(1, addresses.sources);
+    auto* cell = atomic_memory_cell<u32>(configuration, arg, entry.template to<u32>());
+    if (!cell)
+        return true;
+
+    // Nothing can be waiting on an unshared memory, as waiting on one traps.
+    auto const& address = configuration.frame().module().memories().data()[arg.memory_index.value()];
+    if (!configuration.store().unsafe_get(address)->is_shared()) {
+        entry = Value(static_cast<i32>(0));
+        return false;
+    }
+
+    entry = Value(static_cast<i32>(AtomicWaiterList::the().notify(cell, count)));
     return false;
 }
 
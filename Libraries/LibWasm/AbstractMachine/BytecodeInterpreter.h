@@ -95,6 +95,19 @@ struct WASM_API BytecodeInterpreter final : public Interpreter {
     template<typename M, template<typename> typename SetSign, typename VectorType = Native128ByteVectorOf<M, SetSign>>
     VectorType pop_vector(Configuration&, size_t source, SourcesAndDestination const&);
     bool store_to_memory(Configuration&, Instruction::MemoryArgument const&, ReadonlyBytes data, u32 base);
+    template<typename T>
+    T volatile* atomic_memory_cell(Configuration&, Instruction::MemoryArgument const&, u32 base);
+    template<typename ReadT, typename PushT, SourceAddressMix>
+    bool atomic_load_and_push(Configuration&, Instruction const&, SourcesAndDestination const&);
+    template<typename PopT, typename StoreT>
+    bool atomic_pop_and_store(Configuration&, Instruction const&, SourcesAndDestination const&);
+    template<typename PopT, typename StoreT, typename Operation>
+    bool atomic_read_modify_write(Configuration&, Instruction const&, SourcesAndDestination const&);
+    template<typename PopT, typename StoreT>
+    bool atomic_compare_exchange(Configuration&, Instruction const&, SourcesAndDestination const&);
+    template<typename T>
+    bool atomic_wait(Configuration&, Instruction const&, SourcesAndDestination const&);
+    bool atomic_notify(Configuration&, Instruction const&, SourcesAndDestination const&);
     Outcome call_address(Configuration&, FunctionAddress, SourcesAndDestination const&, CallAddressSource = CallAddressSource::DirectCall, CallType = CallType::UsingStack);
 
     template<typename T>
@@ -110,6 +110,10 @@ public:
     void enable_instruction_count_limit() { m_should_limit_instruction_count = true; }
     bool should_limit_instruction_count() const { return m_should_limit_instruction_count; }
 
+    // Whether memory.atomic.wait may block this thread, see AbstractMachine::set_can_block().
+    void set_can_block(bool can_block) { m_can_block = can_block; }
+    bool can_block() const { return m_can_block; }
+
     void dump_stack();
 
     void get_arguments_allocation_if_possible(Vector<Value, ArgumentsStaticSize>& arguments, size_t max_size)
@@ -269,6 +273,7 @@ private:
     size_t m_depth { 0 };
     u64 m_ip { 0 };
     bool m_should_limit_instruction_count { false };
+    bool m_can_block { true };
     Value* m_locals_base { nullptr };
     Value* m_call_record_base { nullptr };
 };
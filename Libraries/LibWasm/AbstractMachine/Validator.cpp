@@ -4,16 +4,43 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <AK/AtomicRefCounted.h>
 #include <AK/GenericShorthands.h>
 #include <AK/HashTable.h>
 #include <AK/SourceLocation.h>
 #include <AK/TemporaryChange.h>
 #include <AK/Try.h>
+#include <LibCore/System.h>
+#include <LibThreading/ConditionVariable.h>
+#include <LibThreading/Mutex.h>
+#include <LibThreading/ThreadPool.h>
 #include <LibWasm/AbstractMachine/Validator.h>
 #include <LibWasm/Printer/Printer.h>
 
 namespace Wasm {
 
+Context Context::deep_copy() const
+{
+    Context copy;
+    copy.types.extend(types);
+    copy.functions.extend(functions);
+    copy.function_type_indices.extend(function_type_indices);
+    copy.structs.extend(structs);
+    copy.arrays.extend(arrays);
+    copy.tables.extend(tables);
+    copy.memories.extend(memories);
+    copy.globals.extend(globals);
+    copy.elements.extend(elements);
+    copy.datas.extend(datas);
+    copy.locals.extend(locals);
+    copy.tags.extend(tags);
+    copy.data_count = data_count;
+    copy.references = references;
+    copy.imported_function_count = imported_function_count;
+    copy.current_function_parameter_count = current_function_parameter_count;
+    return copy;
+}
+
 ErrorOr<void, ValidationError> Validator::validate(Module& module)
 {
     // Pre-emptively make invalid. The module will be set to `Valid` at the end
@@ -267,46 +294,176 @@ ErrorOr<void, ValidationError> Validator::validate(TableSection const& section)
     return {};
 }
 
+// Code sections with at least this many functions have their bodies validated on multiple threads.
+static constexpr size_t minimum_function_count_for_parallel_validation = 64;
+static constexpr size_t maximum_validation_thread_count = 4;
+
 ErrorOr<void, ValidationError> Validator::validate(CodeSection const& section)
 {
-    size_t index = m_context.imported_function_count;
-    for (auto& entry : section.functions()) {
-        auto function_index = index++;
+    auto const& functions = section.functions();
+    for (size_t i = 0; i < functions.size(); ++i) {
+        auto function_index = m_context.imported_function_count + i;
         VERIFY(function_index <= NumericLimits<u32>::max());
         TRY(validate(FunctionIndex { static_cast<u32>(function_index) }));
-        auto& function_type = m_context.functions[function_index];
+    }
+
+    if (functions.size() >= minimum_function_count_for_parallel_validation && Core::System::hardware_concurrency() > 1) {
+        TRY(validate_function_bodies_in_parallel(section));
+    } else {
+        for (size_t i = 0; i < functions.size(); ++i)
+            TRY(validate_function_body(m_context.imported_function_count + i, functions[i].func()));
+    }
+
+    for (auto& entry : functions) {
         auto& function = entry.func();
+        if (function.body().compiled_instructions.max_call_rec_size == 0)
+            continue;
 
-        auto function_validator = fork();
-        function_validator.m_context.locals = {};
-        function_validator.m_context.locals.extend(function_type.parameters());
-        function_validator.m_context.current_function_parameter_count = function_type.parameters().size();
-        for (auto& local : function.locals()) {
-            for (size_t i = 0; i < local.n(); ++i)
-                function_validator.m_context.locals.append(local.type());
+        size_t max_callee_locals = 0;
+        for (auto& insn : function.body().instructions()) {
+            if (!first_is_one_of(insn.opcode(), Instructions::call, Instructions::synthetic_call_with_record_0, Instructions::synthetic_call_with_record_1))
+                continue;
+            auto callee_index = insn.arguments().template get<FunctionIndex>();
+            if (callee_index.value() - m_context.imported_function_count < functions.size())
+                max_callee_locals = max(max_callee_locals, functions[callee_index.value() - m_context.imported_function_count].func().total_local_count());
         }
 
-        function_validator.m_frames.empend(function_type, FrameKind::Function, (size_t)0);
-        function_validator.m_max_frame_size = max(function_validator.m_max_frame_size, function_validator.m_frames.size());
-
-        auto results = TRY(function_validator.validate(function.body(), function_type.results()));
-        if (results.result_types.size() != function_type.results().size())
-            return Errors::invalid("function result"sv, function_type.results(), results.result_types);
-
-        if (function.body().compiled_instructions.max_call_rec_size != 0) {
-            size_t max_callee_locals = 0;
-            for (auto& insn : function.body().instructions()) {
-                if (!first_is_one_of(insn.opcode(), Instructions::call, Instructions::synthetic_call_with_record_0, Instructions::synthetic_call_with_record_1))
-                    continue;
-                auto callee_index = insn.arguments().template get<FunctionIndex>();
-                if (callee_index.value() - m_context.imported_function_count < section.functions().size())
-                    max_callee_locals = max(max_callee_locals, section.functions()[callee_index.value() - m_context.imported_function_count].func().total_local_count());
-            }
+        function.body().compiled_instructions.max_call_rec_size += max_callee_locals;
+    }
+
+    return {};
+}
+
+ErrorOr<void, ValidationError> Validator::validate_function_body(size_t function_index, CodeSection::Func const& function)
+{
+    auto& function_type = m_context.functions[function_index];
+
+    auto function_validator = fork();
+    function_validator.m_context.locals = {};
+    function_validator.m_context.locals.extend(function_type.parameters());
+    function_validator.m_context.current_function_parameter_count = function_type.parameters().size();
+    for (auto& local : function.locals()) {
+        for (size_t i = 0; i < local.n(); ++i)
+            function_validator.m_context.locals.append(local.type());
+    }
+
+    function_validator.m_frames.empend(function_type, FrameKind::Function, (size_t)0);
+    function_validator.m_max_frame_size = max(function_validator.m_max_frame_size, function_validator.m_frames.size());
+
+    auto results = TRY(function_validator.validate(function.body(), function_type.results()));
+    if (results.result_types.size() != function_type.results().size())
+        return Errors::invalid("function result"sv, function_type.results(), results.result_types);
+
+    return {};
+}
+
+// Function bodies only depend on the module-level context, so they can be validated (and compiled) independently of
+// each other. The main thread and a few helpers from the thread pool repeatedly claim the next function that hasn't been
+// validated yet, each with its own copy of the context. Claims are made in ascending order, so once a function fails,
+// no more functions are claimed, and the error of the first invalid function is the same as in sequential validation.
+class ParallelCodeValidationState final : public AtomicRefCounted<ParallelCodeValidationState> {
+public:
+    explicit ParallelCodeValidationState(size_t function_count)
+        : m_function_count(function_count)
+    {
+        m_errors.resize(function_count);
+    }
+
+    // Returns false if validation has already finished, in which case the caller must not touch the module.
+    bool join()
+    {
+        Threading::MutexLocker locker(m_mutex);
+        if (m_finished)
+            return false;
+        ++m_participant_count;
+        return true;
+    }
+
+    void leave()
+    {
+        Threading::MutexLocker locker(m_mutex);
+        if (--m_participant_count == 0)
+            m_condition.broadcast();
+    }
+
+    void wait_until_finished()
+    {
+        Threading::MutexLocker locker(m_mutex);
+        m_condition.wait_while([this] { return m_participant_count > 0; });
+        m_finished = true;
+    }
+
+    Optional<size_t> claim_next_function()
+    {
+        if (m_has_error.load(AK::memory_order_relaxed))
+            return {};
+        auto index = m_next_function.fetch_add(1, AK::memory_order_relaxed);
+        if (index >= m_function_count)
+            return {};
+        return index;
+    }
+
+    void set_error(size_t index, ValidationError error)
+    {
+        m_errors[index] = move(error);
+        m_has_error.store(true, AK::memory_order_relaxed);
+    }
+
+    Optional<ValidationError> take_first_error()
+    {
+        for (auto& error : m_errors) {
+            if (error.has_value())
+                return error.release_value();
+        }
+        return {};
+    }
+
+private:
+    Threading::Mutex m_mutex;
+    Threading::ConditionVariable m_condition { m_mutex };
+    size_t m_participant_count { 0 };
+    bool m_finished { false };
 
-            function.body().compiled_instructions.max_call_rec_size += max_callee_locals;
+    size_t m_function_count { 0 };
+    Atomic<size_t> m_next_function { 0 };
+    Atomic<bool> m_has_error { false };
+    Vector<Optional<ValidationError>> m_errors;
+};
+
+ErrorOr<void, ValidationError> Validator::validate_function_bodies_in_parallel(CodeSection const& section)
+{
+    auto const& functions = section.functions();
+    auto state = adopt_ref(*new ParallelCodeValidationState(functions.size()));
+
+    auto validate_claimed_functions = [this, &functions, &parallel_state = *state] {
+        auto validator = fork_for_thread();
+        while (auto index = parallel_state.claim_next_function()) {
+            auto result = validator.validate_function_body(m_context.imported_function_count + *index, functions[*index].func());
+            if (result.is_error())
+                parallel_state.set_error(*index, result.release_error());
         }
+    };
+
+    auto main_thread_joined = state->join();
+    VERIFY(main_thread_joined);
+
+    auto helper_count = min<size_t>(Core::System::hardware_concurrency(), maximum_validation_thread_count) - 1;
+    for (size_t i = 0; i < helper_count; ++i) {
+        Threading::ThreadPool::the().submit([state, validate_claimed_functions] {
+            // NOTE: If validation finished before this job got to run, the validator and the module may already be gone.
+            if (!state->join())
+                return;
+            validate_claimed_functions();
+            state->leave();
+        });
     }
 
+    validate_claimed_functions();
+    state->leave();
+    state->wait_until_finished();
+
+    if (auto error = state->take_first_error(); error.has_value())
+        return error.release_value();
     return {};
 }
 
@@ -329,6 +486,8 @@ ErrorOr<void, ValidationError> Validator::validate(TypeSection const& section)
 ErrorOr<void, ValidationError> Validator::validate(TableType const& type)
 {
     TRY(validate(type.element_type()));
+    if (type.limits().is_shared())
+        return Errors::invalid("shared table"sv);
     Optional<u64> bound = type.limits().address_type() == AddressType::I64 ? Optional<u64> {} : (1ull << 32) - 1;
     return validate(type.limits(), bound);
 }
@@ -336,6 +495,11 @@ ErrorOr<void, ValidationError> Validator::validate(TableType const& type)
 ErrorOr<void, ValidationError> Validator::validate(MemoryType const& type)
 {
     u64 bound = type.limits().address_type() == AddressType::I64 ? 1ull << 48 : 1ull << 16;
+
+    // Proposal 'threads': shared memories must have a maximum size.
+    if (type.limits().is_shared() && !type.limits().max().has_value())
+        return Errors::invalid("shared memory without maximum"sv);
+
     return validate(type.limits(), bound);
 }
 
@@ -4345,6 +4509,724 @@ VALIDATE_INSTRUCTION(i32x4_relaxed_dot_i8x16_i7x16_add_s)
     return stack.take_and_put<ValueType::V128, ValueType::V128, ValueType::V128>(ValueType::V128);
 }
 
+// https://webassembly.github.io/threads/core/valid/instructions.html#atomic-memory-instructions
+VALIDATE_INSTRUCTION(memory_atomic_notify)
+{
+    auto& arg = instruction.arguments().get<Instruction::MemoryArgument>();
+    auto memory = TRY(validate_atomic_memory_argument(arg, sizeof(u32)));
+
+    TRY((stack.take<ValueType::I32>()));
+    TRY((take_memory_address(stack, memory, arg)));
+    stack.append(ValueType(ValueType::I32));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(memory_atomic_wait32)
+{
+    auto& arg = instruction.arguments().get<Instruction::MemoryArgument>();
+    auto memory = TRY(validate_atomic_memory_argument(arg, sizeof(u32)));
+
+    TRY((stack.take<ValueType::I64, ValueType::I32>()));
+    TRY((take_memory_address(stack, memory, arg)));
+    stack.append(ValueType(ValueType::I32));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(memory_atomic_wait64)
+{
+    auto& arg = instruction.arguments().get<Instruction::MemoryArgument>();
+    auto memory = TRY(validate_atomic_memory_argument(arg, sizeof(u64)));
+
+    TRY((stack.take<ValueType::I64, ValueType::I64>()));
+    TRY((take_memory_address(stack, memory, arg)));
+    stack.append(ValueType(ValueType::I32));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(atomic_fence)
+{
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i32_atomic_load)
+{
+    auto& arg = instruction.arguments().get<Instruction::MemoryArgument>();
+    auto memory = TRY(validate_atomic_memory_argument(arg, sizeof(u32)));
+
+    TRY((take_memory_address(stack, memory, arg)));
+    stack.append(ValueType(ValueType::I32));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i64_atomic_load)
+{
+    auto& arg = instruction.arguments().get<Instruction::MemoryArgument>();
+    auto memory = TRY(validate_atomic_memory_argument(arg, sizeof(u64)));
+
+    TRY((take_memory_address(stack, memory, arg)));
+    stack.append(ValueType(ValueType::I64));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i32_atomic_load8_u)
+{
+    auto& arg = instruction.arguments().get<Instruction::MemoryArgument>();
+    auto memory = TRY(validate_atomic_memory_argument(arg, sizeof(u8)));
+
+    TRY((take_memory_address(stack, memory, arg)));
+    stack.append(ValueType(ValueType::I32));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i32_atomic_load16_u)
+{
+    auto& arg = instruction.arguments().get<Instruction::MemoryArgument>();
+    auto memory = TRY(validate_atomic_memory_argument(arg, sizeof(u16)));
+
+    TRY((take_memory_address(stack, memory, arg)));
+    stack.append(ValueType(ValueType::I32));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i64_atomic_load8_u)
+{
+    auto& arg = instruction.arguments().get<Instruction::MemoryArgument>();
+    auto memory = TRY(validate_atomic_memory_argument(arg, sizeof(u8)));
+
+    TRY((take_memory_address(stack, memory, arg)));
+    stack.append(ValueType(ValueType::I64));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i64_atomic_load16_u)
+{
+    auto& arg = instruction.arguments().get<Instruction::MemoryArgument>();
+    auto memory = TRY(validate_atomic_memory_argument(arg, sizeof(u16)));
+
+    TRY((take_memory_address(stack, memory, arg)));
+    stack.append(ValueType(ValueType::I64));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i64_atomic_load32_u)
+{
+    auto& arg = instruction.arguments().get<Instruction::MemoryArgument>();
+    auto memory = TRY(validate_atomic_memory_argument(arg, sizeof(u32)));
+
+    TRY((take_memory_address(stack, memory, arg)));
+    stack.append(ValueType(ValueType::I64));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i32_atomic_store)
+{
+    auto& arg = instruction.arguments().get<Instruction::MemoryArgument>();
+    auto memory = TRY(validate_atomic_memory_argument(arg, sizeof(u32)));
+
+    TRY((stack.take<ValueType::I32>()));
+    TRY((take_memory_address(stack, memory, arg)));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i64_atomic_store)
+{
+    auto& arg = instruction.arguments().get<Instruction::MemoryArgument>();
+    auto memory = TRY(validate_atomic_memory_argument(arg, sizeof(u64)));
+
+    TRY((stack.take<ValueType::I64>()));
+    TRY((take_memory_address(stack, memory, arg)));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i32_atomic_store8)
+{
+    auto& arg = instruction.arguments().get<Instruction::MemoryArgument>();
+    auto memory = TRY(validate_atomic_memory_argument(arg, sizeof(u8)));
+
+    TRY((stack.take<ValueType::I32>()));
+    TRY((take_memory_address(stack, memory, arg)));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i32_atomic_store16)
+{
+    auto& arg = instruction.arguments().get<Instruction::MemoryArgument>();
+    auto memory = TRY(validate_atomic_memory_argument(arg, sizeof(u16)));
+
+    TRY((stack.take<ValueType::I32>()));
+    TRY((take_memory_address(stack, memory, arg)));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i64_atomic_store8)
+{
+    auto& arg = instruction.arguments().get<Instruction::MemoryArgument>();
+    auto memory = TRY(validate_atomic_memory_argument(arg, sizeof(u8)));
+
+    TRY((stack.take<ValueType::I64>()));
+    TRY((take_memory_address(stack, memory, arg)));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i64_atomic_store16)
+{
+    auto& arg = instruction.arguments().get<Instruction::MemoryArgument>();
+    auto memory = TRY(validate_atomic_memory_argument(arg, sizeof(u16)));
+
+    TRY((stack.take<ValueType::I64>()));
+    TRY((take_memory_address(stack, memory, arg)));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i64_atomic_store32)
+{
+    auto& arg = instruction.arguments().get<Instruction::MemoryArgument>();
+    auto memory = TRY(validate_atomic_memory_argument(arg, sizeof(u32)));
+
+    TRY((stack.take<ValueType::I64>()));
+    TRY((take_memory_address(stack, memory, arg)));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i32_atomic_rmw_add)
+{
+    auto& arg = instruction.arguments().get<Instruction::MemoryArgument>();
+    auto memory = TRY(validate_atomic_memory_argument(arg, sizeof(u32)));
+
+    TRY((stack.take<ValueType::I32>()));
+    TRY((take_memory_address(stack, memory, arg)));
+    stack.append(ValueType(ValueType::I32));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i64_atomic_rmw_add)
+{
+    auto& arg = instruction.arguments().get<Instruction::MemoryArgument>();
+    auto memory = TRY(validate_atomic_memory_argument(arg, sizeof(u64)));
+
+    TRY((stack.take<ValueType::I64>()));
+    TRY((take_memory_address(stack, memory, arg)));
+    stack.append(ValueType(ValueType::I64));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i32_atomic_rmw8_add_u)
+{
+    auto& arg = instruction.arguments().get<Instruction::MemoryArgument>();
+    auto memory = TRY(validate_atomic_memory_argument(arg, sizeof(u8)));
+
+    TRY((stack.take<ValueType::I32>()));
+    TRY((take_memory_address(stack, memory, arg)));
+    stack.append(ValueType(ValueType::I32));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i32_atomic_rmw16_add_u)
+{
+    auto& arg = instruction.arguments().get<Instruction::MemoryArgument>();
+    auto memory = TRY(validate_atomic_memory_argument(arg, sizeof(u16)));
+
+    TRY((stack.take<ValueType::I32>()));
+    TRY((take_memory_address(stack, memory, arg)));
+    stack.append(ValueType(ValueType::I32));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i64_atomic_rmw8_add_u)
+{
+    auto& arg = instruction.arguments().get<Instruction::MemoryArgument>();
+    auto memory = TRY(validate_atomic_memory_argument(arg, sizeof(u8)));
+
+    TRY((stack.take<ValueType::I64>()));
+    TRY((take_memory_address(stack, memory, arg)));
+    stack.append(ValueType(ValueType::I64));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i64_atomic_rmw16_add_u)
+{
+    auto& arg = instruction.arguments().get<Instruction::MemoryArgument>();
+    auto memory = TRY(validate_atomic_memory_argument(arg, sizeof(u16)));
+
+    TRY((stack.take<ValueType::I64>()));
+    TRY((take_memory_address(stack, memory, arg)));
+    stack.append(ValueType(ValueType::I64));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i64_atomic_rmw32_add_u)
+{
+    auto& arg = instruction.arguments().get<Instruction::MemoryArgument>();
+    auto memory = TRY(validate_atomic_memory_argument(arg, sizeof(u32)));
+
+    TRY((stack.take<ValueType::I64>()));
+    TRY((take_memory_address(stack, memory, arg)));
+    stack.append(ValueType(ValueType::I64));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i32_atomic_rmw_sub)
+{
+    auto& arg = instruction.arguments().get<Instruction::MemoryArgument>();
+    auto memory = TRY(validate_atomic_memory_argument(arg, sizeof(u32)));
+
+    TRY((stack.take<ValueType::I32>()));
+    TRY((take_memory_address(stack, memory, arg)));
+    stack.append(ValueType(ValueType::I32));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i64_atomic_rmw_sub)
+{
+    auto& arg = instruction.arguments().get<Instruction::MemoryArgument>();
+    auto memory = TRY(validate_atomic_memory_argument(arg, sizeof(u64)));
+
+    TRY((stack.take<ValueType::I64>()));
+    TRY((take_memory_address(stack, memory, arg)));
+    stack.append(ValueType(ValueType::I64));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i32_atomic_rmw8_sub_u)
+{
+    auto& arg = instruction.arguments().get<Instruction::MemoryArgument>();
+    auto memory = TRY(validate_atomic_memory_argument(arg, sizeof(u8)));
+
+    TRY((stack.take<ValueType::I32>()));
+    TRY((take_memory_address(stack, memory, arg)));
+    stack.append(ValueType(ValueType::I32));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i32_atomic_rmw16_sub_u)
+{
+    auto& arg = instruction.arguments().get<Instruction::MemoryArgument>();
+    auto memory = TRY(validate_atomic_memory_argument(arg, sizeof(u16)));
+
+    TRY((stack.take<ValueType::I32>()));
+    TRY((take_memory_address(stack, memory, arg)));
+    stack.append(ValueType(ValueType::I32));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i64_atomic_rmw8_sub_u)
+{
+    auto& arg = instruction.arguments().get<Instruction::MemoryArgument>();
+    auto memory = TRY(validate_atomic_memory_argument(arg, sizeof(u8)));
+
+    TRY((stack.take<ValueType::I64>()));
+    TRY((take_memory_address(stack, memory, arg)));
+    stack.append(ValueType(ValueType::I64));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i64_atomic_rmw16_sub_u)
+{
+    auto& arg = instruction.arguments().get<Instruction::MemoryArgument>();
+    auto memory = TRY(validate_atomic_memory_argument(arg, sizeof(u16)));
+
+    TRY((stack.take<ValueType::I64>()));
+    TRY((take_memory_address(stack, memory, arg)));
+    stack.append(ValueType(ValueType::I64));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i64_atomic_rmw32_sub_u)
+{
+    auto& arg = instruction.arguments().get<Instruction::MemoryArgument>();
+    auto memory = TRY(validate_atomic_memory_argument(arg, sizeof(u32)));
+
+    TRY((stack.take<ValueType::I64>()));
+    TRY((take_memory_address(stack, memory, arg)));
+    stack.append(ValueType(ValueType::I64));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i32_atomic_rmw_and)
+{
+    auto& arg = instruction.arguments().get<Instruction::MemoryArgument>();
+    auto memory = TRY(validate_atomic_memory_argument(arg, sizeof(u32)));
+
+    TRY((stack.take<ValueType::I32>()));
+    TRY((take_memory_address(stack, memory, arg)));
+    stack.append(ValueType(ValueType::I32));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i64_atomic_rmw_and)
+{
+    auto& arg = instruction.arguments().get<Instruction::MemoryArgument>();
+    auto memory = TRY(validate_atomic_memory_argument(arg, sizeof(u64)));
+
+    TRY((stack.take<ValueType::I64>()));
+    TRY((take_memory_address(stack, memory, arg)));
+    stack.append(ValueType(ValueType::I64));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i32_atomic_rmw8_and_u)
+{
+    auto& arg = instruction.arguments().get<Instruction::MemoryArgument>();
+    auto memory = TRY(validate_atomic_memory_argument(arg, sizeof(u8)));
+
+    TRY((stack.take<ValueType::I32>()));
+    TRY((take_memory_address(stack, memory, arg)));
+    stack.append(ValueType(ValueType::I32));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i32_atomic_rmw16_and_u)
+{
+    auto& arg = instruction.arguments().get<Instruction::MemoryArgument>();
+    auto memory = TRY(validate_atomic_memory_argument(arg, sizeof(u16)));
+
+    TRY((stack.take<ValueType::I32>()));
+    TRY((take_memory_address(stack, memory, arg)));
+    stack.append(ValueType(ValueType::I32));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i64_atomic_rmw8_and_u)
+{
+    auto& arg = instruction.arguments().get<Instruction::MemoryArgument>();
+    auto memory = TRY(validate_atomic_memory_argument(arg, sizeof(u8)));
+
+    TRY((stack.take<ValueType::I64>()));
+    TRY((take_memory_address(stack, memory, arg)));
+    stack.append(ValueType(ValueType::I64));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i64_atomic_rmw16_and_u)
+{
+    auto& arg = instruction.arguments().get<Instruction::MemoryArgument>();
+    auto memory = TRY(validate_atomic_memory_argument(arg, sizeof(u16)));
+
+    TRY((stack.take<ValueType::I64>()));
+    TRY((take_memory_address(stack, memory, arg)));
+    stack.append(ValueType(ValueType::I64));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i64_atomic_rmw32_and_u)
+{
+    auto& arg = instruction.arguments().get<Instruction::MemoryArgument>();
+    auto memory = TRY(validate_atomic_memory_argument(arg, sizeof(u32)));
+
+    TRY((stack.take<ValueType::I64>()));
+    TRY((take_memory_address(stack, memory, arg)));
+    stack.append(ValueType(ValueType::I64));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i32_atomic_rmw_or)
+{
+    auto& arg = instruction.arguments().get<Instruction::MemoryArgument>();
+    auto memory = TRY(validate_atomic_memory_argument(arg, sizeof(u32)));
+
+    TRY((stack.take<ValueType::I32>()));
+    TRY((take_memory_address(stack, memory, arg)));
+    stack.append(ValueType(ValueType::I32));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i64_atomic_rmw_or)
+{
+    auto& arg = instruction.arguments().get<Instruction::MemoryArgument>();
+    auto memory = TRY(validate_atomic_memory_argument(arg, sizeof(u64)));
+
+    TRY((stack.take<ValueType::I64>()));
+    TRY((take_memory_address(stack, memory, arg)));
+    stack.append(ValueType(ValueType::I64));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i32_atomic_rmw8_or_u)
+{
+    auto& arg = instruction.arguments().get<Instruction::MemoryArgument>();
+    auto memory = TRY(validate_atomic_memory_argument(arg, sizeof(u8)));
+
+    TRY((stack.take<ValueType::I32>()));
+    TRY((take_memory_address(stack, memory, arg)));
+    stack.append(ValueType(ValueType::I32));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i32_atomic_rmw16_or_u)
+{
+    auto& arg = instruction.arguments().get<Instruction::MemoryArgument>();
+    auto memory = TRY(validate_atomic_memory_argument(arg, sizeof(u16)));
+
+    TRY((stack.take<ValueType::I32>()));
+    TRY((take_memory_address(stack, memory, arg)));
+    stack.append(ValueType(ValueType::I32));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i64_atomic_rmw8_or_u)
+{
+    auto& arg = instruction.arguments().get<Instruction::MemoryArgument>();
+    auto memory = TRY(validate_atomic_memory_argument(arg, sizeof(u8)));
+
+    TRY((stack.take<ValueType::I64>()));
+    TRY((take_memory_address(stack, memory, arg)));
+    stack.append(ValueType(ValueType::I64));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i64_atomic_rmw16_or_u)
+{
+    auto& arg = instruction.arguments().get<Instruction::MemoryArgument>();
+    auto memory = TRY(validate_atomic_memory_argument(arg, sizeof(u16)));
+
+    TRY((stack.take<ValueType::I64>()));
+    TRY((take_memory_address(stack, memory, arg)));
+    stack.append(ValueType(ValueType::I64));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i64_atomic_rmw32_or_u)
+{
+    auto& arg = instruction.arguments().get<Instruction::MemoryArgument>();
+    auto memory = TRY(validate_atomic_memory_argument(arg, sizeof(u32)));
+
+    TRY((stack.take<ValueType::I64>()));
+    TRY((take_memory_address(stack, memory, arg)));
+    stack.append(ValueType(ValueType::I64));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i32_atomic_rmw_xor)
+{
+    auto& arg = instruction.arguments().get<Instruction::MemoryArgument>();
+    auto memory = TRY(validate_atomic_memory_argument(arg, sizeof(u32)));
+
+    TRY((stack.take<ValueType::I32>()));
+    TRY((take_memory_address(stack, memory, arg)));
+    stack.append(ValueType(ValueType::I32));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i64_atomic_rmw_xor)
+{
+    auto& arg = instruction.arguments().get<Instruction::MemoryArgument>();
+    auto memory = TRY(validate_atomic_memory_argument(arg, sizeof(u64)));
+
+    TRY((stack.take<ValueType::I64>()));
+    TRY((take_memory_address(stack, memory, arg)));
+    stack.append(ValueType(ValueType::I64));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i32_atomic_rmw8_xor_u)
+{
+    auto& arg = instruction.arguments().get<Instruction::MemoryArgument>();
+    auto memory = TRY(validate_atomic_memory_argument(arg, sizeof(u8)));
+
+    TRY((stack.take<ValueType::I32>()));
+    TRY((take_memory_address(stack, memory, arg)));
+    stack.append(ValueType(ValueType::I32));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i32_atomic_rmw16_xor_u)
+{
+    auto& arg = instruction.arguments().get<Instruction::MemoryArgument>();
+    auto memory = TRY(validate_atomic_memory_argument(arg, sizeof(u16)));
+
+    TRY((stack.take<ValueType::I32>()));
+    TRY((take_memory_address(stack, memory, arg)));
+    stack.append(ValueType(ValueType::I32));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i64_atomic_rmw8_xor_u)
+{
+    auto& arg = instruction.arguments().get<Instruction::MemoryArgument>();
+    auto memory = TRY(validate_atomic_memory_argument(arg, sizeof(u8)));
+
+    TRY((stack.take<ValueType::I64>()));
+    TRY((take_memory_address(stack, memory, arg)));
+    stack.append(ValueType(ValueType::I64));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i64_atomic_rmw16_xor_u)
+{
+    auto& arg = instruction.arguments().get<Instruction::MemoryArgument>();
+    auto memory = TRY(validate_atomic_memory_argument(arg, sizeof(u16)));
+
+    TRY((stack.take<ValueType::I64>()));
+    TRY((take_memory_address(stack, memory, arg)));
+    stack.append(ValueType(ValueType::I64));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i64_atomic_rmw32_xor_u)
+{
+    auto& arg = instruction.arguments().get<Instruction::MemoryArgument>();
+    auto memory = TRY(validate_atomic_memory_argument(arg, sizeof(u32)));
+
+    TRY((stack.take<ValueType::I64>()));
+    TRY((take_memory_address(stack, memory, arg)));
+    stack.append(ValueType(ValueType::I64));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i32_atomic_rmw_xchg)
+{
+    auto& arg = instruction.arguments().get<Instruction::MemoryArgument>();
+    auto memory = TRY(validate_atomic_memory_argument(arg, sizeof(u32)));
+
+    TRY((stack.take<ValueType::I32>()));
+    TRY((take_memory_address(stack, memory, arg)));
+    stack.append(ValueType(ValueType::I32));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i64_atomic_rmw_xchg)
+{
+    auto& arg = instruction.arguments().get<Instruction::MemoryArgument>();
+    auto memory = TRY(validate_atomic_memory_argument(arg, sizeof(u64)));
+
+    TRY((stack.take<ValueType::I64>()));
+    TRY((take_memory_address(stack, memory, arg)));
+    stack.append(ValueType(ValueType::I64));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i32_atomic_rmw8_xchg_u)
+{
+    auto& arg = instruction.arguments().get<Instruction::MemoryArgument>();
+    auto memory = TRY(validate_atomic_memory_argument(arg, sizeof(u8)));
+
+    TRY((stack.take<ValueType::I32>()));
+    TRY((take_memory_address(stack, memory, arg)));
+    stack.append(ValueType(ValueType::I32));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i32_atomic_rmw16_xchg_u)
+{
+    auto& arg = instruction.arguments().get<Instruction::MemoryArgument>();
+    auto memory = TRY(validate_atomic_memory_argument(arg, sizeof(u16)));
+
+    TRY((stack.take<ValueType::I32>()));
+    TRY((take_memory_address(stack, memory, arg)));
+    stack.append(ValueType(ValueType::I32));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i64_atomic_rmw8_xchg_u)
+{
+    auto& arg = instruction.arguments().get<Instruction::MemoryArgument>();
+    auto memory = TRY(validate_atomic_memory_argument(arg, sizeof(u8)));
+
+    TRY((stack.take<ValueType::I64>()));
+    TRY((take_memory_address(stack, memory, arg)));
+    stack.append(ValueType(ValueType::I64));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i64_atomic_rmw16_xchg_u)
+{
+    auto& arg = instruction.arguments().get<Instruction::MemoryArgument>();
+    auto memory = TRY(validate_atomic_memory_argument(arg, sizeof(u16)));
+
+    TRY((stack.take<ValueType::I64>()));
+    TRY((take_memory_address(stack, memory, arg)));
+    stack.append(ValueType(ValueType::I64));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i64_atomic_rmw32_xchg_u)
+{
+    auto& arg = instruction.arguments().get<Instruction::MemoryArgument>();
+    auto memory = TRY(validate_atomic_memory_argument(arg, sizeof(u32)));
+
+    TRY((stack.take<ValueType::I64>()));
+    TRY((take_memory_address(stack, memory, arg)));
+    stack.append(ValueType(ValueType::I64));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i32_atomic_rmw_cmpxchg)
+{
+    auto& arg = instruction.arguments().get<Instruction::MemoryArgument>();
+    auto memory = TRY(validate_atomic_memory_argument(arg, sizeof(u32)));
+
+    TRY((stack.take<ValueType::I32, ValueType::I32>()));
+    TRY((take_memory_address(stack, memory, arg)));
+    stack.append(ValueType(ValueType::I32));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i64_atomic_rmw_cmpxchg)
+{
+    auto& arg = instruction.arguments().get<Instruction::MemoryArgument>();
+    auto memory = TRY(validate_atomic_memory_argument(arg, sizeof(u64)));
+
+    TRY((stack.take<ValueType::I64, ValueType::I64>()));
+    TRY((take_memory_address(stack, memory, arg)));
+    stack.append(ValueType(ValueType::I64));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i32_atomic_rmw8_cmpxchg_u)
+{
+    auto& arg = instruction.arguments().get<Instruction::MemoryArgument>();
+    auto memory = TRY(validate_atomic_memory_argument(arg, sizeof(u8)));
+
+    TRY((stack.take<ValueType::I32, ValueType::I32>()));
+    TRY((take_memory_address(stack, memory, arg)));
+    stack.append(ValueType(ValueType::I32));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i32_atomic_rmw16_cmpxchg_u)
+{
+    auto& arg = instruction.arguments().get<Instruction::MemoryArgument>();
+    auto memory = TRY(validate_atomic_memory_argument(arg, sizeof(u16)));
+
+    TRY((stack.take<ValueType::I32, ValueType::I32>()));
+    TRY((take_memory_address(stack, memory, arg)));
+    stack.append(ValueType(ValueType::I32));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i64_atomic_rmw8_cmpxchg_u)
+{
+    auto& arg = instruction.arguments().get<Instruction::MemoryArgument>();
+    auto memory = TRY(validate_atomic_memory_argument(arg, sizeof(u8)));
+
+    TRY((stack.take<ValueType::I64, ValueType::I64>()));
+    TRY((take_memory_address(stack, memory, arg)));
+    stack.append(ValueType(ValueType::I64));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i64_atomic_rmw16_cmpxchg_u)
+{
+    auto& arg = instruction.arguments().get<Instruction::MemoryArgument>();
+    auto memory = TRY(validate_atomic_memory_argument(arg, sizeof(u16)));
+
+    TRY((stack.take<ValueType::I64, ValueType::I64>()));
+    TRY((take_memory_address(stack, memory, arg)));
+    stack.append(ValueType(ValueType::I64));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i64_atomic_rmw32_cmpxchg_u)
+{
+    auto& arg = instruction.arguments().get<Instruction::MemoryArgument>();
+    auto memory = TRY(validate_atomic_memory_argument(arg, sizeof(u32)));
+
+    TRY((stack.take<ValueType::I64, ValueType::I64>()));
+    TRY((take_memory_address(stack, memory, arg)));
+    stack.append(ValueType(ValueType::I64));
+    return {};
+}
+
 VALIDATE_INSTRUCTION(synthetic_end_expression)
 {
     is_constant = true;
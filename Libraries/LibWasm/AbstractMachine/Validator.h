@@ -6,6 +6,7 @@
 
 #pragma once
 
+#include <AK/AtomicRefCounted.h>
 #include <AK/COWVector.h>
 #include <AK/Debug.h>
 #include <AK/RedBlackTree.h>
@@ -18,7 +19,8 @@
 namespace Wasm {
 
 struct Context {
-    struct RefRBTree : RefCounted<RefRBTree> {
+    // NOTE: This is shared between the contexts of all validator threads, see Validator::fork_for_thread().
+    struct RefRBTree : AtomicRefCounted<RefRBTree> {
         RedBlackTree<size_t, FunctionIndex> tree;
     };
 
@@ -38,6 +40,9 @@ struct Context {
     RefPtr<RefRBTree> references { make_ref_counted<RefRBTree>() };
     size_t imported_function_count { 0 };
     size_t current_function_parameter_count { 0 };
+
+    // Returns a copy that doesn't share any copy-on-write storage with this context.
+    Context deep_copy() const;
 };
 
 struct ValidationError : public Error {
@@ -62,6 +67,12 @@ public:
         return Validator { m_context };
     }
 
+    // Unlike fork(), the returned validator may be used on another thread, as long as this one is only read from.
+    [[nodiscard]] Validator fork_for_thread() const
+    {
+        return Validator { m_context.deep_copy() };
+    }
+
     // Module
     ErrorOr<void, ValidationError> validate(Module&);
     ErrorOr<void, ValidationError> validate(ImportSection const&);
@@ -343,12 +354,24 @@ public:
         return {};
     }
 
+    // Proposal 'threads': atomic accesses must be naturally aligned.
+    ErrorOr<MemoryType, ValidationError> validate_atomic_memory_argument(Instruction::MemoryArgument const& arg, size_t access_size)
+    {
+        auto memory = TRY(validate(arg.memory_index));
+        if (arg.align >= 64 || (1ull << arg.align) != access_size)
+            return Errors::invalid("atomic memory op alignment"sv, access_size, arg.align >= 64 ? 0 : 1ull << arg.align);
+        return memory;
+    }
+
 private:
     explicit Validator(Context context)
         : m_context(move(context))
     {
     }
 
+    ErrorOr<void, ValidationError> validate_function_body(size_t function_index, CodeSection::Func const&);
+    ErrorOr<void, ValidationError> validate_function_bodies_in_parallel(CodeSection const&);
+
     struct Errors {
         static ValidationError invalid(StringView name, SourceLocation location = SourceLocation::current())
         {
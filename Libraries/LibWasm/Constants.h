@@ -63,6 +63,7 @@ static constexpr auto max_allowed_executed_instructions_per_call = 256 * 1024 *
 static constexpr auto max_allowed_vector_size = 500 * MiB;
 static constexpr auto max_allowed_table_size = 1024 * 1024;
 static constexpr auto max_allowed_function_locals_per_type = 42069; // Note: VERY arbitrary.
+static constexpr u64 max_memory_reservation = sizeof(FlatPtr) == 8 ? 4 * GiB : 256 * MiB; // Note: Address space, not memory.
 
 // Messages used by the host
 static constexpr auto stack_exhaustion_message = "STACK-EXHAUSTION"sv;
@@ -216,10 +216,12 @@ ParseResult<Limits> Limits::parse(ConstrainedStream& stream)
     auto flag = TRY_READ(stream, u8, ParseError::ExpectedKindTag);
 
     // Proposal 'memory64': flags 0/1 refer to 32-bit limits, flags 4/5 refer to 64-bit limits.
-    if (flag & ~0b00000101)
+    // Proposal 'threads': flag 2 marks the limits of a shared memory.
+    if (flag & ~0b00000111)
         return with_eof_check(stream, ParseError::InvalidTag);
 
     auto address_type = (flag & 0b00000100) ? AddressType::I64 : AddressType::I32;
+    auto share = (flag & 0b00000010) ? Share::Shared : Share::Unshared;
 
     auto min_or_error = stream.read_value<LEB128<u64>>();
     if (min_or_error.is_error())
@@ -234,7 +236,7 @@ ParseResult<Limits> Limits::parse(ConstrainedStream& stream)
         max = value_or_error.release_value();
     }
 
-    return Limits { address_type, min, move(max) };
+    return Limits { address_type, min, move(max), share };
 }
 
 ParseResult<MemoryType> MemoryType::parse(ConstrainedStream& stream)
@@ -636,7 +638,8 @@ ParseResult<Instruction> Instruction::parse(ConstrainedStream& stream)
     case Instructions::i64_extend32_s.value():
         return Instruction { opcode };
     case 0xfc:
-    case 0xfd: {
+    case 0xfd:
+    case 0xfe: {
         // These are multibyte instructions.
         auto selector = TRY_READ(stream, LEB128<u32>, ParseError::InvalidInput);
         OpCode full_opcode = static_cast<u64>(opcode.value()) << 56 | selector;
@@ -1003,6 +1006,94 @@ ParseResult<Instruction> Instruction::parse(ConstrainedStream& stream)
         case Instructions::i32x4_relaxed_dot_i8x16_i7x16_add_s.value():
             // op
             return Instruction { full_opcode };
+        case Instructions::atomic_fence.value(): {
+            // op 0x00
+            auto flags = TRY_READ(stream, u8, ParseError::InvalidInput);
+            if (flags != 0)
+                return ParseError::InvalidImmediate;
+            return Instruction { full_opcode };
+        }
+        case Instructions::memory_atomic_notify.value():
+        case Instructions::memory_atomic_wait32.value():
+        case Instructions::memory_atomic_wait64.value():
+        case Instructions::i32_atomic_load.value():
+        case Instructions::i64_atomic_load.value():
+        case Instructions::i32_atomic_load8_u.value():
+        case Instructions::i32_atomic_load16_u.value():
+        case Instructions::i64_atomic_load8_u.value():
+        case Instructions::i64_atomic_load16_u.value():
+        case Instructions::i64_atomic_load32_u.value():
+        case Instructions::i32_atomic_store.value():
+        case Instructions::i64_atomic_store.value():
+        case Instructions::i32_atomic_store8.value():
+        case Instructions::i32_atomic_store16.value():
+        case Instructions::i64_atomic_store8.value():
+        case Instructions::i64_atomic_store16.value():
+        case Instructions::i64_atomic_store32.value():
+        case Instructions::i32_atomic_rmw_add.value():
+        case Instructions::i64_atomic_rmw_add.value():
+        case Instructions::i32_atomic_rmw8_add_u.value():
+        case Instructions::i32_atomic_rmw16_add_u.value():
+        case Instructions::i64_atomic_rmw8_add_u.value():
+        case Instructions::i64_atomic_rmw16_add_u.value():
+        case Instructions::i64_atomic_rmw32_add_u.value():
+        case Instructions::i32_atomic_rmw_sub.value():
+        case Instructions::i64_atomic_rmw_sub.value():
+        case Instructions::i32_atomic_rmw8_sub_u.value():
+        case Instructions::i32_atomic_rmw16_sub_u.value():
+        case Instructions::i64_atomic_rmw8_sub_u.value():
+        case Instructions::i64_atomic_rmw16_sub_u.value():
+        case Instructions::i64_atomic_rmw32_sub_u.value():
+        case Instructions::i32_atomic_rmw_and.value():
+        case Instructions::i64_atomic_rmw_and.value():
+        case Instructions::i32_atomic_rmw8_and_u.value():
+        case Instructions::i32_atomic_rmw16_and_u.value():
+        case Instructions::i64_atomic_rmw8_and_u.value():
+        case Instructions::i64_atomic_rmw16_and_u.value():
+        case Instructions::i64_atomic_rmw32_and_u.value():
+        case Instructions::i32_atomic_rmw_or.value():
+        case Instructions::i64_atomic_rmw_or.value():
+        case Instructions::i32_atomic_rmw8_or_u.value():
+        case Instructions::i32_atomic_rmw16_or_u.value():
+        case Instructions::i64_atomic_rmw8_or_u.value():
+        case Instructions::i64_atomic_rmw16_or_u.value():
+        case Instructions::i64_atomic_rmw32_or_u.value():
+        case Instructions::i32_atomic_rmw_xor.value():
+        case Instructions::i64_atomic_rmw_xor.value():
+        case Instructions::i32_atomic_rmw8_xor_u.value():
+        case Instructions::i32_atomic_rmw16_xor_u.value():
+        case Instructions::i64_atomic_rmw8_xor_u.value():
+        case Instructions::i64_atomic_rmw16_xor_u.value():
+        case Instructions::i64_atomic_rmw32_xor_u.value():
+        case Instructions::i32_atomic_rmw_xchg.value():
+        case Instructions::i64_atomic_rmw_xchg.value():
+        case Instructions::i32_atomic_rmw8_xchg_u.value():
+        case Instructions::i32_atomic_rmw16_xchg_u.value():
+        case Instructions::i64_atomic_rmw8_xchg_u.value():
+        case Instructions::i64_atomic_rmw16_xchg_u.value():
+        case Instructions::i64_atomic_rmw32_xchg_u.value():
+        case Instructions::i32_atomic_rmw_cmpxchg.value():
+        case Instructions::i64_atomic_rmw_cmpxchg.value():
+        case Instructions::i32_atomic_rmw8_cmpxchg_u.value():
+        case Instructions::i32_atomic_rmw16_cmpxchg_u.value():
+        case Instructions::i64_atomic_rmw8_cmpxchg_u.value():
+        case Instructions::i64_atomic_rmw16_cmpxchg_u.value():
+        case Instructions::i64_atomic_rmw32_cmpxchg_u.value(): {
+            // op (align [multi-memory: memindex] offset)
+            u32 align = TRY_READ(stream, LEB128<u32>, ParseError::InvalidInput);
+
+            // Proposal "multi-memory", if bit 6 of alignment is set, then a memory index follows the alignment.
+            auto memory_index = 0;
+            if ((align & 0x40) != 0) {
+                align &= ~0x40;
+                memory_index = TRY_READ(stream, LEB128<u32>, ParseError::InvalidInput);
+            }
+
+            // Proposal 'memory64': memarg offsets are u64 instead of u32.
+            auto offset = TRY_READ(stream, LEB128<u64>, ParseError::InvalidInput);
+
+            return Instruction { full_opcode, MemoryArgument { align, offset, MemoryIndex(memory_index) } };
+        }
         default:
             return ParseError::UnknownInstruction;
         }
@@ -0,0 +1,61 @@
+// Atomic accesses to a shared memory (threads proposal), run on a single thread.
+
+test("read-modify-write returns the previous value", () => {
+    const bin = readBinaryWasmFile("Fixtures/Modules/atomics.wasm");
+    const module = parseWebAssemblyModule(bin);
+    const add = module.getExport("i32_rmw_add");
+    const load = module.getExport("i32_load");
+
+    expect(module.invoke(add, 0, 5)).toBe(0);
+    expect(module.invoke(add, 0, 7)).toBe(5);
+    expect(module.invoke(load, 0)).toBe(12);
+});
+
+test("narrow read-modify-write wraps and zero-extends", () => {
+    const bin = readBinaryWasmFile("Fixtures/Modules/atomics.wasm");
+    const module = parseWebAssemblyModule(bin);
+
+    module.invoke(module.getExport("i32_store8"), 8, 250);
+    // 250 + 10 wraps around to 4 within the byte.
+    expect(module.invoke(module.getExport("i32_rmw8_add_u"), 8, 10)).toBe(250);
+    expect(module.invoke(module.getExport("i32_load"), 8)).toBe(4);
+
+    const xchg = module.getExport("i64_rmw32_xchg_u");
+    expect(module.invoke(xchg, 16, 0x1ffffffffn)).toBe(0n);
+    expect(module.invoke(xchg, 16, 5n)).toBe(0xffffffffn);
+});
+
+test("compare-exchange only replaces the expected value", () => {
+    const bin = readBinaryWasmFile("Fixtures/Modules/atomics.wasm");
+    const module = parseWebAssemblyModule(bin);
+    const cmpxchg = module.getExport("i32_rmw_cmpxchg");
+    const load = module.getExport("i32_load");
+
+    module.invoke(module.getExport("i32_rmw_add"), 0, 12);
+    expect(module.invoke(cmpxchg, 0, 1, 99)).toBe(12);
+    expect(module.invoke(load, 0)).toBe(12);
+    expect(module.invoke(cmpxchg, 0, 12, 99)).toBe(12);
+    expect(module.invoke(load, 0)).toBe(99);
+});
+
+test("unaligned atomic access traps", () => {
+    const bin = readBinaryWasmFile("Fixtures/Modules/atomics.wasm");
+    const module = parseWebAssemblyModule(bin);
+    const add = module.getExport("i32_rmw_add");
+
+    expect(() => module.invoke(add, 1, 1)).toThrowWithMessage(TypeError, "Execution trapped: Unaligned atomic memory access");
+});
+
+test("wait and notify without other threads", () => {
+    const bin = readBinaryWasmFile("Fixtures/Modules/atomics.wasm");
+    const module = parseWebAssemblyModule(bin);
+    const wait32 = module.getExport("wait32");
+
+    // "not-equal"
+    expect(module.invoke(wait32, 0, 1, 0n)).toBe(1);
+    // "timed-out"
+    expect(module.invoke(wait32, 0, 0, 0n)).toBe(2);
+    expect(module.invoke(wait32, 0, 0, 1000000n)).toBe(2);
+    // Nobody is waiting.
+    expect(module.invoke(module.getExport("notify"), 0, 1)).toBe(0);
+});
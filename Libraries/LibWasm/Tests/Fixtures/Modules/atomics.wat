@@ -0,0 +1,56 @@
+(module
+  (memory 1 1 shared)
+
+  ;; Returns the value at the address before adding to it.
+  (func (export "i32_rmw_add") (param i32 i32) (result i32)
+    local.get 0
+    local.get 1
+    i32.atomic.rmw.add
+  )
+
+  (func (export "i32_load") (param i32) (result i32)
+    local.get 0
+    i32.atomic.load
+  )
+
+  (func (export "i32_store8") (param i32 i32)
+    local.get 0
+    local.get 1
+    i32.atomic.store8
+  )
+
+  ;; Narrow read-modify-writes wrap within their width and zero-extend the old value.
+  (func (export "i32_rmw8_add_u") (param i32 i32) (result i32)
+    local.get 0
+    local.get 1
+    i32.atomic.rmw8.add_u
+  )
+
+  ;; Returns the value at the address, which is replaced only if it was equal to the expected one.
+  (func (export "i32_rmw_cmpxchg") (param i32 i32 i32) (result i32)
+    local.get 0
+    local.get 1
+    local.get 2
+    i32.atomic.rmw.cmpxchg
+  )
+
+  (func (export "i64_rmw32_xchg_u") (param i32 i64) (result i64)
+    local.get 0
+    local.get 1
+    i64.atomic.rmw32.xchg_u
+  )
+
+  (func (export "wait32") (param i32 i32 i64) (result i32)
+    local.get 0
+    local.get 1
+    local.get 2
+    memory.atomic.wait32
+  )
+
+  (func (export "notify") (param i32 i32) (result i32)
+    atomic.fence
+    local.get 0
+    local.get 1
+    memory.atomic.notify
+  )
+)
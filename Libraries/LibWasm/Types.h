@@ -329,11 +329,18 @@ enum class AddressType : u8 {
     I64,
 };
 
+// https://webassembly.github.io/threads/core/syntax/types.html#syntax-share
+enum class Share : u8 {
+    Unshared,
+    Shared,
+};
+
 // https://webassembly.github.io/spec/core/bikeshed/#limits%E2%91%A5
 class Limits {
 public:
-    explicit Limits(AddressType address_type, u64 min, Optional<u64> max = {})
+    explicit Limits(AddressType address_type, u64 min, Optional<u64> max = {}, Share share = Share::Unshared)
         : m_address_type(address_type)
+        , m_share(share)
         , m_min(min)
         , m_max(move(max))
     {
@@ -346,17 +353,21 @@ public:
     auto address_type() const { return m_address_type; }
     auto min() const { return m_min; }
     auto& max() const { return m_max; }
+    auto share() const { return m_share; }
+    bool is_shared() const { return m_share == Share::Shared; }
     bool is_subset_of(Limits other) const
     {
         return m_min >= other.min()
             && (!other.max().has_value() || (m_max.has_value() && *m_max <= *other.max()))
-            && m_address_type == other.m_address_type;
+            && m_address_type == other.m_address_type
+            && m_share == other.m_share;
     }
 
     static ParseResult<Limits> parse(ConstrainedStream& stream);
 
 private:
     AddressType m_address_type { AddressType::I32 };
+    Share m_share { Share::Unshared };
     u64 m_min { 0 };
     Optional<u64> m_max;
 };
@@ -250,6 +250,14 @@ void Animatable::set_has_css_defined_animations()
     ensure_impl().has_css_defined_animations = true;
 }
 
+bool Animatable::has_associated_animations() const
+{
+    if (!m_impl)
+        return false;
+
+    return !m_impl->associated_animations.is_empty();
+}
+
 bool Animatable::has_css_defined_animations() const
 {
     if (!m_impl)
@@ -56,6 +56,7 @@ public:
 
     void associate_with_animation(GC::Ref<Animation>);
     void disassociate_with_animation(GC::Ref<Animation>);
+    bool has_associated_animations() const;
 
     void set_has_css_defined_animations();
     bool has_css_defined_animations() const;
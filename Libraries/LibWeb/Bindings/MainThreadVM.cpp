@@ -263,7 +263,7 @@ void initialize_main_thread_vm(AgentType type)
     };
 
     // 8.1.5.4.3 HostEnqueuePromiseJob(job, realm), https://html.spec.whatwg.org/multipage/webappapis.html#hostenqueuepromisejob
-    s_main_thread_vm->host_enqueue_promise_job = [](GC::Ref<GC::Function<JS::ThrowCompletionOr<JS::Value>()>> job, JS::Realm* realm) {
+    s_main_thread_vm->host_enqueue_promise_job = [](JS::PromiseJob job, JS::Realm* realm) {
         auto& vm = *s_main_thread_vm;
 
         // IMPLEMENTATION DEFINED: The JS spec says we must take implementation defined steps to make the currently active script or module at the time of HostEnqueuePromiseJob being invoked
@@ -308,7 +308,7 @@ void initialize_main_thread_vm(AgentType type)
             }
 
             // 2. Let result be job().
-            auto result = job->function()();
+            auto result = job.run(vm);
 
             // 3. If job settings is not null, then clean up after running script with job settings.
             if (job_settings) {
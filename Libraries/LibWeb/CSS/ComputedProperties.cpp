@@ -64,6 +64,59 @@ ComputedProperties::ComputedProperties() = default;
 
 ComputedProperties::~ComputedProperties() = default;
 
+GC::Ref<ComputedProperties> ComputedProperties::clone() const
+{
+    auto clone = heap().allocate<ComputedProperties>();
+    clone->m_property_value_groups = m_property_value_groups;
+    clone->m_property_important = m_property_important;
+    clone->m_property_inherited = m_property_inherited;
+    clone->m_animated_property_inherited = m_animated_property_inherited;
+    clone->m_animated_property_result_of_transition = m_animated_property_result_of_transition;
+    clone->m_animated_property_values = m_animated_property_values;
+    clone->m_display_before_box_type_transformation = m_display_before_box_type_transformation;
+    clone->m_cached_computed_font_list = m_cached_computed_font_list;
+    clone->m_cached_first_available_computed_font = m_cached_first_available_computed_font;
+    clone->m_line_height = m_line_height;
+    clone->m_attempted_pseudo_class_matches = m_attempted_pseudo_class_matches;
+    return clone;
+}
+
+void ComputedProperties::share_property_values_with(ComputedProperties const& other)
+{
+    m_property_value_groups = other.m_property_value_groups;
+}
+
+RefPtr<StyleValue const> const& ComputedProperties::property_value_at(size_t longhand_index) const
+{
+    static RefPtr<StyleValue const> const s_no_value;
+
+    auto [group_index, index_in_group] = property_value_location(longhand_index);
+    auto const& group = m_property_value_groups[group_index];
+    if (!group)
+        return s_no_value;
+    return group->values[index_in_group];
+}
+
+void ComputedProperties::set_property_value_at(size_t longhand_index, RefPtr<StyleValue const> value)
+{
+    auto [group_index, index_in_group] = property_value_location(longhand_index);
+    auto& group = m_property_value_groups[group_index];
+
+    // NB: Storing the value that's already there is common (inherited values, shared initial values), and must not
+    //     cause a shared group to be copied.
+    if (group && group->values[index_in_group] == value)
+        return;
+
+    if (!group) {
+        group = adopt_ref(*new PropertyValueGroup);
+    } else if (group->ref_count() > 1) {
+        auto copy = adopt_ref(*new PropertyValueGroup);
+        copy->values = group->values;
+        group = move(copy);
+    }
+    group->values[index_in_group] = move(value);
+}
+
 void ComputedProperties::visit_edges(Visitor& visitor)
 {
     Base::visit_edges(visitor);
@@ -163,7 +216,7 @@ void ComputedProperties::set_property_without_modifying_flags(PropertyID id, Non
 {
     VERIFY(id >= first_longhand_property_id && id <= last_longhand_property_id);
 
-    m_property_values[to_underlying(id) - to_underlying(first_longhand_property_id)] = move(value);
+    set_property_value_at(to_underlying(id) - to_underlying(first_longhand_property_id), move(value));
 
     if (property_affects_computed_font_list(id))
         clear_computed_font_list_cache();
@@ -173,7 +226,8 @@ void ComputedProperties::revert_property(PropertyID id, ComputedProperties const
 {
     VERIFY(id >= first_longhand_property_id && id <= last_longhand_property_id);
 
-    m_property_values[to_underlying(id) - to_underlying(first_longhand_property_id)] = style_for_revert.m_property_values[to_underlying(id) - to_underlying(first_longhand_property_id)];
+    auto longhand_index = to_underlying(id) - to_underlying(first_longhand_property_id);
+    set_property_value_at(longhand_index, style_for_revert.property_value_at(longhand_index));
     set_property_important(id, style_for_revert.is_property_important(id) ? Important::Yes : Important::No);
     set_property_inherited(id, style_for_revert.is_property_inherited(id) ? Inherited::Yes : Inherited::No);
 }
@@ -222,7 +276,7 @@ StyleValue const& ComputedProperties::property(PropertyID property_id, WithAnima
     }
 
     // By the time we call this method, the property should have been assigned
-    return *m_property_values[to_underlying(property_id) - to_underlying(first_longhand_property_id)];
+    return *property_value_at(to_underlying(property_id) - to_underlying(first_longhand_property_id));
 }
 
 Variant<LengthPercentage, NormalGap> ComputedProperties::gap_value(PropertyID id) const
@@ -933,22 +987,31 @@ Positioning ComputedProperties::position() const
 
 bool ComputedProperties::operator==(ComputedProperties const& other) const
 {
-    for (size_t i = 0; i < m_property_values.size(); ++i) {
-        auto const& my_style = m_property_values[i];
-        auto const& other_style = other.m_property_values[i];
-        if (!my_style) {
-            if (other_style)
-                return false;
+    for (size_t group_index = 0; group_index < number_of_value_groups; ++group_index) {
+        auto const& my_group = m_property_value_groups[group_index];
+        auto const& other_group = other.m_property_value_groups[group_index];
+
+        // OPTIMIZATION: A shared group is trivially equal to itself.
+        if (my_group == other_group)
             continue;
+
+        for (size_t i = 0; i < properties_per_value_group; ++i) {
+            auto const* my_style = my_group ? my_group->values[i].ptr() : nullptr;
+            auto const* other_style = other_group ? other_group->values[i].ptr() : nullptr;
+            if (!my_style) {
+                if (other_style)
+                    return false;
+                continue;
+            }
+            if (!other_style)
+                return false;
+            auto const& my_value = *my_style;
+            auto const& other_value = *other_style;
+            if (my_value.type() != other_value.type())
+                return false;
+            if (my_value != other_value)
+                return false;
         }
-        if (!other_style)
-            return false;
-        auto const& my_value = *my_style;
-        auto const& other_value = *other_style;
-        if (my_value.type() != other_value.type())
-            return false;
-        if (my_value != other_value)
-            return false;
     }
 
     return true;
@@ -9,6 +9,7 @@
 
 #include <AK/HashMap.h>
 #include <AK/NonnullRefPtr.h>
+#include <AK/RefCounted.h>
 #include <LibGC/CellAllocator.h>
 #include <LibGC/Ptr.h>
 #include <LibGfx/Font/Font.h>
@@ -49,12 +50,18 @@ public:
 
     virtual ~ComputedProperties() override;
 
+    // Returns an independent copy that can be handed to another element and modified without affecting this one.
+    [[nodiscard]] GC::Ref<ComputedProperties> clone() const;
+
+    // Starts out with the same values as the given style, without copying any of them until they're overwritten.
+    void share_property_values_with(ComputedProperties const&);
+
     template<typename Callback>
     inline void for_each_property(Callback callback) const
     {
-        for (size_t i = 0; i < m_property_values.size(); ++i) {
-            if (m_property_values[i])
-                callback(static_cast<PropertyID>(i + to_underlying(first_longhand_property_id)), *m_property_values[i]);
+        for (size_t i = 0; i < number_of_longhand_properties; ++i) {
+            if (auto const& value = property_value_at(i))
+                callback(static_cast<PropertyID>(i + to_underlying(first_longhand_property_id)), *value);
         }
     }
 
@@ -293,7 +300,35 @@ private:
     Vector<ShadowData> shadow(PropertyID, Layout::Node const&) const;
     Position position_value(PropertyID) const;
 
-    Array<RefPtr<StyleValue const>, number_of_longhand_properties> m_property_values;
+    // NB: Longhand values are stored in fixed-size groups that are shared between styles (e.g. a parent and its
+    //     children, or elements that got their style from the same cache entry) and only copied once written to.
+    //     Inherited longhands come first in PropertyID order, so they are grouped separately from the others, which
+    //     keeps the groups that children tend to leave untouched apart from the ones they tend to override.
+    static constexpr size_t properties_per_value_group = 16;
+    static constexpr size_t number_of_inherited_longhand_properties = to_underlying(last_inherited_property_id) - to_underlying(first_longhand_property_id) + 1;
+    static constexpr size_t number_of_inherited_value_groups = ceil_div(number_of_inherited_longhand_properties, properties_per_value_group);
+    static constexpr size_t number_of_value_groups = number_of_inherited_value_groups + ceil_div(number_of_longhand_properties - number_of_inherited_longhand_properties, properties_per_value_group);
+
+    struct PropertyValueGroup : public RefCounted<PropertyValueGroup> {
+        Array<RefPtr<StyleValue const>, properties_per_value_group> values;
+    };
+
+    struct PropertyValueLocation {
+        size_t group;
+        size_t index_in_group;
+    };
+    static constexpr PropertyValueLocation property_value_location(size_t longhand_index)
+    {
+        if (longhand_index < number_of_inherited_longhand_properties)
+            return { longhand_index / properties_per_value_group, longhand_index % properties_per_value_group };
+        auto index = longhand_index - number_of_inherited_longhand_properties;
+        return { number_of_inherited_value_groups + index / properties_per_value_group, index % properties_per_value_group };
+    }
+
+    RefPtr<StyleValue const> const& property_value_at(size_t longhand_index) const;
+    void set_property_value_at(size_t longhand_index, RefPtr<StyleValue const>);
+
+    Array<RefPtr<PropertyValueGroup>, number_of_value_groups> m_property_value_groups;
     Array<u8, ceil_div(number_of_longhand_properties, 8uz)> m_property_important {};
     Array<u8, ceil_div(number_of_longhand_properties, 8uz)> m_property_inherited {};
     Array<u8, ceil_div(number_of_longhand_properties, 8uz)> m_animated_property_inherited {};
@@ -0,0 +1,145 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/Debug.h>
+#include <LibWeb/CSS/CascadedProperties.h>
+#include <LibWeb/CSS/ComputedProperties.h>
+#include <LibWeb/CSS/CustomPropertyData.h>
+#include <LibWeb/CSS/MatchedPropertiesCache.h>
+#include <LibWeb/DOM/Attr.h>
+#include <LibWeb/DOM/Element.h>
+#include <LibWeb/DOM/NamedNodeMap.h>
+#include <LibWeb/HTML/TagNames.h>
+#include <LibWeb/Namespace.h>
+
+namespace Web::CSS {
+
+bool MatchedPropertiesCache::Key::operator==(Key const& other) const
+{
+    return hash == other.hash
+        && parent_style == other.parent_style
+        && parent_custom_property_data == other.parent_custom_property_data
+        && local_name == other.local_name
+        && rules == other.rules;
+}
+
+void MatchedPropertiesCache::begin()
+{
+    m_active = true;
+    m_statistics = {};
+}
+
+void MatchedPropertiesCache::end()
+{
+    m_active = false;
+    m_entries.clear();
+    m_origins.clear();
+
+    if constexpr (UPDATE_STYLE_DEBUG) {
+        if (m_statistics.hits || m_statistics.misses)
+            dbgln("MatchedPropertiesCache: {} hits, {} misses", m_statistics.hits, m_statistics.misses);
+    }
+}
+
+bool MatchedPropertiesCache::is_eligible(DOM::Element const& element)
+{
+    if (element.use_pseudo_element().has_value())
+        return false;
+    if (element.namespace_uri() != Namespace::HTML)
+        return false;
+
+    // NB: These pull presentational hints or style adjustments from somewhere other than their own attributes.
+    if (element.local_name().is_one_of(HTML::TagNames::input, HTML::TagNames::td, HTML::TagNames::th, HTML::TagNames::body))
+        return false;
+
+    if (element.inline_style() || element.supports_dimension_attributes())
+        return false;
+
+    auto parent = element.element_to_inherit_style_from({});
+    if (!parent || !parent->computed_properties())
+        return false;
+
+    if (element.has_associated_animations())
+        return false;
+
+    if (auto attributes = element.attributes()) {
+        for (size_t i = 0; i < attributes->length(); ++i) {
+            if (element.is_presentational_hint(attributes->item(i)->local_name()))
+                return false;
+        }
+    }
+
+    return true;
+}
+
+Optional<MatchedPropertiesCache::Entry const&> MatchedPropertiesCache::find(Key const& key)
+{
+    VERIFY(m_active);
+
+    if (auto it = m_entries.find(key); it != m_entries.end()) {
+        ++m_statistics.hits;
+        return it->value;
+    }
+
+    ++m_statistics.misses;
+    return {};
+}
+
+void MatchedPropertiesCache::insert(Key key, DOM::Element const& element, GC::Ref<ComputedProperties> computed_properties, GC::Ref<CascadedProperties> cascaded_properties, RefPtr<CustomPropertyData const> custom_property_data)
+{
+    VERIFY(m_active);
+
+    // NB: attr() and the tree-counting functions look at the element itself, and animations and transitions modify
+    //     the style of the element they run on.
+    if (element.style_uses_attr_css_function() || element.style_uses_tree_counting_function())
+        return;
+    if (element.has_associated_animations() || !element.property_ids_with_existing_transitions({}).is_empty())
+        return;
+
+    // NB: Nothing here outlives a single style update, so starting over is cheaper than any eviction policy.
+    if (m_entries.size() >= max_entry_count)
+        m_entries.clear();
+
+    m_entries.set(move(key),
+        Entry {
+            .computed_properties = computed_properties,
+            .cascaded_properties = cascaded_properties,
+            .custom_property_data = move(custom_property_data),
+            .uses_var_css_function = element.style_uses_var_css_function(),
+            .uses_if_css_function = element.style_uses_if_css_function(),
+            .uses_inherit_css_function = element.style_uses_inherit_css_function(),
+        });
+}
+
+void MatchedPropertiesCache::did_reuse(ComputedProperties const& reused, ComputedProperties const& original)
+{
+    VERIFY(m_active);
+    m_origins.set(reused, original);
+}
+
+ComputedProperties const* MatchedPropertiesCache::origin_of(ComputedProperties const* style) const
+{
+    if (!style)
+        return nullptr;
+    if (auto it = m_origins.find(GC::Ref { *style }); it != m_origins.end())
+        return it->value.ptr();
+    return style;
+}
+
+void MatchedPropertiesCache::visit_edges(GC::Cell::Visitor& visitor)
+{
+    for (auto& [key, entry] : m_entries) {
+        visitor.visit(key.parent_style);
+        visitor.visit(entry.computed_properties);
+        visitor.visit(entry.cascaded_properties);
+    }
+    for (auto& [reused, original] : m_origins) {
+        visitor.visit(reused);
+        visitor.visit(original);
+    }
+}
+
+}
@@ -0,0 +1,92 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/FlyString.h>
+#include <AK/HashMap.h>
+#include <AK/Optional.h>
+#include <AK/RefPtr.h>
+#include <AK/Vector.h>
+#include <LibGC/Cell.h>
+#include <LibGC/Ptr.h>
+#include <LibWeb/Forward.h>
+
+namespace Web::CSS {
+
+// Remembers the outcome of the cascade for a given list of matched rules. Two elements of the same type that match
+// exactly the same rules in the same order, and inherit from the same parent style, end up with the same computed
+// style as long as nothing else about the element feeds into it (inline style, presentational hints, attr(), ...).
+// Unlike StyleSharingCache, this doesn't require the elements to look the same to selectors, so it still has to run
+// selector matching, but it skips everything after that.
+//
+// The cache is only populated while Document::update_style() runs, since the matched rules are identified by address.
+class MatchedPropertiesCache {
+public:
+    struct Statistics {
+        size_t hits { 0 };
+        size_t misses { 0 };
+    };
+
+    struct Key {
+        // The matched rules of each cascade origin and layer, separated by null pointers.
+        Vector<MatchingRule const*, 32> rules;
+        FlyString local_name;
+        GC::Ptr<ComputedProperties const> parent_style;
+        RefPtr<CustomPropertyData const> parent_custom_property_data;
+        u32 hash { 0 };
+
+        bool operator==(Key const&) const;
+    };
+
+    struct Entry {
+        GC::Ref<ComputedProperties> computed_properties;
+        GC::Ref<CascadedProperties> cascaded_properties;
+        RefPtr<CustomPropertyData const> custom_property_data;
+        bool uses_var_css_function { false };
+        bool uses_if_css_function { false };
+        bool uses_inherit_css_function { false };
+    };
+
+    void begin();
+    void end();
+    [[nodiscard]] bool is_active() const { return m_active; }
+
+    // Whether nothing but the matched rules and the parent style feeds into the style of this element.
+    [[nodiscard]] static bool is_eligible(DOM::Element const&);
+
+    [[nodiscard]] Optional<Entry const&> find(Key const&);
+    void insert(Key, DOM::Element const&, GC::Ref<ComputedProperties>, GC::Ref<CascadedProperties>, RefPtr<CustomPropertyData const>);
+
+    // Records that reused was copied from the style of an entry, so that children of both can share a key as cousins.
+    void did_reuse(ComputedProperties const& reused, ComputedProperties const& original);
+
+    // Returns the style of the entry that the given one was copied from, or the style itself if it wasn't.
+    [[nodiscard]] ComputedProperties const* origin_of(ComputedProperties const*) const;
+
+    [[nodiscard]] Statistics const& statistics() const { return m_statistics; }
+
+    void visit_edges(GC::Cell::Visitor&);
+
+private:
+    static constexpr size_t max_entry_count = 256;
+
+    bool m_active { false };
+    HashMap<Key, Entry> m_entries;
+    HashMap<GC::Ref<ComputedProperties const>, GC::Ref<ComputedProperties const>> m_origins;
+    Statistics m_statistics;
+};
+
+}
+
+namespace AK {
+
+template<>
+struct Traits<Web::CSS::MatchedPropertiesCache::Key> : public DefaultTraits<Web::CSS::MatchedPropertiesCache::Key> {
+    static unsigned hash(Web::CSS::MatchedPropertiesCache::Key const& key) { return key.hash; }
+};
+
+}
@@ -137,6 +137,8 @@ void StyleComputer::visit_edges(Visitor& visitor)
     visitor.visit(m_document);
     if (m_has_result_cache)
         visitor.visit(*m_has_result_cache);
+    m_style_sharing_cache.visit_edges(visitor);
+    m_matched_properties_cache.visit_edges(visitor);
 
     if (m_cached_font_computation_context.has_value())
         m_cached_font_computation_context->visit_edges(visitor);
@@ -1778,6 +1780,75 @@ GC::Ptr<ComputedProperties> StyleComputer::compute_pseudo_element_style_if_neede
     return compute_style_impl(abstract_element, ComputeStyleMode::CreatePseudoElementStyleIfNeeded, did_change_custom_properties, style_scope);
 }
 
+static bool have_own_custom_properties_changed(RefPtr<CustomPropertyData const> const& old_data, RefPtr<CustomPropertyData const> const& new_data)
+{
+    if (old_data.ptr() == new_data.ptr())
+        return false;
+    auto const& old_own = old_data ? old_data->own_values() : OrderedHashMap<FlyString, StyleProperty> {};
+    auto const& new_own = new_data ? new_data->own_values() : OrderedHashMap<FlyString, StyleProperty> {};
+    return old_own != new_own;
+}
+
+MatchedPropertiesCache::Key StyleComputer::make_matched_properties_key(DOM::AbstractElement abstract_element, MatchingRuleSet const& matching_rule_set) const
+{
+    MatchedPropertiesCache::Key key;
+    key.local_name = abstract_element.element().local_name();
+
+    // NB: A style that was copied from another one is equivalent to it, so look through to the original. That lets
+    //     cousins whose parents shared their style or reused a cached one hit the cache as well. A style shared by
+    //     StyleSharingCache may itself be a copy from this cache, but never the other way around.
+    auto parent = abstract_element.element_to_inherit_style_from();
+    key.parent_style = m_matched_properties_cache.origin_of(m_style_sharing_cache.origin_of(parent->computed_properties().ptr()));
+    key.parent_custom_property_data = parent->custom_property_data();
+
+    u32 hash = pair_int_hash(key.local_name.hash(), ptr_hash(key.parent_style.ptr()));
+    hash = pair_int_hash(hash, ptr_hash(key.parent_custom_property_data.ptr()));
+    auto append_rules = [&](Vector<MatchingRule const*> const& rules) {
+        for (auto const* rule : rules) {
+            key.rules.append(rule);
+            hash = pair_int_hash(hash, ptr_hash(rule));
+        }
+        key.rules.append(nullptr);
+        hash = pair_int_hash(hash, 0);
+    };
+
+    append_rules(matching_rule_set.user_agent_rules);
+    append_rules(matching_rule_set.user_rules);
+    for (auto const& layer : matching_rule_set.author_rules)
+        append_rules(layer.rules);
+
+    key.hash = hash;
+    return key;
+}
+
+// Gives the element its own copy of a style that was computed for another element, as if it had been computed for this
+// one. The copy is needed since starting transitions may modify it.
+GC::Ref<ComputedProperties> StyleComputer::copy_reused_style(DOM::AbstractElement abstract_element, ReusableStyle const& style, Optional<bool&> did_change_custom_properties) const
+{
+    // NB: These flags drive invalidation, so the element has to know about what went into the style it's reusing.
+    auto& element = abstract_element.element();
+    if (style.uses_var_css_function)
+        element.set_style_uses_var_css_function();
+    if (style.uses_if_css_function)
+        element.set_style_uses_if_css_function();
+    if (style.uses_inherit_css_function)
+        element.set_style_uses_inherit_css_function();
+
+    auto old_custom_property_data = abstract_element.custom_property_data();
+    abstract_element.set_custom_property_data(style.custom_property_data);
+    abstract_element.set_cascaded_properties(style.cascaded_properties);
+
+    auto computed_properties = style.computed_properties.clone();
+    compute_transitioned_properties(computed_properties, abstract_element);
+    if (auto previous_style = abstract_element.computed_properties())
+        start_needed_transitions(*previous_style, computed_properties, abstract_element);
+
+    if (did_change_custom_properties.has_value() && have_own_custom_properties_changed(old_custom_property_data, abstract_element.custom_property_data()))
+        *did_change_custom_properties = true;
+
+    return computed_properties;
+}
+
 GC::Ptr<ComputedProperties> StyleComputer::compute_style_impl(DOM::AbstractElement abstract_element, ComputeStyleMode mode, Optional<bool&> did_change_custom_properties, StyleScope const& style_scope) const
 {
     style_scope.build_rule_cache_if_needed();
@@ -1812,11 +1883,57 @@ GC::Ptr<ComputedProperties> StyleComputer::compute_style_impl(DOM::AbstractEleme
 
     ScopeGuard guard { [&abstract_element]() { abstract_element.element().set_needs_style_update(false); } };
 
+    // OPTIMIZATION: If a sibling or cousin we've just styled is guaranteed to end up with the same style as this
+    //               element, skip selector matching and the cascade and start from a copy of its style instead.
+    if (mode == ComputeStyleMode::Normal && !abstract_element.pseudo_element().has_value() && m_style_sharing_cache.is_active()) {
+        if (auto shared_style = m_style_sharing_cache.find(abstract_element.element(), style_scope); shared_style.has_value()) {
+            auto computed_properties = copy_reused_style(abstract_element,
+                {
+                    .computed_properties = shared_style->computed_properties,
+                    .cascaded_properties = shared_style->cascaded_properties,
+                    .custom_property_data = shared_style->custom_property_data,
+                    .uses_var_css_function = shared_style->element->style_uses_var_css_function(),
+                    .uses_if_css_function = shared_style->element->style_uses_if_css_function(),
+                    .uses_inherit_css_function = shared_style->element->style_uses_inherit_css_function(),
+                },
+                did_change_custom_properties);
+            if (abstract_element.element().property_ids_with_existing_transitions({}).is_empty())
+                m_style_sharing_cache.did_share(*computed_properties, *shared_style->computed_properties);
+            return computed_properties;
+        }
+    }
+
     // 1. Perform the cascade. This produces the "specified style"
     bool did_match_any_pseudo_element_rules = false;
     PseudoClassBitmap attempted_pseudo_class_matches;
     auto matching_rule_set = build_matching_rule_set(abstract_element, attempted_pseudo_class_matches, did_match_any_pseudo_element_rules, mode, style_scope);
 
+    // OPTIMIZATION: If another element of the same type matched exactly the same rules and inherits from an equivalent
+    //               style, the cascade is going to produce the same result for this one, so start from a copy of that.
+    Optional<MatchedPropertiesCache::Key> matched_properties_key;
+    if (mode == ComputeStyleMode::Normal && !abstract_element.pseudo_element().has_value() && m_matched_properties_cache.is_active() && MatchedPropertiesCache::is_eligible(abstract_element.element())) {
+        matched_properties_key = make_matched_properties_key(abstract_element, matching_rule_set);
+        if (auto entry = m_matched_properties_cache.find(*matched_properties_key); entry.has_value()) {
+            auto& element = abstract_element.element();
+            auto computed_properties = copy_reused_style(abstract_element,
+                {
+                    .computed_properties = entry->computed_properties,
+                    .cascaded_properties = entry->cascaded_properties,
+                    .custom_property_data = entry->custom_property_data,
+                    .uses_var_css_function = entry->uses_var_css_function,
+                    .uses_if_css_function = entry->uses_if_css_function,
+                    .uses_inherit_css_function = entry->uses_inherit_css_function,
+                },
+                did_change_custom_properties);
+            computed_properties->set_attempted_pseudo_class_matches(attempted_pseudo_class_matches);
+            if (element.property_ids_with_existing_transitions({}).is_empty())
+                m_matched_properties_cache.did_reuse(*computed_properties, *entry->computed_properties);
+            if (m_style_sharing_cache.is_active())
+                m_style_sharing_cache.insert(element, computed_properties, entry->cascaded_properties, entry->custom_property_data);
+            return computed_properties;
+        }
+    }
+
     if (mode == ComputeStyleMode::CreatePseudoElementStyleIfNeeded) {
         // NOTE: If we're computing style for a pseudo-element, we look for a number of reasons to bail early.
 
@@ -1899,15 +2016,13 @@ GC::Ptr<ComputedProperties> StyleComputer::compute_style_impl(DOM::AbstractEleme
     auto computed_properties = compute_properties(abstract_element, cascaded_properties);
     computed_properties->set_attempted_pseudo_class_matches(attempted_pseudo_class_matches);
 
-    if (did_change_custom_properties.has_value()) {
-        auto new_custom_property_data = abstract_element.custom_property_data();
-        if (old_custom_property_data.ptr() != new_custom_property_data.ptr()) {
-            auto const& old_own = old_custom_property_data ? old_custom_property_data->own_values() : OrderedHashMap<FlyString, StyleProperty> {};
-            auto const& new_own = new_custom_property_data ? new_custom_property_data->own_values() : OrderedHashMap<FlyString, StyleProperty> {};
-            if (old_own != new_own)
-                *did_change_custom_properties = true;
-        }
-    }
+    if (did_change_custom_properties.has_value() && have_own_custom_properties_changed(old_custom_property_data, abstract_element.custom_property_data()))
+        *did_change_custom_properties = true;
+
+    if (mode == ComputeStyleMode::Normal && !abstract_element.pseudo_element().has_value() && m_style_sharing_cache.is_active())
+        m_style_sharing_cache.insert(abstract_element.element(), computed_properties, cascaded_properties, abstract_element.custom_property_data());
+    if (matched_properties_key.has_value())
+        m_matched_properties_cache.insert(matched_properties_key.release_value(), abstract_element.element(), computed_properties, cascaded_properties, abstract_element.custom_property_data());
 
     return computed_properties;
 }
@@ -2007,12 +2122,18 @@ GC::Ref<ComputedProperties> StyleComputer::compute_properties(DOM::AbstractEleme
 
     auto computed_style = document().heap().allocate<CSS::ComputedProperties>();
 
+    auto const& computed_properties_to_inherit_from = abstract_element.element_to_inherit_style_from().map([](auto const& element) { return element.computed_properties(); }).value_or(nullptr);
+
+    // OPTIMIZATION: Every longhand gets assigned below, but most of them end up with the same value as in the parent
+    //               (inherited values, and non-inherited ones left at their initial value). Starting out with the
+    //               parent's values lets us keep sharing the storage for those instead of copying them.
+    if (computed_properties_to_inherit_from)
+        computed_style->share_property_values_with(*computed_properties_to_inherit_from);
+
     auto new_font_size = recascade_font_size_if_needed(abstract_element, cascaded_properties);
     if (new_font_size)
         computed_style->set_property(PropertyID::FontSize, *new_font_size, ComputedProperties::Inherited::No, Important::No);
 
-    auto const& computed_properties_to_inherit_from = abstract_element.element_to_inherit_style_from().map([](auto const& element) { return element.computed_properties(); }).value_or(nullptr);
-
     Function<NonnullRefPtr<StyleValue const>(PropertyID)> const get_property_specified_value = [&](auto property_id) -> NonnullRefPtr<StyleValue const> {
         return computed_style->property(property_id);
     };
@@ -2937,6 +3058,18 @@ void StyleComputer::reset_has_result_cache()
         m_has_result_cache->clear();
 }
 
+void StyleComputer::begin_style_update()
+{
+    m_style_sharing_cache.begin();
+    m_matched_properties_cache.begin();
+}
+
+void StyleComputer::end_style_update()
+{
+    m_style_sharing_cache.end();
+    m_matched_properties_cache.end();
+}
+
 void StyleComputer::push_ancestor(DOM::Element const& element)
 {
     for_each_element_hash(element, [&](u32 hash) {
@@ -15,10 +15,12 @@
 #include <LibWeb/CSS/CSSKeyframesRule.h>
 #include <LibWeb/CSS/CSSStyleDeclaration.h>
 #include <LibWeb/CSS/CascadeOrigin.h>
+#include <LibWeb/CSS/MatchedPropertiesCache.h>
 #include <LibWeb/CSS/Selector.h>
 #include <LibWeb/CSS/SelectorEngine.h>
 #include <LibWeb/CSS/StyleInvalidationData.h>
 #include <LibWeb/CSS/StyleScope.h>
+#include <LibWeb/CSS/StyleSharingCache.h>
 #include <LibWeb/Export.h>
 #include <LibWeb/Forward.h>
 
@@ -96,6 +98,8 @@ public:
 
     void reset_ancestor_filter();
     void reset_has_result_cache();
+    void begin_style_update();
+    void end_style_update();
     void push_ancestor(DOM::Element const&);
     void pop_ancestor(DOM::Element const&);
 
@@ -166,6 +170,19 @@ private:
 
     [[nodiscard]] GC::Ptr<ComputedProperties> compute_style_impl(DOM::AbstractElement, ComputeStyleMode, Optional<bool&> did_change_custom_properties, StyleScope const&) const;
     [[nodiscard]] GC::Ref<CascadedProperties> compute_cascaded_values(DOM::AbstractElement, bool did_match_any_pseudo_element_rules, ComputeStyleMode, MatchingRuleSet const&) const;
+    [[nodiscard]] MatchedPropertiesCache::Key make_matched_properties_key(DOM::AbstractElement, MatchingRuleSet const&) const;
+
+    // A style computed for another element that is known to be what this one would end up with as well.
+    struct ReusableStyle {
+        ComputedProperties const& computed_properties;
+        GC::Ref<CascadedProperties> cascaded_properties;
+        RefPtr<CustomPropertyData const> custom_property_data;
+        bool uses_var_css_function { false };
+        bool uses_if_css_function { false };
+        bool uses_inherit_css_function { false };
+    };
+    [[nodiscard]] GC::Ref<ComputedProperties> copy_reused_style(DOM::AbstractElement, ReusableStyle const&, Optional<bool&> did_change_custom_properties) const;
+
     void compute_custom_properties(ComputedProperties&, DOM::AbstractElement) const;
     void start_needed_transitions(ComputedProperties const& old_style, ComputedProperties& new_style, DOM::AbstractElement) const;
     void resolve_effective_overflow_values(ComputedProperties&) const;
@@ -210,6 +227,8 @@ private:
 
     OwnPtr<CountingBloomFilter<u8, 14>> m_ancestor_filter;
     OwnPtr<SelectorEngine::HasResultCache> m_has_result_cache;
+    mutable StyleSharingCache m_style_sharing_cache;
+    mutable MatchedPropertiesCache m_matched_properties_cache;
 };
 
 inline bool StyleComputer::should_reject_with_ancestor_filter(Selector const& selector) const
@@ -378,6 +378,10 @@ void StyleScope::collect_selector_insights(Selector const& selector, SelectorIns
 {
     for (auto const& compound_selector : selector.compound_selectors()) {
         for (auto const& simple_selector : compound_selector.simple_selectors) {
+            if (simple_selector.type == Selector::SimpleSelector::Type::Attribute) {
+                insights.attribute_names_used_in_selectors.set(simple_selector.attribute().qualified_name.name.lowercase_name);
+                continue;
+            }
             if (simple_selector.type == Selector::SimpleSelector::Type::PseudoClass) {
                 if (simple_selector.pseudo_class().type == PseudoClass::Has) {
                     insights.has_has_selectors = true;
@@ -489,6 +493,12 @@ bool StyleScope::have_has_selectors() const
     return m_selector_insights->has_has_selectors;
 }
 
+bool StyleScope::is_attribute_name_used_in_selectors(FlyString const& lowercase_name) const
+{
+    build_rule_cache_if_needed();
+    return m_selector_insights->attribute_names_used_in_selectors.contains(lowercase_name);
+}
+
 DOM::Document& StyleScope::document() const
 {
     return m_node->document();
@@ -8,6 +8,7 @@
 
 #include <AK/FlyString.h>
 #include <AK/HashMap.h>
+#include <AK/HashTable.h>
 #include <AK/Optional.h>
 #include <AK/Vector.h>
 #include <LibGC/Ptr.h>
@@ -71,6 +72,7 @@ struct RuleCaches {
 
 struct SelectorInsights {
     bool has_has_selectors { false };
+    HashTable<FlyString> attribute_names_used_in_selectors;
 };
 
 class StyleScope {
@@ -103,6 +105,7 @@ public:
 
     [[nodiscard]] bool may_have_has_selectors() const;
     [[nodiscard]] bool have_has_selectors() const;
+    [[nodiscard]] bool is_attribute_name_used_in_selectors(FlyString const& lowercase_name) const;
 
     void for_each_active_css_style_sheet(Function<void(CSS::CSSStyleSheet&)> const& callback) const;
 
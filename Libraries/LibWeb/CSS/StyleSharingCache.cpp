@@ -0,0 +1,287 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/Debug.h>
+#include <LibWeb/CSS/CascadedProperties.h>
+#include <LibWeb/CSS/ComputedProperties.h>
+#include <LibWeb/CSS/CustomPropertyData.h>
+#include <LibWeb/CSS/StyleScope.h>
+#include <LibWeb/CSS/StyleSharingCache.h>
+#include <LibWeb/DOM/Attr.h>
+#include <LibWeb/DOM/Document.h>
+#include <LibWeb/DOM/Element.h>
+#include <LibWeb/DOM/NamedNodeMap.h>
+#include <LibWeb/HTML/AttributeNames.h>
+#include <LibWeb/HTML/TagNames.h>
+#include <LibWeb/Namespace.h>
+
+namespace Web::CSS {
+
+void StyleSharingCache::begin()
+{
+    m_active = true;
+    m_statistics = {};
+}
+
+void StyleSharingCache::end()
+{
+    m_active = false;
+    m_candidates.clear_with_capacity();
+    m_origins.clear();
+
+    if constexpr (UPDATE_STYLE_DEBUG) {
+        if (m_statistics.hits || m_statistics.misses)
+            dbgln("StyleSharingCache: {} hits, {} misses", m_statistics.hits, m_statistics.misses);
+    }
+}
+
+bool StyleSharingCache::is_eligible(DOM::Element const& element)
+{
+    if (element.use_pseudo_element().has_value())
+        return false;
+    if (element.namespace_uri() != Namespace::HTML)
+        return false;
+
+    // NB: HTMLInputElement adjusts its computed style based on its type and size, which we don't compare.
+    if (element.local_name() == HTML::TagNames::input)
+        return false;
+
+    // These can only match a single element, or come from outside the stylesheets entirely.
+    if (element.id().has_value() || element.inline_style())
+        return false;
+
+    // Shadow trees bring :host, ::slotted() and ::part() into play, so we stay out of them altogether.
+    if (!element.root().is_document() || element.shadow_root() || element.assigned_slot_internal())
+        return false;
+
+    auto const* parent = element.parent_element();
+    if (!parent || parent->shadow_root() || !parent->computed_properties())
+        return false;
+    if (element.element_to_inherit_style_from({}) != parent)
+        return false;
+
+    if (element.has_associated_animations())
+        return false;
+
+    return true;
+}
+
+// Returns whether the two elements are in the same state with regard to the given pseudo-class, or an empty Optional if
+// that can't be cheaply determined (or depends on something other than the element itself).
+static Optional<bool> have_equal_pseudo_class_state(PseudoClass pseudo_class, DOM::Element const& a, DOM::Element const& b)
+{
+    auto compare = [&](auto const& matches) { return matches(a) == matches(b); };
+
+    switch (pseudo_class) {
+    // NB: These only take selector arguments, whose pseudo-classes are recorded on their own.
+    case PseudoClass::Is:
+    case PseudoClass::Where:
+    case PseudoClass::Not:
+    // NB: We never match :visited.
+    case PseudoClass::Visited:
+        return true;
+    case PseudoClass::Link:
+    case PseudoClass::AnyLink:
+        return compare([](auto const& element) { return element.matches_link_pseudo_class(); });
+    case PseudoClass::LocalLink:
+        return compare([](auto const& element) { return element.matches_local_link_pseudo_class(); });
+    case PseudoClass::Active:
+        return compare([](auto const& element) { return element.is_being_activated(); });
+    case PseudoClass::Hover:
+        return compare([](auto const& element) {
+            auto const* hovered_node = element.document().hovered_node();
+            return hovered_node && (&element == hovered_node || element.is_shadow_including_ancestor_of(*hovered_node));
+        });
+    case PseudoClass::Focus:
+        return compare([](auto const& element) { return element.is_focused(); });
+    case PseudoClass::FocusVisible:
+        return compare([](auto const& element) { return element.is_focused() && element.should_indicate_focus(); });
+    case PseudoClass::FocusWithin:
+        return compare([](auto const& element) {
+            auto focused_area = element.document().focused_area();
+            return focused_area && element.is_inclusive_ancestor_of(*focused_area);
+        });
+    case PseudoClass::Enabled:
+        return compare([](auto const& element) { return element.matches_enabled_pseudo_class(); });
+    case PseudoClass::Disabled:
+        return compare([](auto const& element) { return element.matches_disabled_pseudo_class(); });
+    case PseudoClass::Checked:
+        return compare([](auto const& element) { return element.matches_checked_pseudo_class(); });
+    case PseudoClass::Unchecked:
+        return compare([](auto const& element) { return element.matches_unchecked_pseudo_class(); });
+    case PseudoClass::Defined:
+        return compare([](auto const& element) { return element.is_defined(); });
+    case PseudoClass::Target:
+        return compare([](auto const& element) { return element.is_target(); });
+    default:
+        return {};
+    }
+}
+
+static bool have_equal_pseudo_class_states(ComputedProperties const& candidate_style, DOM::Element const& a, DOM::Element const& b)
+{
+    for (size_t i = 0; i < to_underlying(PseudoClass::__Count); ++i) {
+        auto pseudo_class = static_cast<PseudoClass>(i);
+        if (!candidate_style.has_attempted_match_against_pseudo_class(pseudo_class))
+            continue;
+        auto equal = have_equal_pseudo_class_state(pseudo_class, a, b);
+        if (!equal.has_value() || !equal.value())
+            return false;
+    }
+    return true;
+}
+
+// Whether selector matching found that the element's style depends on its position among its siblings.
+static bool is_affected_by_structure(DOM::Element const& element)
+{
+    return element.affected_by_forward_structural_changes()
+        || element.affected_by_backward_structural_changes()
+        || element.affected_by_has_pseudo_class_in_subject_position()
+        || element.affected_by_has_pseudo_class_in_non_subject_position()
+        || element.affected_by_has_pseudo_class_with_relative_selector_that_has_sibling_combinator()
+        || element.sibling_invalidation_distance() != 0;
+}
+
+static bool have_equal_attributes(DOM::Element const& a, DOM::Element const& b, StyleScope const& style_scope)
+{
+    if (a.attribute_list_size() != b.attribute_list_size())
+        return false;
+    if (a.attribute_list_size() == 0)
+        return true;
+
+    auto const& a_attributes = *a.attributes();
+    auto const& b_attributes = *b.attributes();
+    for (size_t i = 0; i < a_attributes.length(); ++i) {
+        auto const& attribute = *a_attributes.item(i);
+        auto const* other_attribute = b_attributes.get_attribute(attribute.name());
+        if (!other_attribute || other_attribute->namespace_uri() != attribute.namespace_uri())
+            return false;
+
+        // NB: Values only matter if something can look at them. The class attribute is compared separately.
+        auto const& name = attribute.local_name();
+        if (name == HTML::AttributeNames::class_)
+            continue;
+        auto value_matters = name == HTML::AttributeNames::lang
+            || name == HTML::AttributeNames::dir
+            || a.is_presentational_hint(name)
+            || style_scope.is_attribute_name_used_in_selectors(name.to_ascii_lowercase());
+        if (value_matters && attribute.value() != other_attribute->value())
+            return false;
+    }
+    return true;
+}
+
+ComputedProperties const* StyleSharingCache::origin_of(ComputedProperties const* style) const
+{
+    if (!style)
+        return nullptr;
+    if (auto it = m_origins.find(GC::Ref { *style }); it != m_origins.end())
+        return it->value.ptr();
+    return style;
+}
+
+bool StyleSharingCache::can_share(SharedStyle const& candidate, DOM::Element const& element, StyleScope const& style_scope) const
+{
+    auto const& candidate_element = *candidate.element;
+    if (&candidate_element == &element)
+        return false;
+    if (candidate_element.local_name() != element.local_name())
+        return false;
+
+    auto const* candidate_parent = candidate_element.parent_element();
+    auto const* parent = element.parent_element();
+    if (!candidate_parent || origin_of(candidate_parent->computed_properties().ptr()) != origin_of(parent->computed_properties().ptr()))
+        return false;
+    if (candidate_parent->custom_property_data({}) != parent->custom_property_data({}))
+        return false;
+
+    if (candidate_element.class_names() != element.class_names())
+        return false;
+    if (!have_equal_attributes(candidate_element, element, style_scope))
+        return false;
+
+    // NB: attr() and the tree-counting functions look at the element itself rather than at its style.
+    if (candidate_element.style_uses_attr_css_function() || candidate_element.style_uses_tree_counting_function())
+        return false;
+
+    auto const& candidate_style = *candidate.computed_properties;
+    if (is_affected_by_structure(candidate_element) || !have_equal_pseudo_class_states(candidate_style, candidate_element, element))
+        return false;
+
+    // Selectors can also look at ancestors. Their classes and attributes are known to be equivalent up to the common
+    // ancestor (that's what allowed them to share in the first place), but their states may not be.
+    for (; candidate_parent != parent; candidate_parent = candidate_parent->parent_element(), parent = parent->parent_element()) {
+        if (!candidate_parent || !parent)
+            return false;
+        if (origin_of(candidate_parent->computed_properties().ptr()) != origin_of(parent->computed_properties().ptr()))
+            return false;
+        if (is_affected_by_structure(*candidate_parent) || is_affected_by_structure(*parent))
+            return false;
+        if (!have_equal_pseudo_class_states(candidate_style, *candidate_parent, *parent))
+            return false;
+    }
+
+    return true;
+}
+
+Optional<StyleSharingCache::SharedStyle const&> StyleSharingCache::find(DOM::Element const& element, StyleScope const& style_scope)
+{
+    VERIFY(m_active);
+
+    if (style_scope.may_have_has_selectors() || !is_eligible(element)) {
+        ++m_statistics.misses;
+        return {};
+    }
+
+    // NB: Look at the most recently styled elements first, they're the most likely siblings and cousins.
+    for (size_t i = m_candidates.size(); i > 0; --i) {
+        auto const& candidate = m_candidates[i - 1];
+        if (can_share(candidate, element, style_scope)) {
+            ++m_statistics.hits;
+            return candidate;
+        }
+    }
+
+    ++m_statistics.misses;
+    return {};
+}
+
+void StyleSharingCache::insert(DOM::Element const& element, GC::Ref<ComputedProperties> computed_properties, GC::Ref<CascadedProperties> cascaded_properties, RefPtr<CustomPropertyData const> custom_property_data)
+{
+    VERIFY(m_active);
+
+    if (!is_eligible(element))
+        return;
+
+    // NB: A style that has had transitions applied to it is specific to this element.
+    if (!element.property_ids_with_existing_transitions({}).is_empty())
+        return;
+
+    if (m_candidates.size() == max_candidate_count)
+        m_candidates.take_first();
+    m_candidates.append({ computed_properties, cascaded_properties, move(custom_property_data), element });
+}
+
+void StyleSharingCache::did_share(ComputedProperties const& shared, ComputedProperties const& origin)
+{
+    VERIFY(m_active);
+    m_origins.set(shared, GC::Ref { *origin_of(&origin) });
+}
+
+void StyleSharingCache::visit_edges(GC::Cell::Visitor& visitor)
+{
+    for (auto& candidate : m_candidates) {
+        visitor.visit(candidate.computed_properties);
+        visitor.visit(candidate.cascaded_properties);
+        visitor.visit(candidate.element);
+    }
+    for (auto& [shared, origin] : m_origins) {
+        visitor.visit(shared);
+        visitor.visit(origin);
+    }
+}
+
+}
@@ -0,0 +1,71 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/HashMap.h>
+#include <AK/Optional.h>
+#include <AK/RefPtr.h>
+#include <AK/Vector.h>
+#include <LibGC/Cell.h>
+#include <LibGC/Ptr.h>
+#include <LibWeb/Forward.h>
+
+namespace Web::CSS {
+
+// Lets an element reuse the computed style of a recently styled sibling or cousin instead of running selector
+// matching and the cascade again. This only happens when we can prove the two would end up with the same style:
+// both inherit from equivalent parent styles, look the same to every selector that can match them, and neither
+// depends on anything that can_share() doesn't compare (ids, inline style, :has(), structural pseudo-classes,
+// sibling combinators, animations, ...).
+//
+// The cache is only populated while Document::update_style() runs, since nothing it relies on can change then.
+class StyleSharingCache {
+public:
+    struct Statistics {
+        size_t hits { 0 };
+        size_t misses { 0 };
+    };
+
+    struct SharedStyle {
+        GC::Ref<ComputedProperties> computed_properties;
+        GC::Ref<CascadedProperties> cascaded_properties;
+        RefPtr<CustomPropertyData const> custom_property_data;
+        GC::Ref<DOM::Element const> element;
+    };
+
+    void begin();
+    void end();
+    [[nodiscard]] bool is_active() const { return m_active; }
+
+    // Whether an element is simple enough to take part in style sharing at all, either as a candidate or as a user.
+    [[nodiscard]] static bool is_eligible(DOM::Element const&);
+
+    [[nodiscard]] Optional<SharedStyle const&> find(DOM::Element const&, StyleScope const&);
+    void insert(DOM::Element const&, GC::Ref<ComputedProperties>, GC::Ref<CascadedProperties>, RefPtr<CustomPropertyData const>);
+
+    // Records that shared was copied from origin, so that children of both can share with each other as cousins.
+    void did_share(ComputedProperties const& shared, ComputedProperties const& origin);
+
+    // Returns the style that the given one was (directly or indirectly) copied from, or the style itself if it wasn't.
+    [[nodiscard]] ComputedProperties const* origin_of(ComputedProperties const*) const;
+
+    [[nodiscard]] Statistics const& statistics() const { return m_statistics; }
+
+    void visit_edges(GC::Cell::Visitor&);
+
+private:
+    static constexpr size_t max_candidate_count = 32;
+
+    [[nodiscard]] bool can_share(SharedStyle const& candidate, DOM::Element const&, StyleScope const&) const;
+
+    bool m_active { false };
+    Vector<SharedStyle> m_candidates;
+    HashMap<GC::Ref<ComputedProperties const>, GC::Ref<ComputedProperties const>> m_origins;
+    Statistics m_statistics;
+};
+
+}
@@ -19,6 +19,7 @@ public:
     void register_name(FlyString const& name, GC::Ref<Element>);
     void unregister_name(FlyString const& name, GC::Ref<Element>);
     GC::Ptr<Element> element_by_name(FlyString const& name) const;
+    bool is_empty() const { return m_map.is_empty(); }
 
     template<typename Visitor>
     void visit_edges(Visitor& visitor) { visitor.visit(m_map); }
@@ -172,6 +172,8 @@
 #include <LibWeb/Infra/Strings.h>
 #include <LibWeb/IntersectionObserver/IntersectionObserver.h>
 #include <LibWeb/Layout/BlockFormattingContext.h>
+#include <LibWeb/Layout/FlexFormattingContext.h>
+#include <LibWeb/Layout/GridFormattingContext.h>
 #include <LibWeb/Layout/SVGFormattingContext.h>
 #include <LibWeb/Layout/SVGSVGBox.h>
 #include <LibWeb/Layout/TreeBuilder.h>
@@ -638,6 +640,7 @@ void Document::visit_edges(Cell::Visitor& visitor)
         visitor.visit(resize_observer);
 
     visitor.visit(m_svg_roots_needing_relayout);
+    visitor.visit(m_relayout_boundaries_needing_relayout);
 
     visitor.visit(m_shared_resource_requests);
 
@@ -1404,6 +1407,80 @@ static void relayout_svg_root(Layout::SVGSVGBox& svg_root)
     });
 }
 
+void Document::mark_relayout_boundary_as_needing_relayout(Layout::Box& boundary)
+{
+    m_relayout_boundaries_needing_relayout.set(boundary);
+}
+
+// Whether the boundary's subtree can still be laid out on its own, now that we're about to do so.
+static bool can_relayout_from_boundary(Layout::Box const& boundary)
+{
+    // NB: The boundary's style may have changed since its contents were marked.
+    if (!boundary.is_relayout_boundary() || !boundary.paintable_box())
+        return false;
+
+    // NB: Anchor positioning lets boxes anywhere in the document depend on the position of boxes inside the boundary.
+    if (!boundary.document().anchor_name_map().is_empty())
+        return false;
+
+    // SVG layout is in charge of anything inside of it, including the contents of <foreignObject>.
+    for (auto const* ancestor = boundary.parent(); ancestor; ancestor = ancestor->parent()) {
+        if (ancestor->is_svg_box() || ancestor->is_svg_svg_box())
+            return false;
+    }
+
+    // Everything positioned inside the boundary has to be positioned relative to something inside it as well.
+    bool is_self_contained = true;
+    boundary.for_each_in_subtree_of_type<Layout::Box>([&](auto const& box) {
+        if (!box.is_absolutely_positioned())
+            return TraversalDecision::Continue;
+        auto containing_block = box.containing_block();
+        if (!containing_block || !boundary.is_inclusive_ancestor_of(*containing_block)) {
+            is_self_contained = false;
+            return TraversalDecision::Break;
+        }
+        return TraversalDecision::Continue;
+    });
+    return is_self_contained;
+}
+
+static void relayout_from_boundary(Layout::Box& boundary)
+{
+    Layout::LayoutState layout_state(boundary);
+
+    // NB: Nothing inside the boundary can affect its size or position, so we keep the ones it got from its parent's
+    //     formatting context last time around.
+    auto const& boundary_state = layout_state.populate_from_paintable(boundary, *boundary.paintable_box());
+    auto available_space = Layout::AvailableSpace(
+        Layout::AvailableSize::make_definite(boundary_state.content_width()),
+        Layout::AvailableSize::make_definite(boundary_state.content_height()));
+
+    OwnPtr<Layout::FormattingContext> formatting_context;
+    switch (*Layout::FormattingContext::formatting_context_type_created_by_box(boundary)) {
+    case Layout::FormattingContext::Type::Block:
+        formatting_context = make<Layout::BlockFormattingContext>(layout_state, Layout::LayoutMode::Normal, as<Layout::BlockContainer>(boundary), nullptr);
+        break;
+    case Layout::FormattingContext::Type::Flex:
+        formatting_context = make<Layout::FlexFormattingContext>(layout_state, Layout::LayoutMode::Normal, boundary, nullptr);
+        break;
+    case Layout::FormattingContext::Type::Grid:
+        formatting_context = make<Layout::GridFormattingContext>(layout_state, Layout::LayoutMode::Normal, boundary, nullptr);
+        break;
+    default:
+        VERIFY_NOT_REACHED();
+    }
+    formatting_context->run(available_space);
+    formatting_context->parent_context_did_dimension_child_root_box();
+    formatting_context = nullptr;
+
+    layout_state.commit(boundary);
+
+    boundary.for_each_in_inclusive_subtree([](auto& node) {
+        node.reset_needs_layout_update();
+        return TraversalDecision::Continue;
+    });
+}
+
 static void propagate_scrollbar_width_to_viewport(Element& root_element, Layout::Viewport& viewport)
 {
     // https://drafts.csswg.org/css-scrollbars/#scrollbar-width
@@ -1494,6 +1571,7 @@ void Document::update_layout(UpdateLayoutReason reason)
         return;
 
     auto svg_roots_to_relayout = move(m_svg_roots_needing_relayout);
+    auto relayout_boundaries_to_relayout = move(m_relayout_boundaries_needing_relayout);
 
     // NOTE: If this is a document hosting <template> contents, layout is unnecessary.
     if (m_created_for_appropriate_template_contents)
@@ -1501,14 +1579,48 @@ void Document::update_layout(UpdateLayoutReason reason)
 
     auto const needs_layout_tree_rebuild = !m_layout_root || needs_layout_tree_update() || child_needs_layout_tree_update() || needs_full_layout_tree_update();
 
-    // Partial SVG relayout
-    if (!needs_layout_tree_rebuild && !svg_roots_to_relayout.is_empty() && !m_layout_root->needs_layout_update()) {
+    // Partial relayout of SVG roots and relayout boundaries
+    auto can_do_partial_relayout = !needs_layout_tree_rebuild
+        && !m_layout_root->needs_layout_update()
+        && (!svg_roots_to_relayout.is_empty() || !relayout_boundaries_to_relayout.is_empty());
+    for (auto const& boundary : relayout_boundaries_to_relayout) {
+        if (!can_do_partial_relayout)
+            break;
+        can_do_partial_relayout = can_relayout_from_boundary(*boundary);
+    }
+    if (can_do_partial_relayout) {
         for (auto const& svg_root : svg_roots_to_relayout)
             relayout_svg_root(*svg_root);
 
+        for (auto const& boundary : relayout_boundaries_to_relayout) {
+            // NB: Boundaries nested inside another one that needs relayout are taken care of by the outer one.
+            bool is_inside_other_boundary = false;
+            for (auto* ancestor = boundary->parent(); ancestor && !is_inside_other_boundary; ancestor = ancestor->parent()) {
+                if (auto* ancestor_box = as_if<Layout::Box>(*ancestor))
+                    is_inside_other_boundary = relayout_boundaries_to_relayout.contains(*ancestor_box);
+            }
+            if (!is_inside_other_boundary)
+                relayout_from_boundary(*boundary);
+        }
+
         invalidate_stacking_context_tree();
         invalidate_display_list();
 
+        if (!relayout_boundaries_to_relayout.is_empty()) {
+            m_layout_root->invalidate_text_blocks_cache();
+
+            // NB: Unlike SVG roots, relayout boundaries can contain scroll containers, sticky boxes and selected text.
+            // NB: Called during layout update.
+            unsafe_paintable()->assign_scroll_frames();
+            if (auto range = get_selection()->range())
+                unsafe_paintable()->recompute_selection_states(*range);
+
+            // NB: The paintables inside the boundaries are new, so they need to learn about the viewport rect, and
+            //     the ones with content-visibility: auto need to replace their predecessors in the viewport's list.
+            inform_all_viewport_clients_about_the_current_viewport_rect();
+            collect_paintable_boxes_with_auto_content_visibility();
+        }
+
         set_needs_accumulated_visual_contexts_update(true);
         update_paint_and_hit_testing_properties_if_needed();
         m_document->set_needs_repaint();
@@ -1626,17 +1738,7 @@ void Document::update_layout(UpdateLayoutReason reason)
         unsafe_paintable()->recompute_selection_states(*range);
     }
 
-    // Collect elements with content-visibility: auto. This is used in the HTML event loop to avoid traversing the whole tree every time.
-    Vector<GC::Ref<Painting::PaintableBox>> paintable_boxes_with_auto_content_visibility;
-    unsafe_paintable()->for_each_in_subtree_of_type<Painting::PaintableBox>([&](auto& paintable_box) {
-        if (paintable_box.dom_node()
-            && paintable_box.dom_node()->is_element()
-            && paintable_box.computed_values().content_visibility() == CSS::ContentVisibility::Auto) {
-            paintable_boxes_with_auto_content_visibility.append(paintable_box);
-        }
-        return TraversalDecision::Continue;
-    });
-    unsafe_paintable()->set_paintable_boxes_with_auto_content_visibility(move(paintable_boxes_with_auto_content_visibility));
+    collect_paintable_boxes_with_auto_content_visibility();
 
     m_layout_root->for_each_in_inclusive_subtree([](auto& node) {
         node.reset_needs_layout_update();
@@ -1650,6 +1752,22 @@ void Document::update_layout(UpdateLayoutReason reason)
     VERIFY(layout_is_up_to_date());
 }
 
+void Document::collect_paintable_boxes_with_auto_content_visibility()
+{
+    // Collect elements with content-visibility: auto. This is used in the HTML event loop to avoid traversing the whole tree every time.
+    Vector<GC::Ref<Painting::PaintableBox>> paintable_boxes_with_auto_content_visibility;
+    // NB: Called during layout update.
+    unsafe_paintable()->for_each_in_subtree_of_type<Painting::PaintableBox>([&](auto& paintable_box) {
+        if (paintable_box.dom_node()
+            && paintable_box.dom_node()->is_element()
+            && paintable_box.computed_values().content_visibility() == CSS::ContentVisibility::Auto) {
+            paintable_boxes_with_auto_content_visibility.append(paintable_box);
+        }
+        return TraversalDecision::Continue;
+    });
+    unsafe_paintable()->set_paintable_boxes_with_auto_content_visibility(move(paintable_boxes_with_auto_content_visibility));
+}
+
 bool Document::layout_is_up_to_date() const
 {
     if (!navigable() || navigable()->active_document() != this)
@@ -1660,7 +1778,8 @@ bool Document::layout_is_up_to_date() const
         && !needs_layout_tree_update()
         && !child_needs_layout_tree_update()
         && !needs_full_layout_tree_update()
-        && m_svg_roots_needing_relayout.is_empty();
+        && m_svg_roots_needing_relayout.is_empty()
+        && m_relayout_boundaries_needing_relayout.is_empty();
 }
 
 [[nodiscard]] static CSS::RequiredInvalidationAfterStyleChange update_style_recursively(Node& node, CSS::StyleComputer& style_computer, bool needs_inherited_style_update, bool recompute_elements_depending_on_custom_properties, bool parent_display_changed)
@@ -1801,7 +1920,9 @@ void Document::update_style()
 
     build_registered_properties_cache();
 
+    style_computer().begin_style_update();
     auto invalidation = update_style_recursively(*this, style_computer(), false, false, false);
+    style_computer().end_style_update();
     if (!invalidation.is_none())
         invalidate_display_list();
 
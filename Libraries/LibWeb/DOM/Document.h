@@ -644,6 +644,7 @@ public:
     void set_needs_full_layout_tree_update(bool b) { m_needs_full_layout_tree_update = b; }
 
     void mark_svg_root_as_needing_relayout(Layout::SVGSVGBox&);
+    void mark_relayout_boundary_as_needing_relayout(Layout::Box&);
 
     void set_needs_to_refresh_scroll_state(bool b);
 
@@ -818,6 +819,7 @@ public:
 
     // https://drafts.csswg.org/css-anchor-position-1/#determining
     AnchorNameMap& anchor_name_map() { return m_anchor_name_map; }
+    AnchorNameMap const& anchor_name_map() const { return m_anchor_name_map; }
     GC::Ptr<Element> element_by_anchor_name(FlyString const& name, Node const& querying_node) const;
 
     void add_form_associated_element_with_form_attribute(HTML::FormAssociatedElement&);
@@ -1082,6 +1084,7 @@ private:
     void invalidate_style_of_elements_affected_by_has();
 
     void tear_down_layout_tree();
+    void collect_paintable_boxes_with_auto_content_visibility();
 
     void update_active_element();
 
@@ -1263,6 +1266,7 @@ private:
     bool m_is_running_update_layout { false };
 
     HashTable<GC::Ref<Layout::SVGSVGBox>> m_svg_roots_needing_relayout;
+    HashTable<GC::Ref<Layout::Box>> m_relayout_boundaries_needing_relayout;
 
     bool m_needs_animated_style_update { false };
 
@@ -347,6 +347,7 @@ class LengthPercentage;
 class LengthPercentageOrAuto;
 class LengthStyleValue;
 class LinearGradientStyleValue;
+class MatchedPropertiesCache;
 class MediaFeatureValue;
 class MediaList;
 class MediaQuery;
@@ -388,6 +389,7 @@ class StyleComputer;
 class StylePropertyMap;
 class StylePropertyMapReadOnly;
 class StyleScope;
+class StyleSharingCache;
 class StyleSheet;
 class StyleSheetList;
 class StyleValue;
@@ -479,6 +481,7 @@ struct CSSStyleSheetInit;
 struct FunctionParameterInternal;
 struct GridRepeatParams;
 struct LogicalAliasMappingContext;
+struct MatchingRule;
 struct RandomCachingKey;
 struct RequiredInvalidationAfterStyleChange;
 struct StyleSheetIdentifier;
@@ -34,6 +34,8 @@ namespace Web::HTML {
 
 GC_DEFINE_ALLOCATOR(EventLoop);
 
+static constexpr AK::Duration lazy_sweep_time_budget_per_idle_period = AK::Duration::from_milliseconds(5);
+
 EventLoop::EventLoop(Type type)
     : m_type(type)
 {
@@ -186,6 +188,18 @@ void EventLoop::process()
         for (auto& win : same_loop_windows()) {
             win->start_an_idle_period();
         }
+
+        // NOTE: Spend some of the idle period sweeping heap blocks left over from the last garbage collection,
+        //       so that allocations don't have to do it later. Keep going on the next turn if there's more.
+        if (heap().has_blocks_needing_sweep()) {
+            auto time_until_deadline = compute_deadline() - HighResolutionTime::unsafe_shared_current_time();
+            if (time_until_deadline > 0) {
+                auto time_budget = min(AK::Duration::from_microseconds(static_cast<i64>(time_until_deadline * 1000)), lazy_sweep_time_budget_per_idle_period);
+                heap().sweep_lazily(time_budget);
+            }
+            if (heap().has_blocks_needing_sweep())
+                schedule();
+        }
     }
 
     // If there are eligible tasks in the queue, schedule a new round of processing. :^)
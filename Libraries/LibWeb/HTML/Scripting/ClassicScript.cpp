@@ -72,7 +72,7 @@ GC::Ref<ClassicScript> ClassicScript::create(ByteString filename, StringView sou
     return script;
 }
 
-GC::Ref<ClassicScript> ClassicScript::create_from_pre_parsed(ByteString filename, NonnullRefPtr<JS::SourceCode const> source_code, EnvironmentSettingsObject& settings, URL::URL base_url, JS::FFI::ParsedProgram* parsed, MutedErrors muted_errors)
+GC::Ref<ClassicScript> ClassicScript::create_from_pre_parsed(ByteString filename, NonnullRefPtr<JS::SourceCode const> source_code, EnvironmentSettingsObject& settings, URL::URL base_url, JS::FFI::ParsedProgram* parsed, size_t source_line_number, MutedErrors muted_errors)
 {
     auto& realm = settings.realm();
     auto& vm = realm.vm();
@@ -87,7 +87,7 @@ GC::Ref<ClassicScript> ClassicScript::create_from_pre_parsed(ByteString filename
     script->set_error_to_rethrow(JS::js_null());
 
     auto parse_timer = Core::ElapsedTimer::start_new();
-    auto result = JS::Script::create_from_parsed(parsed, move(source_code), realm, script);
+    auto result = JS::Script::create_from_parsed(parsed, move(source_code), realm, source_line_number, script);
     dbgln_if(HTML_SCRIPT_DEBUG, "ClassicScript: Compiled pre-parsed {} in {}ms", script->filename(), parse_timer.elapsed_milliseconds());
 
     if (result.is_error()) {
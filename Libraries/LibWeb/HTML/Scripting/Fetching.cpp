@@ -10,6 +10,7 @@
 #include <LibCore/EventLoop.h>
 #include <LibGC/Function.h>
 #include <LibGC/Root.h>
+#include <LibJS/CompiledProgramCache.h>
 #include <LibJS/Runtime/ModuleRequest.h>
 #include <LibJS/RustIntegration.h>
 #include <LibJS/SourceCode.h>
@@ -50,6 +51,16 @@ namespace Web::HTML {
 //     captures) rather than destroying them on the worker thread.
 static void parse_off_thread(NonnullRefPtr<JS::SourceCode const> source_code, JS::RustIntegration::ProgramType type, size_t line_number_offset, Function<void(JS::FFI::ParsedProgram*, NonnullRefPtr<JS::SourceCode const>)> on_parsed)
 {
+    // If we've recently compiled this exact program, there's nothing worth parsing on another thread.
+    // The compile step will pick up the cached result (or parse synchronously if it was evicted in the meantime).
+    if (Bindings::main_thread_vm().compiled_program_cache().contains(*source_code, type, line_number_offset)) {
+        Core::deferred_invoke([on_parsed = move(on_parsed), source_code = move(source_code)]() mutable {
+            on_parsed(nullptr, move(source_code));
+            perform_a_microtask_checkpoint();
+        });
+        return;
+    }
+
     // Extract the raw data the parser needs while still on the main thread.
     auto const* utf16_data = source_code->utf16_data();
     auto length = source_code->length_in_code_units();
@@ -442,7 +453,7 @@ void fetch_classic_script(GC::Ref<HTMLScriptElement> element, URL::URL const& ur
                 [response_url = move(response_url), response_url_string = move(response_url_string),
                     muted_errors, on_complete_root = move(on_complete_root),
                     settings_root = move(settings_root)](auto* parsed, auto source_code) mutable {
-                    auto script = ClassicScript::create_from_pre_parsed(move(response_url_string), move(source_code), *settings_root, move(response_url), parsed, muted_errors);
+                    auto script = ClassicScript::create_from_pre_parsed(move(response_url_string), move(source_code), *settings_root, move(response_url), parsed, 1, muted_errors);
                     on_complete_root->function()(script);
                 });
         } else {
@@ -88,4 +88,78 @@ Optional<CSSPixelFraction> Box::preferred_aspect_ratio() const
     return fraction;
 }
 
+bool Box::is_relayout_boundary() const
+{
+    if (is_anonymous() || !dom_node() || is_viewport() || is_svg_box() || is_svg_svg_box())
+        return false;
+
+    // NB: Table-internal boxes are sized and positioned by the table formatting context of their table, based on the
+    //     contents of every other cell in the same row and column.
+    if (display().is_internal_table() || display().is_table_caption())
+        return false;
+
+    // NB: We lay the box out by running its own formatting context, so it has to have one we can run on its own.
+    //     Flex and grid containers would qualify, but their baseline always comes from their items (see below).
+    if (FormattingContext::formatting_context_type_created_by_box(*this) != FormattingContext::Type::Block)
+        return false;
+
+    // NB: Relative and sticky offsets are applied on top of the offset we'd be reusing.
+    auto const& computed_values = this->computed_values();
+    if (computed_values.position() == CSS::Positioning::Relative || computed_values.position() == CSS::Positioning::Sticky)
+        return false;
+
+    // NB: Our parent may take its baseline from ours (see FormattingContext::box_baseline()), and it isn't laid out
+    //     again along with us. So our baseline must not depend on our contents, and our scrollable overflow must not
+    //     reach our ancestors either. We also have to be the containing block of everything positioned inside of us,
+    //     which is checked when we're about to be laid out.
+    // https://drafts.csswg.org/css2/#propdef-vertical-align
+    // The baseline of an 'inline-block' is the baseline of its last line box in the normal flow, unless it has either
+    // no in-flow line boxes or if its 'overflow' property has a computed value other than 'visible' [...]
+    // https://drafts.csswg.org/css-align-3/#baseline-export
+    // Flex and grid containers take their baseline from their items, whether or not they clip their overflow.
+    if (computed_values.overflow_x() == CSS::Overflow::Visible || computed_values.overflow_y() == CSS::Overflow::Visible)
+        return false;
+
+    if (auto const* parent = this->parent(); parent && (parent->display().is_flex_inside() || parent->display().is_grid_inside())) {
+        // https://drafts.csswg.org/css-align-3/#baseline-align-self
+        // Baseline-aligned items are positioned relative to each other's baselines, which depend on their contents.
+        auto align_self = computed_values.align_self();
+        if (align_self == CSS::AlignSelf::Baseline
+            || (align_self == CSS::AlignSelf::Auto && parent->computed_values().align_items() == CSS::AlignItems::Baseline))
+            return false;
+
+        // https://drafts.csswg.org/css-flexbox-1/#flex-basis-property
+        // A content-based flex basis makes our main size depend on our contents, no matter what our width says.
+        if (parent->display().is_flex_inside()) {
+            auto const& flex_basis = computed_values.flex_basis();
+            if (flex_basis.has<CSS::FlexBasisContent>())
+                return false;
+            auto const& flex_basis_size = flex_basis.get<CSS::Size>();
+            if (flex_basis_size.is_min_content() || flex_basis_size.is_max_content() || flex_basis_size.is_fit_content())
+                return false;
+        }
+    }
+
+    // https://drafts.csswg.org/css-contain-2/#containment-size
+    // The intrinsic sizes of the size containment box are determined as if the element had no content [...]
+    if (has_size_containment())
+        return true;
+
+    // Otherwise, our size must be fixed in both axes.
+    if (!computed_values.width().is_length() || !computed_values.height().is_length())
+        return false;
+    if (!(computed_values.min_width().is_auto() || computed_values.min_width().is_length())
+        || !(computed_values.min_height().is_auto() || computed_values.min_height().is_length())
+        || !(computed_values.max_width().is_none() || computed_values.max_width().is_length())
+        || !(computed_values.max_height().is_none() || computed_values.max_height().is_length()))
+        return false;
+
+    // https://drafts.csswg.org/css-flexbox-1/#min-size-auto
+    // The automatic minimum size of flex and grid items is content-based, unless they're scroll containers.
+    if (auto const* parent = this->parent(); parent && (parent->display().is_flex_inside() || parent->display().is_grid_inside()) && !is_scroll_container())
+        return false;
+
+    return true;
+}
+
 }
@@ -51,6 +51,10 @@ public:
 
     virtual ~Box() override;
 
+    // Whether nothing inside this box can affect its size or position, or the layout of anything outside of it.
+    // When only the contents of such a box change, it can be laid out on its own.
+    bool is_relayout_boundary() const;
+
     virtual void did_set_content_size() { }
 
     virtual GC::Ptr<Painting::Paintable> create_paintable() const override;
@@ -373,12 +373,12 @@ void LayoutState::resolve_relative_positions()
     });
 }
 
-static void build_paint_tree(Node& node, Painting::Paintable* parent_paintable = nullptr)
+static void build_paint_tree(Node& node, Painting::Paintable* parent_paintable = nullptr, Painting::Paintable* next_sibling_paintable = nullptr)
 {
     for (auto& paintable : node.paintables()) {
         if (parent_paintable && !paintable.forms_unconnected_subtree()) {
             VERIFY(!paintable.parent());
-            parent_paintable->append_child(paintable);
+            parent_paintable->insert_before(paintable, next_sibling_paintable);
         }
         paintable.set_dom_node(node.dom_node());
         if (node.dom_node())
@@ -392,9 +392,12 @@ static void build_paint_tree(Node& node, Painting::Paintable* parent_paintable =
 void LayoutState::commit(Box& root)
 {
     Painting::Paintable* parent_paintable = nullptr;
+    Painting::Paintable* next_sibling_paintable = nullptr;
     if (!root.is_viewport()) {
         if (auto* existing = as_if<Painting::PaintableBox>(root.first_paintable())) {
             parent_paintable = existing->parent();
+            // NB: Paint order follows tree order, so the new paintable has to go back where the old one was.
+            next_sibling_paintable = existing->next_sibling();
             if (parent_paintable)
                 parent_paintable->remove_child(*existing);
         }
@@ -582,7 +585,7 @@ void LayoutState::commit(Box& root)
     for (auto* text_node : text_nodes)
         text_node->add_paintable(text_node->create_paintable());
 
-    build_paint_tree(root, parent_paintable);
+    build_paint_tree(root, parent_paintable, next_sibling_paintable);
 
     resolve_relative_positions();
 
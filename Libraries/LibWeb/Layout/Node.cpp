@@ -1497,6 +1497,12 @@ void Node::set_needs_layout_update(DOM::SetNeedsLayoutReason reason)
     for (auto* ancestor = parent(); ancestor; ancestor = ancestor->parent()) {
         if (ancestor->m_needs_layout_update)
             break;
+        // NB: Relayout boundaries are not marked themselves, so that a change to their own style still dirties their
+        //     ancestors (and turns this into a full layout) even after some of their contents have changed.
+        if (auto* box = as_if<Box>(*ancestor); box && box->is_relayout_boundary()) {
+            document().mark_relayout_boundary_as_needing_relayout(*box);
+            break;
+        }
         ancestor->m_needs_layout_update = true;
         if (auto* svg_box = as_if<SVGSVGBox>(ancestor)) {
             document().mark_svg_root_as_needing_relayout(*svg_box);
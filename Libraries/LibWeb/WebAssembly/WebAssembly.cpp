@@ -9,6 +9,7 @@
 #include <AK/MemoryStream.h>
 #include <AK/ScopeGuard.h>
 #include <AK/StringBuilder.h>
+#include <LibJS/Runtime/Agent.h>
 #include <LibJS/Runtime/Array.h>
 #include <LibJS/Runtime/ArrayBuffer.h>
 #include <LibJS/Runtime/BigInt.h>
@@ -50,7 +51,10 @@ HashMap<GC::Ptr<JS::Object>, WebAssemblyCache> s_caches;
 
 WebAssemblyCache& get_cache(JS::Realm& realm)
 {
-    return s_caches.ensure(realm.global_object());
+    auto& cache = s_caches.ensure(realm.global_object());
+    // memory.atomic.wait must trap wherever Atomics.wait() would throw.
+    cache.abstract_machine().set_can_block(JS::agent_can_suspend(realm.vm()));
+    return cache;
 }
 
 }
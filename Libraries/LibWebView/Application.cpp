@@ -1097,6 +1097,9 @@ void Application::initialize_actions()
     m_debug_menu->add_separator();
 
     m_debug_menu->add_action(Action::create("Collect Garbage"sv, ActionID::CollectGarbage, debug_request("collect-garbage"sv)));
+
+    m_profile_javascript_action = Action::create_checkable("Profile JavaScript"sv, ActionID::ProfileJavaScript, check(m_profile_javascript_action, "js-profiler"sv));
+    m_debug_menu->add_action(*m_profile_javascript_action);
     m_debug_menu->add_separator();
 
     auto spoof_user_agent_menu = Menu::create_group("Spoof User Agent"sv);
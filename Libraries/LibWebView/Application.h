@@ -311,6 +311,7 @@ private:
 
     RefPtr<Menu> m_debug_menu;
     RefPtr<Action> m_show_line_box_borders_action;
+    RefPtr<Action> m_profile_javascript_action;
     RefPtr<Action> m_enable_scripting_action;
     RefPtr<Action> m_enable_content_filtering_action;
     RefPtr<Action> m_block_pop_ups_action;
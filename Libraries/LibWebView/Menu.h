@@ -97,6 +97,7 @@ enum class ActionID {
     DumpGCGraph,
     ShowLineBoxBorders,
     CollectGarbage,
+    ProfileJavaScript,
     SpoofUserAgent,
     NavigatorCompatibilityMode,
     EnableScripting,
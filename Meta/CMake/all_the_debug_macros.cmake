@@ -66,6 +66,7 @@ set(TIME_ZONE_DEBUG ON)
 set(TLS_DEBUG ON)
 set(TOKENIZER_TRACE_DEBUG ON)
 set(UPDATE_LAYOUT_DEBUG ON)
+set(UPDATE_STYLE_DEBUG ON)
 set(URL_PARSER_DEBUG ON)
 set(URL_PATTERN_DEBUG ON)
 set(UTF8_DEBUG ON)
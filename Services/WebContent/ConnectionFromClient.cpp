@@ -10,8 +10,11 @@
  */
 
 #include <AK/JsonObject.h>
+#include <AK/LexicalPath.h>
 #include <AK/QuickSort.h>
 #include <LibCore/EventLoop.h>
+#include <LibCore/File.h>
+#include <LibCore/StandardPaths.h>
 #include <LibCore/System.h>
 #include <LibGC/Heap.h>
 #include <LibGfx/Bitmap.h>
@@ -19,6 +22,7 @@
 #include <LibGfx/SystemTheme.h>
 #include <LibJS/Runtime/ConsoleObject.h>
 #include <LibJS/Runtime/Date.h>
+#include <LibJS/Runtime/SamplingProfiler.h>
 #include <LibUnicode/TimeZone.h>
 #include <LibWeb/ARIA/RoleType.h>
 #include <LibWeb/Bindings/MainThreadVM.h>
@@ -263,6 +267,23 @@ void ConnectionFromClient::enqueue_input_event(Web::QueuedInputEvent event)
     m_input_event_queue.enqueue(move(event));
 }
 
+static ErrorOr<void> write_javascript_profile(JS::SamplingProfiler const& profiler)
+{
+    LexicalPath path { Core::StandardPaths::tempfile_directory() };
+    path = path.append(TRY(AK::UnixDateTime::now().to_string("js-profile-%Y-%m-%d-%H-%M-%S"sv)));
+
+    auto collapsed_stacks_path = ByteString::formatted("{}.folded", path.string());
+    auto collapsed_stacks_file = TRY(Core::File::open(collapsed_stacks_path, Core::File::OpenMode::Write));
+    TRY(collapsed_stacks_file->write_until_depleted(profiler.to_collapsed_stacks().bytes()));
+
+    auto chrome_trace_path = ByteString::formatted("{}.json", path.string());
+    auto chrome_trace_file = TRY(Core::File::open(chrome_trace_path, Core::File::OpenMode::Write));
+    TRY(chrome_trace_file->write_until_depleted(profiler.to_chrome_trace().bytes()));
+
+    dbgln("Wrote {} JavaScript profiler samples to {} and {}", profiler.sample_count(), collapsed_stacks_path, chrome_trace_path);
+    return {};
+}
+
 void ConnectionFromClient::debug_request(u64 page_id, ByteString request, ByteString argument)
 {
     auto page = this->page(page_id);
@@ -447,6 +468,21 @@ void ConnectionFromClient::debug_request(u64 page_id, ByteString request, ByteSt
         Web::ContentFilter::the().set_filtering_enabled(argument == "on");
         return;
     }
+
+    if (request == "js-profiler") {
+        auto& profiler = Web::Bindings::main_thread_vm().ensure_sampling_profiler();
+        if (argument == "on") {
+            profiler.start();
+            return;
+        }
+        if (!profiler.is_running())
+            return;
+        profiler.stop();
+        if (auto result = write_javascript_profile(profiler); result.is_error())
+            dbgln("Failed to write JavaScript profile: {}", result.error());
+        profiler.clear();
+        return;
+    }
 }
 
 void ConnectionFromClient::get_source(u64 page_id)
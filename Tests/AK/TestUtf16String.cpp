@@ -992,6 +992,52 @@ TEST_CASE(trim)
     }
 }
 
+TEST_CASE(substring_with_shared_superstring)
+{
+    auto shares_storage = [](Utf16String const& superstring, Utf16String const& substring, size_t offset) {
+        if (superstring.has_ascii_storage())
+            return substring.utf16_view().ascii_span().data() == superstring.utf16_view().ascii_span().data() + offset;
+        return substring.utf16_view().utf16_span().data() == superstring.utf16_view().utf16_span().data() + offset;
+    };
+
+    {
+        auto superstring = Utf16String::repeated('a', 200);
+        auto substring = superstring.substring_with_shared_superstring(10, 100);
+        EXPECT_EQ(substring, superstring.substring_view(10, 100));
+        EXPECT_EQ(substring.has_ascii_storage(), superstring.has_ascii_storage());
+        EXPECT(shares_storage(superstring, substring, 10));
+
+        auto nested_substring = substring.substring_with_shared_superstring(20, 70);
+        EXPECT_EQ(nested_substring, superstring.substring_view(30, 70));
+        EXPECT(shares_storage(superstring, nested_substring, 30));
+
+        auto short_substring = superstring.substring_with_shared_superstring(10, 20);
+        EXPECT_EQ(short_substring, superstring.substring_view(10, 20));
+        EXPECT(!shares_storage(superstring, short_substring, 10));
+
+        auto tail = superstring.substring_with_shared_superstring(100);
+        EXPECT_EQ(tail, superstring.substring_view(100));
+        EXPECT(shares_storage(superstring, tail, 100));
+    }
+    {
+        auto superstring = Utf16String::repeated(0x1f600, 100);
+        auto substring = superstring.substring_with_shared_superstring(2, 100);
+        EXPECT_EQ(substring, superstring.substring_view(2, 100));
+        EXPECT_EQ(substring.length_in_code_points(), 50uz);
+        EXPECT(shares_storage(superstring, substring, 2));
+    }
+    {
+        // Small parts of large strings are copied, so they don't keep the whole string alive.
+        auto superstring = Utf16String::repeated('a', 64 * KiB);
+        auto substring = superstring.substring_with_shared_superstring(10, 100);
+        EXPECT_EQ(substring, superstring.substring_view(10, 100));
+        EXPECT(!shares_storage(superstring, substring, 10));
+
+        auto large_substring = superstring.substring_with_shared_superstring(10, 32 * KiB);
+        EXPECT(shares_storage(superstring, large_substring, 10));
+    }
+}
+
 TEST_CASE(copy_operations)
 {
     auto test = [](Utf16String const& string1) {
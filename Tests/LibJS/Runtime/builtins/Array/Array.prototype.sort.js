@@ -173,3 +173,85 @@ describe("Array.prototype.sort", () => {
         Array.prototype.sort.call(obj);
     });
 });
+
+describe("large arrays", () => {
+    function pseudoRandomIntegers(count, seed) {
+        const result = [];
+        for (let i = 0; i < count; ++i) {
+            seed = (seed * 1103515245 + 12345) % 2147483648;
+            result.push(seed % 1000);
+        }
+        return result;
+    }
+
+    function expectSortedBy(array, compare) {
+        for (let i = 1; i < array.length; ++i) expect(compare(array[i - 1], array[i]) <= 0).toBeTrue();
+    }
+
+    test("sort is stable", () => {
+        const keys = pseudoRandomIntegers(2000, 42);
+        const items = keys.map((key, index) => ({ key, index }));
+        items.sort((a, b) => a.key - b.key);
+        expectSortedBy(items, (a, b) => a.key - b.key || a.index - b.index);
+    });
+
+    test("partially sorted input", () => {
+        const ascending = Array.from({ length: 1000 }, (_, i) => i);
+        const descending = Array.from({ length: 1000 }, (_, i) => 1000 - i);
+        const sawtooth = Array.from({ length: 1000 }, (_, i) => i % 100);
+        const array = [...ascending, ...descending, ...sawtooth, ...pseudoRandomIntegers(500, 7)];
+        const expected = [...array];
+        const byNumber = (a, b) => a - b;
+        array.sort(byNumber);
+        expectSortedBy(array, byNumber);
+        expect(array.length).toBe(expected.length);
+        expect(array.reduce((a, b) => a + b)).toBe(expected.reduce((a, b) => a + b));
+    });
+
+    test("default comparator on strings and numbers", () => {
+        const numbers = pseudoRandomIntegers(500, 3).map(n => n / 8 - 20);
+        const sortedNumbers = [...numbers].sort();
+        expectSortedBy(sortedNumbers, (a, b) => (String(a) < String(b) ? -1 : String(a) > String(b) ? 1 : 0));
+
+        const strings = numbers.map(n => "item " + n);
+        const sortedStrings = [...strings].sort();
+        expectSortedBy(sortedStrings, (a, b) => (a < b ? -1 : a > b ? 1 : 0));
+
+        expect([3, "20", undefined, 1, null, true, 10n, -0, 0].sort()).toEqual([-0, 0, 1, 10n, "20", 3, null, true, undefined]);
+    });
+
+    test("comparator that throws midway through a merge", () => {
+        const array = pseudoRandomIntegers(1000, 5);
+        const copy = [...array];
+        let calls = 0;
+        expect(() => {
+            array.sort((a, b) => {
+                if (++calls === 5000) throw new Error("stop");
+                return a - b;
+            });
+        }).toThrowWithMessage(Error, "stop");
+        expect(array).toEqual(copy);
+    });
+
+    test("comparator that mutates the array", () => {
+        const array = pseudoRandomIntegers(500, 9);
+        const expected = [...array].sort((a, b) => a - b);
+        array.sort((a, b) => {
+            array.length = 0;
+            array.push(-1);
+            return a - b;
+        });
+        expect(array).toEqual(expected);
+    });
+
+    test("inconsistent comparator still yields a permutation", () => {
+        const array = pseudoRandomIntegers(1000, 11);
+        const expected = [...array].sort((a, b) => a - b);
+        let seed = 1;
+        array.sort(() => {
+            seed = (seed * 1103515245 + 12345) % 2147483648;
+            return (seed % 3) - 1;
+        });
+        expect(array.sort((a, b) => a - b)).toEqual(expected);
+    });
+});
@@ -0,0 +1,52 @@
+describe("Int32 and Double element kinds", () => {
+    test("writing a non-number widens the array", () => {
+        const a = [1, 2, 3];
+        a[1] = 2.5;
+        expect(a.indexOf(2.5)).toBe(1);
+        a[2] = "3";
+        expect(a.indexOf(3)).toBe(-1);
+        expect(a.indexOf("3")).toBe(2);
+        expect(a.includes(1)).toBeTrue();
+    });
+
+    test("indexOf on Int32 arrays", () => {
+        const a = [5, 0, 7, 5];
+        expect(a.indexOf(5)).toBe(0);
+        expect(a.indexOf(5, 1)).toBe(3);
+        expect(a.indexOf(-0)).toBe(1);
+        expect(a.indexOf(7.5)).toBe(-1);
+        expect(a.indexOf(NaN)).toBe(-1);
+        expect(a.indexOf("5")).toBe(-1);
+        expect(a.indexOf(5, -1)).toBe(3);
+    });
+
+    test("includes on Double arrays", () => {
+        const a = [1.5, NaN, -0];
+        expect(a.includes(NaN)).toBeTrue();
+        expect(a.indexOf(NaN)).toBe(-1);
+        expect(a.includes(0)).toBeTrue();
+        expect(a.includes(1.5, 1)).toBeFalse();
+        expect(a.includes(undefined)).toBeFalse();
+    });
+
+    test("default sort of Int32 arrays compares string representations", () => {
+        expect([10, 9, 1, -1, -10, 100, 0, 2147483647, -2147483648].sort()).toEqual([
+            -1, -10, -2147483648, 0, 1, 10, 100, 2147483647, 9,
+        ]);
+    });
+
+    test("reduce observes mutations made by the callback", () => {
+        const a = [1, 2, 3, 4];
+        const seen = [];
+        const sum = a.reduce((accumulator, value, index, array) => {
+            seen.push(value);
+            if (index === 1) {
+                array[2] = 30;
+                array.length = 3;
+            }
+            return accumulator + value;
+        }, 0);
+        expect(seen).toEqual([1, 2, 30]);
+        expect(sum).toBe(33);
+    });
+});
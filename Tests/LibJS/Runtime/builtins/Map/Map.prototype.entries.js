@@ -17,3 +17,33 @@ test("basic functionality", () => {
     expect(it.next()).toEqual({ value: undefined, done: true });
     expect(it.next()).toEqual({ value: undefined, done: true });
 });
+
+test("iteration continues across deletions and table compaction", () => {
+    const map = new Map();
+    for (let i = 0; i < 100; ++i) map.set(i, i * 2);
+    const it = map.entries();
+    expect(it.next()).toEqual({ value: [0, 0], done: false });
+    expect(it.next()).toEqual({ value: [1, 2], done: false });
+
+    // Remove most entries, including the one the iterator would visit next.
+    for (let i = 2; i < 95; ++i) map.delete(i);
+    map.set("x", "y");
+
+    expect(it.next()).toEqual({ value: [95, 190], done: false });
+    for (let i = 96; i < 100; ++i) expect(it.next()).toEqual({ value: [i, i * 2], done: false });
+    expect(it.next()).toEqual({ value: ["x", "y"], done: false });
+    expect(it.next()).toEqual({ value: undefined, done: true });
+});
+
+test("iteration visits entries added after a clear", () => {
+    const map = new Map([
+        ["a", 1],
+        ["b", 2],
+    ]);
+    const it = map.entries();
+    expect(it.next()).toEqual({ value: ["a", 1], done: false });
+    map.clear();
+    map.set("c", 3);
+    expect(it.next()).toEqual({ value: ["c", 3], done: false });
+    expect(it.next()).toEqual({ value: undefined, done: true });
+});
@@ -76,3 +76,33 @@ describe("styles", () => {
         ).toBe("\u0661\u066b\u0662\u0663 كيلومتر في الساعة");
     });
 });
+
+describe("repeated calls", () => {
+    test("same locale", () => {
+        for (let i = 0; i < 3; ++i) {
+            expect((12345.678).toLocaleString("en")).toBe("12,345.678");
+            expect((12345.678).toLocaleString("de")).toBe("12.345,678");
+            expect((12345.678).toLocaleString()).toBe("12,345.678");
+        }
+    });
+
+    test("options getters are called every time", () => {
+        let getterCalls = 0;
+        const options = {
+            get maximumFractionDigits() {
+                ++getterCalls;
+                return 1;
+            },
+        };
+        for (let i = 0; i < 3; ++i) expect((1.25).toLocaleString("en", options)).toBe("1.3");
+        expect(getterCalls).toBe(3);
+    });
+
+    test("invalid locale throws every time", () => {
+        for (let i = 0; i < 2; ++i) {
+            expect(() => {
+                (1).toLocaleString("hello!");
+            }).toThrowWithMessage(RangeError, "hello! is not a structurally valid language tag");
+        }
+    });
+});
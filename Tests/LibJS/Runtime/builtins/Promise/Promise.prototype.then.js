@@ -168,3 +168,62 @@ describe("normal behavior", () => {
         runQueuedPromiseJobs();
     });
 });
+
+describe("job ordering", () => {
+    test("handlers of settled and pending Promises run in the order they were enqueued", () => {
+        const order = [];
+        let resolvePending = null;
+        const pending = new Promise(resolve => {
+            resolvePending = resolve;
+        });
+        const fulfilled = Promise.resolve("fulfilled");
+        const rejected = Promise.reject("rejected");
+
+        pending.then(value => order.push(value));
+        fulfilled.then(
+            value => order.push(value),
+            () => expect().fail()
+        );
+        rejected.then(
+            () => expect().fail(),
+            reason => order.push(reason)
+        );
+        resolvePending("pending");
+        fulfilled.then(value => order.push(value + " again"));
+
+        runQueuedPromiseJobs();
+        expect(order).toEqual(["fulfilled", "rejected", "pending", "fulfilled again"]);
+    });
+
+    test("jobs enqueued while running jobs run in the same checkpoint", () => {
+        const order = [];
+        Promise.resolve()
+            .then(() => order.push(1))
+            .then(() => order.push(3));
+        Promise.resolve()
+            .then(() => order.push(2))
+            .then(() => order.push(4));
+        runQueuedPromiseJobs();
+        expect(order).toEqual([1, 2, 3, 4]);
+    });
+
+    test("repeated awaits in an async function interleave with other jobs", () => {
+        const order = [];
+        async function awaiter(name, values) {
+            for (const value of values) order.push(name + (await value));
+        }
+        const rejection = Promise.reject(3);
+        rejection.catch(() => {});
+        awaiter("a", [1, Promise.resolve(2)]);
+        awaiter("b", [1, 2]);
+        (async () => {
+            try {
+                await rejection;
+            } catch (error) {
+                order.push("c" + error);
+            }
+        })();
+        runQueuedPromiseJobs();
+        expect(order).toEqual(["a1", "b1", "c3", "a2", "b2"]);
+    });
+});
@@ -374,3 +374,27 @@ test("case-insensitive Unicode matching of astral characters", () => {
     expect(result).not.toBe(null);
     expect(result[0]).toBe("\u{10400}");
 });
+
+test("regexps with the same pattern share nothing observable", () => {
+    // Compiled patterns are cached by pattern and flags, so these end up using the same program.
+    let first = new RegExp("(b+)", "g");
+    let second = new RegExp("(b+)", "g");
+    let first_result = first.exec("abbcbbb");
+    let second_result = second.exec("bbbb");
+    expect(first_result[1]).toBe("bb");
+    expect(second_result[1]).toBe("bbbb");
+    expect(first.lastIndex).toBe(3);
+    expect(second.lastIndex).toBe(4);
+
+    // The same pattern with other flags must not reuse the program.
+    expect(new RegExp("B+").exec("abbc")).toBe(null);
+    expect(new RegExp("B+", "i").exec("abbc")[0]).toBe("bb");
+});
+
+test("regexps created in a loop", () => {
+    for (let i = 0; i < 1000; ++i) {
+        let re = new RegExp(`x${i % 10}y`);
+        expect(re.test(`ax${i % 10}yb`)).toBeTrue();
+        expect(re.test(`ax${(i + 1) % 10}yb`)).toBeFalse();
+    }
+});
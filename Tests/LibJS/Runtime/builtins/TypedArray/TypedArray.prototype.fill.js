@@ -76,3 +76,36 @@ test("basic functionality", () => {
         expect(typedArray[2]).toBe(0n);
     });
 });
+
+test("long arrays", () => {
+    TYPED_ARRAYS.forEach(T => {
+        const typedArray = new T(100);
+
+        expect(typedArray.fill(7, 3, 97)).toBe(typedArray);
+        typedArray.forEach((value, i) => {
+            expect(value).toBe(i >= 3 && i < 97 ? 7 : 0);
+        });
+    });
+
+    BIGINT_TYPED_ARRAYS.forEach(T => {
+        const typedArray = new T(100);
+
+        expect(typedArray.fill(7n, 3, 97)).toBe(typedArray);
+        typedArray.forEach((value, i) => {
+            expect(value).toBe(i >= 3 && i < 97 ? 7n : 0n);
+        });
+    });
+});
+
+test("value conversion", () => {
+    expect(new Uint8Array(20).fill(257)[19]).toBe(1);
+    expect(new Uint8ClampedArray(20).fill(257)[19]).toBe(255);
+    expect(new Uint8ClampedArray(20).fill(2.5)[19]).toBe(2);
+    expect(new Int8Array(20).fill(-129)[19]).toBe(127);
+    expect(new Float16Array(20).fill(1.1)[19]).toBe(1.099609375);
+    expect(new Float32Array(20).fill(0.1)[19]).toBe(Math.fround(0.1));
+    expect(new Float64Array(20).fill(NaN)[19]).toBeNaN();
+    expect(new Float64Array(20).fill(-0)[19]).toBe(-0);
+    expect(new BigInt64Array(20).fill(2n ** 63n)[19]).toBe(-(2n ** 63n));
+    expect(new BigUint64Array(20).fill(-1n)[19]).toBe(2n ** 64n - 1n);
+});
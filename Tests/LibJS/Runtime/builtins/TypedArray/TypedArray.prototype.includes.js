@@ -63,3 +63,54 @@ test("basic functionality", () => {
         expect(typedArray.includes(2n, -2)).toBe(true);
     });
 });
+
+test("long arrays", () => {
+    TYPED_ARRAYS.forEach(T => {
+        const typedArray = new T(100).map((_, i) => i);
+
+        expect(typedArray.includes(0)).toBe(true);
+        expect(typedArray.includes(63)).toBe(true);
+        expect(typedArray.includes(99)).toBe(true);
+        expect(typedArray.includes(99, 99)).toBe(true);
+        expect(typedArray.includes(63, 64)).toBe(false);
+        expect(typedArray.includes(100)).toBe(false);
+        expect(typedArray.includes(-0)).toBe(true);
+        expect(typedArray.includes(42.5)).toBe(false);
+        expect(typedArray.includes("42")).toBe(false);
+        expect(typedArray.includes(undefined)).toBe(false);
+    });
+
+    BIGINT_TYPED_ARRAYS.forEach(T => {
+        const typedArray = new T(100).map((_, i) => BigInt(i));
+
+        expect(typedArray.includes(99n)).toBe(true);
+        expect(typedArray.includes(99)).toBe(false);
+        expect(typedArray.includes(2n ** 64n + 99n)).toBe(false);
+    });
+});
+
+test("values that are not representable by the element type", () => {
+    expect(new Uint8Array([0, 255]).includes(256)).toBe(false);
+    expect(new Uint8Array([0, 255]).includes(-1)).toBe(false);
+    expect(new Int8Array([-128, 127]).includes(-128)).toBe(true);
+    expect(new Float32Array([0.1]).includes(0.1)).toBe(false);
+    expect(new Float32Array([0.5]).includes(0.5)).toBe(true);
+    expect(new BigInt64Array([-1n]).includes(2n ** 64n - 1n)).toBe(false);
+    expect(new BigUint64Array([2n ** 64n - 1n]).includes(2n ** 64n - 1n)).toBe(true);
+    expect(new BigUint64Array([2n ** 64n - 1n]).includes(-1n)).toBe(false);
+});
+
+test("NaN and zero", () => {
+    [Float16Array, Float32Array, Float64Array].forEach(T => {
+        const typedArray = new T(50);
+        expect(typedArray.includes(NaN)).toBe(false);
+
+        typedArray[40] = NaN;
+        expect(typedArray.includes(NaN)).toBe(true);
+        expect(typedArray.includes(NaN, 41)).toBe(false);
+
+        typedArray.fill(-0);
+        expect(typedArray.includes(0)).toBe(true);
+        expect(typedArray.includes(-0)).toBe(true);
+    });
+});
@@ -63,3 +63,36 @@ test("basic functionality", () => {
         expect(typedArray.indexOf(2n, -2)).toBe(1);
     });
 });
+
+test("long arrays", () => {
+    TYPED_ARRAYS.forEach(T => {
+        const typedArray = new T(100).map((_, i) => i % 50);
+
+        expect(typedArray.indexOf(0)).toBe(0);
+        expect(typedArray.indexOf(37)).toBe(37);
+        expect(typedArray.indexOf(37, 38)).toBe(87);
+        expect(typedArray.indexOf(37, -10)).toBe(-1);
+        expect(typedArray.indexOf(-0)).toBe(0);
+        expect(typedArray.indexOf(37.5)).toBe(-1);
+        expect(typedArray.indexOf("37")).toBe(-1);
+    });
+
+    BIGINT_TYPED_ARRAYS.forEach(T => {
+        const typedArray = new T(100).map((_, i) => BigInt(i % 50));
+
+        expect(typedArray.indexOf(37n)).toBe(37);
+        expect(typedArray.indexOf(37n, 38)).toBe(87);
+        expect(typedArray.indexOf(37)).toBe(-1);
+    });
+});
+
+test("NaN and zero", () => {
+    [Float16Array, Float32Array, Float64Array].forEach(T => {
+        const typedArray = new T(50).fill(NaN);
+        expect(typedArray.indexOf(NaN)).toBe(-1);
+
+        typedArray[45] = -0;
+        expect(typedArray.indexOf(0)).toBe(45);
+        expect(typedArray.indexOf(-0)).toBe(45);
+    });
+});
@@ -63,3 +63,31 @@ test("basic functionality", () => {
         expect(typedArray.lastIndexOf(2n, -2)).toBe(1);
     });
 });
+
+test("long arrays", () => {
+    TYPED_ARRAYS.forEach(T => {
+        const typedArray = new T(100).map((_, i) => i % 50);
+
+        expect(typedArray.lastIndexOf(0)).toBe(50);
+        expect(typedArray.lastIndexOf(3)).toBe(53);
+        expect(typedArray.lastIndexOf(3, 52)).toBe(3);
+        expect(typedArray.lastIndexOf(3, -48)).toBe(3);
+        expect(typedArray.lastIndexOf(3, 2)).toBe(-1);
+        expect(typedArray.lastIndexOf(-0)).toBe(50);
+        expect(typedArray.lastIndexOf(3.5)).toBe(-1);
+    });
+
+    BIGINT_TYPED_ARRAYS.forEach(T => {
+        const typedArray = new T(100).map((_, i) => BigInt(i % 50));
+
+        expect(typedArray.lastIndexOf(3n)).toBe(53);
+        expect(typedArray.lastIndexOf(3n, 52)).toBe(3);
+        expect(typedArray.lastIndexOf(3)).toBe(-1);
+    });
+});
+
+test("NaN", () => {
+    [Float16Array, Float32Array, Float64Array].forEach(T => {
+        expect(new T(50).fill(NaN).lastIndexOf(NaN)).toBe(-1);
+    });
+});
@@ -90,3 +90,29 @@ test("detached buffer", () => {
         expect(typedArray[2]).toBeUndefined();
     });
 });
+
+test("default comparator orders NaN last and -0 before +0", () => {
+    [Float16Array, Float32Array, Float64Array].forEach(T => {
+        const typedArray = new T([NaN, 1, -0, 0, -Infinity, NaN, -0, Infinity, -1]);
+        typedArray.sort();
+        expect(Array.from(typedArray)).toEqual([-Infinity, -1, -0, -0, 0, 1, Infinity, NaN, NaN]);
+        expect(Object.is(typedArray[2], -0)).toBeTrue();
+        expect(Object.is(typedArray[4], 0)).toBeTrue();
+    });
+});
+
+test("default comparator on large arrays", () => {
+    TYPED_ARRAYS.forEach(T => {
+        const typedArray = new T(1000);
+        for (let i = 0; i < typedArray.length; ++i) typedArray[i] = (i * 37) % 101;
+        typedArray.sort();
+        for (let i = 1; i < typedArray.length; ++i) expect(typedArray[i - 1] <= typedArray[i]).toBeTrue();
+    });
+
+    BIGINT_TYPED_ARRAYS.forEach(T => {
+        const typedArray = new T(1000);
+        for (let i = 0; i < typedArray.length; ++i) typedArray[i] = BigInt((i * 37) % 101);
+        typedArray.sort();
+        for (let i = 1; i < typedArray.length; ++i) expect(typedArray[i - 1] <= typedArray[i]).toBeTrue();
+    });
+});
@@ -86,4 +86,24 @@ describe("basic functionality", () => {
             expect(array).toEqual(new T([]));
         });
     });
+
+    test("Long arrays", () => {
+        TYPED_ARRAYS.forEach(T => {
+            for (const length of [31, 32, 33, 100]) {
+                const array = new T(length).map((_, i) => i);
+                const expected = new T(length).map((_, i) => length - i - 1);
+                expect(array.toReversed()).toEqual(expected);
+                expect(array).toEqual(new T(length).map((_, i) => i));
+            }
+        });
+
+        BIGINT_TYPED_ARRAYS.forEach(T => {
+            for (const length of [31, 32, 33, 100]) {
+                const array = new T(length).map((_, i) => BigInt(i));
+                const expected = new T(length).map((_, i) => BigInt(length - i - 1));
+                expect(array.toReversed()).toEqual(expected);
+                expect(array).toEqual(new T(length).map((_, i) => BigInt(i)));
+            }
+        });
+    });
 });
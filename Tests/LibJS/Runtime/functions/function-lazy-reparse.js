@@ -0,0 +1,257 @@
+// Function declarations and expressions don't keep their AST until they are first called. They are parsed
+// again from their source text at that point, which must produce the same function as the first parse.
+
+describe("eval", () => {
+    test("direct eval sees the function's own bindings", () => {
+        function outer() {
+            let local = 1;
+            function inner() {
+                return eval("local + 1");
+            }
+            return inner();
+        }
+        expect(outer()).toBe(2);
+    });
+
+    test("direct eval can declare variables that shadow outer bindings", () => {
+        var shadowed = "outer";
+        function declares() {
+            eval("var shadowed = 'inner'");
+            return shadowed;
+        }
+        expect(declares()).toBe("inner");
+        expect(shadowed).toBe("outer");
+    });
+
+    test("eval in an enclosing function poisons the lookup of free names", () => {
+        function outer() {
+            eval("var injected = 42");
+            return function () {
+                return injected;
+            };
+        }
+        expect(outer()()).toBe(42);
+    });
+
+    test("indirect eval does not see the function's bindings", () => {
+        globalThis.lazyReparseIndirect = "global";
+        function indirect() {
+            let lazyReparseIndirect = "local";
+            return (0, eval)("lazyReparseIndirect");
+        }
+        expect(indirect()).toBe("global");
+        delete globalThis.lazyReparseIndirect;
+    });
+});
+
+describe("with", () => {
+    test("free names inside a with statement resolve through the object", () => {
+        function lookup(object) {
+            with (object) {
+                return value;
+            }
+        }
+        expect(lookup({ value: "from object" })).toBe("from object");
+    });
+
+    test("functions nested in a with statement see the object", () => {
+        function outer(object) {
+            with (object) {
+                return function () {
+                    return value;
+                };
+            }
+        }
+        expect(outer({ value: 13 })()).toBe(13);
+    });
+
+    test("with falls back to the enclosing scope", () => {
+        function outer() {
+            let value = "enclosing";
+            function inner() {
+                with ({}) {
+                    return value;
+                }
+            }
+            return inner();
+        }
+        expect(outer()).toBe("enclosing");
+    });
+});
+
+describe("class private names", () => {
+    test("function expressions in methods can access private fields", () => {
+        class A {
+            #secret = 5;
+            reader() {
+                return function (object) {
+                    return object.#secret;
+                };
+            }
+        }
+        const a = new A();
+        expect(a.reader()(a)).toBe(5);
+        expect(() => a.reader()({})).toThrow(TypeError);
+    });
+
+    test("function declarations in methods can call private methods", () => {
+        class B {
+            #double(x) {
+                return x * 2;
+            }
+            run(x) {
+                const self = this;
+                function call() {
+                    return self.#double(x);
+                }
+                return call();
+            }
+        }
+        expect(new B().run(21)).toBe(42);
+    });
+
+    test("private brand checks", () => {
+        class C {
+            #field;
+            static check() {
+                return function (object) {
+                    return #field in object;
+                };
+            }
+        }
+        expect(C.check()(new C())).toBeTrue();
+        expect(C.check()({})).toBeFalse();
+    });
+});
+
+describe("async and generator functions", () => {
+    test("async function declarations", () => {
+        async function add(a, b) {
+            return (await a) + (await b);
+        }
+        let result;
+        add(Promise.resolve(1), 2).then(value => {
+            result = value;
+        });
+        runQueuedPromiseJobs();
+        expect(result).toBe(3);
+    });
+
+    test("generator function declarations", () => {
+        function* count(limit) {
+            for (let i = 0; i < limit; i++) yield i;
+        }
+        expect([...count(3)]).toEqual([0, 1, 2]);
+    });
+
+    test("async generator function expressions", () => {
+        const generate = async function* () {
+            yield 1;
+            yield await Promise.resolve(2);
+        };
+        const values = [];
+        (async () => {
+            for await (const value of generate()) values.push(value);
+        })();
+        runQueuedPromiseJobs();
+        expect(values).toEqual([1, 2]);
+    });
+
+    test("parameter errors in async functions reject", () => {
+        async function throwing(a = undefinedBinding) {}
+        let error;
+        throwing().catch(e => {
+            error = e;
+        });
+        runQueuedPromiseJobs();
+        expect(error).toBeInstanceOf(ReferenceError);
+    });
+
+    test("generators capture outer bindings", () => {
+        let base = 10;
+        function* fromBase() {
+            yield base++;
+            yield base++;
+        }
+        expect([...fromBase()]).toEqual([10, 11]);
+        expect(base).toBe(12);
+    });
+});
+
+describe("Annex B function hoisting", () => {
+    test("functions declared in blocks are hoisted to the enclosing function", () => {
+        function outer() {
+            const before = typeof hoisted;
+            {
+                function hoisted() {
+                    return "hoisted";
+                }
+            }
+            return [before, hoisted()];
+        }
+        expect(outer()).toEqual(["undefined", "hoisted"]);
+    });
+
+    test("hoisting is skipped when it would conflict with a lexical binding", () => {
+        function outer() {
+            let conflicting = "lexical";
+            {
+                function conflicting() {}
+            }
+            return conflicting;
+        }
+        expect(outer()).toBe("lexical");
+    });
+
+    test("functions declared in if statements", () => {
+        function outer(flag) {
+            if (flag)
+                function conditional() {
+                    return "declared";
+                }
+            return typeof conditional === "function" ? conditional() : "missing";
+        }
+        expect(outer(true)).toBe("declared");
+        expect(outer(false)).toBe("missing");
+    });
+
+    test("hoisted functions are not hoisted in strict mode", () => {
+        function outer() {
+            "use strict";
+            {
+                function blockScoped() {}
+            }
+            return typeof blockScoped;
+        }
+        expect(outer()).toBe("undefined");
+    });
+});
+
+describe("reparse context", () => {
+    test("strict mode is inherited from the enclosing function", () => {
+        function outer() {
+            "use strict";
+            return function () {
+                return this;
+            };
+        }
+        expect(outer()()).toBeUndefined();
+    });
+
+    test("functions that are never called are not compiled", () => {
+        function neverCalled() {
+            throw new Error("should not run");
+        }
+        expect(typeof neverCalled).toBe("function");
+        expect(neverCalled.length).toBe(0);
+    });
+
+    test("functions are only reparsed once", () => {
+        let calls = 0;
+        function counted() {
+            return ++calls;
+        }
+        for (let i = 0; i < 3; i++) counted();
+        expect(calls).toBe(3);
+    });
+});
@@ -0,0 +1,164 @@
+// These tests make property access sites see many more shapes than their inline caches can remember,
+// so that they go through the VM-wide megamorphic cache.
+
+function makeObjectsWithDistinctShapes(count) {
+    const objects = [];
+    for (let i = 0; i < count; i++) {
+        const object = {};
+        object["padding" + i] = i;
+        object.value = i;
+        objects.push(object);
+    }
+    return objects;
+}
+
+describe("megamorphic property get", () => {
+    test("own properties", () => {
+        const objects = makeObjectsWithDistinctShapes(32);
+        const read = object => object.value;
+        for (let round = 0; round < 3; round++) {
+            for (let i = 0; i < objects.length; i++) expect(read(objects[i])).toBe(i);
+        }
+    });
+
+    test("properties in the prototype chain", () => {
+        const prototypes = makeObjectsWithDistinctShapes(32);
+        const objects = prototypes.map(prototype => Object.create(prototype));
+        const read = object => object.value;
+        for (let round = 0; round < 3; round++) {
+            for (let i = 0; i < objects.length; i++) expect(read(objects[i])).toBe(i);
+        }
+    });
+
+    test("prototype mutation invalidates cached lookups", () => {
+        const prototypes = makeObjectsWithDistinctShapes(32);
+        const objects = prototypes.map(prototype => Object.create(prototype));
+        const read = object => object.value;
+        for (let i = 0; i < objects.length; i++) expect(read(objects[i])).toBe(i);
+
+        for (let i = 0; i < prototypes.length; i++) prototypes[i].value = -i;
+        for (let i = 0; i < objects.length; i++) expect(read(objects[i])).toBe(-i);
+
+        for (let i = 0; i < prototypes.length; i++) delete prototypes[i].value;
+        for (let i = 0; i < objects.length; i++) expect(read(objects[i])).toBeUndefined();
+    });
+
+    test("shadowing property added to an object", () => {
+        const objects = makeObjectsWithDistinctShapes(32);
+        const read = object => object.value;
+        for (let i = 0; i < objects.length; i++) expect(read(objects[i])).toBe(i);
+
+        const shadowed = Object.create(objects[5]);
+        expect(read(shadowed)).toBe(5);
+        shadowed.value = "own";
+        expect(read(shadowed)).toBe("own");
+    });
+
+    test("getters", () => {
+        const objects = [];
+        for (let i = 0; i < 32; i++) {
+            const object = {};
+            object["padding" + i] = i;
+            Object.defineProperty(object, "value", { get: () => i * 2 });
+            objects.push(object);
+        }
+        const read = object => object.value;
+        for (let round = 0; round < 3; round++) {
+            for (let i = 0; i < objects.length; i++) expect(read(objects[i])).toBe(i * 2);
+        }
+    });
+
+    test("dictionary objects", () => {
+        const objects = makeObjectsWithDistinctShapes(32);
+        for (const object of objects) {
+            for (let i = 0; i < 100; i++) object["extra" + i] = i;
+            for (let i = 0; i < 100; i++) delete object["extra" + i];
+        }
+        const read = object => object.value;
+        for (let i = 0; i < objects.length; i++) expect(read(objects[i])).toBe(i);
+
+        for (let i = 0; i < objects.length; i++) {
+            delete objects[i].value;
+            objects[i].other = 1;
+            objects[i].value = i + 100;
+        }
+        for (let i = 0; i < objects.length; i++) expect(read(objects[i])).toBe(i + 100);
+    });
+});
+
+describe("megamorphic property put", () => {
+    test("changing own properties", () => {
+        const objects = makeObjectsWithDistinctShapes(32);
+        const write = (object, value) => {
+            object.value = value;
+        };
+        for (let round = 0; round < 3; round++) {
+            for (let i = 0; i < objects.length; i++) write(objects[i], i + round);
+            for (let i = 0; i < objects.length; i++) expect(objects[i].value).toBe(i + round);
+        }
+    });
+
+    test("adding own properties", () => {
+        const write = (object, value) => {
+            object.added = value;
+        };
+        for (let round = 0; round < 3; round++) {
+            const objects = makeObjectsWithDistinctShapes(32);
+            for (let i = 0; i < objects.length; i++) write(objects[i], i);
+            for (let i = 0; i < objects.length; i++) {
+                expect(objects[i].added).toBe(i);
+                expect(Object.getOwnPropertyNames(objects[i])).toEqual(["padding" + i, "value", "added"]);
+            }
+        }
+    });
+
+    test("setter added to the prototype chain is respected", () => {
+        const write = (object, value) => {
+            object.added = value;
+        };
+        const prototypes = makeObjectsWithDistinctShapes(32);
+        for (let i = 0; i < prototypes.length; i++) write(Object.create(prototypes[i]), i);
+
+        let setterCalls = 0;
+        for (const prototype of prototypes) {
+            Object.defineProperty(prototype, "added", {
+                set() {
+                    setterCalls++;
+                },
+            });
+        }
+
+        const objects = prototypes.map(prototype => Object.create(prototype));
+        for (let i = 0; i < objects.length; i++) write(objects[i], i);
+        expect(setterCalls).toBe(32);
+        for (const object of objects) expect(Object.hasOwn(object, "added")).toBeFalse();
+    });
+
+    test("non-extensible objects are not extended", () => {
+        const write = (object, value) => {
+            object.added = value;
+        };
+        for (const object of makeObjectsWithDistinctShapes(32)) write(object, 1);
+
+        const objects = makeObjectsWithDistinctShapes(32);
+        for (const object of objects) {
+            Object.preventExtensions(object);
+            write(object, 1);
+            expect(Object.hasOwn(object, "added")).toBeFalse();
+        }
+    });
+
+    test("frozen objects are not modified", () => {
+        const write = (object, value) => {
+            object.value = value;
+        };
+        const objects = makeObjectsWithDistinctShapes(32);
+        for (let i = 0; i < objects.length; i++) write(objects[i], i);
+
+        const frozen = makeObjectsWithDistinctShapes(32).map(object => Object.freeze(object));
+        for (let i = 0; i < frozen.length; i++) {
+            write(frozen[i], -1);
+            expect(frozen[i].value).toBe(i);
+        }
+    });
+});
@@ -272,4 +272,8 @@ describe("scoping in modules", () => {
     test("functions within functions", () => {
         expectModulePassed("./function-in-function.mjs");
     });
+
+    test("lazily compiled functions", () => {
+        expectModulePassed("./function-lazy-reparse.mjs");
+    });
 });
@@ -0,0 +1,52 @@
+// Module functions are parsed again from the module's source text when first called. They must still see
+// imports, module-level lexical bindings and the module's strictness.
+
+import { defaultValue } from "./module-with-default.mjs";
+
+let counter = 0;
+const base = 40;
+
+function readImport() {
+    return defaultValue;
+}
+
+function increment() {
+    return ++counter;
+}
+
+function isStrict() {
+    return this === undefined;
+}
+
+const addBase = function (value) {
+    return base + value;
+};
+
+async function asyncAddBase(value) {
+    return addBase(await value);
+}
+
+function* countUp() {
+    yield increment();
+    yield increment();
+}
+
+export default function () {
+    return "default export";
+}
+
+export function exported() {
+    return addBase(2);
+}
+
+const asyncResult = await asyncAddBase(Promise.resolve(2));
+
+export const passed =
+    readImport() === "Well hello importer :^)" &&
+    increment() === 1 &&
+    isStrict() &&
+    addBase(2) === 42 &&
+    exported() === 42 &&
+    [...countUp()].join() === "2,3" &&
+    counter === 3 &&
+    asyncResult === 42;
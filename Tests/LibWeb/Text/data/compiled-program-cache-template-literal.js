@@ -0,0 +1,69 @@
+// This script is deliberately larger than CompiledProgramCache::minimum_cached_source_length, so that every
+// document loading it shares the same compiled executable (and with it, the same template object cache).
+//
+// The quick brown fox jumps over the lazy dog. Pack my box with five dozen liquor jugs.
+// The quick brown fox jumps over the lazy dog. Pack my box with five dozen liquor jugs.
+// The quick brown fox jumps over the lazy dog. Pack my box with five dozen liquor jugs.
+// The quick brown fox jumps over the lazy dog. Pack my box with five dozen liquor jugs.
+// The quick brown fox jumps over the lazy dog. Pack my box with five dozen liquor jugs.
+// The quick brown fox jumps over the lazy dog. Pack my box with five dozen liquor jugs.
+// The quick brown fox jumps over the lazy dog. Pack my box with five dozen liquor jugs.
+// The quick brown fox jumps over the lazy dog. Pack my box with five dozen liquor jugs.
+// The quick brown fox jumps over the lazy dog. Pack my box with five dozen liquor jugs.
+// The quick brown fox jumps over the lazy dog. Pack my box with five dozen liquor jugs.
+// The quick brown fox jumps over the lazy dog. Pack my box with five dozen liquor jugs.
+// The quick brown fox jumps over the lazy dog. Pack my box with five dozen liquor jugs.
+// The quick brown fox jumps over the lazy dog. Pack my box with five dozen liquor jugs.
+// The quick brown fox jumps over the lazy dog. Pack my box with five dozen liquor jugs.
+// The quick brown fox jumps over the lazy dog. Pack my box with five dozen liquor jugs.
+// The quick brown fox jumps over the lazy dog. Pack my box with five dozen liquor jugs.
+// The quick brown fox jumps over the lazy dog. Pack my box with five dozen liquor jugs.
+// The quick brown fox jumps over the lazy dog. Pack my box with five dozen liquor jugs.
+// The quick brown fox jumps over the lazy dog. Pack my box with five dozen liquor jugs.
+// The quick brown fox jumps over the lazy dog. Pack my box with five dozen liquor jugs.
+// The quick brown fox jumps over the lazy dog. Pack my box with five dozen liquor jugs.
+// The quick brown fox jumps over the lazy dog. Pack my box with five dozen liquor jugs.
+// The quick brown fox jumps over the lazy dog. Pack my box with five dozen liquor jugs.
+// The quick brown fox jumps over the lazy dog. Pack my box with five dozen liquor jugs.
+// The quick brown fox jumps over the lazy dog. Pack my box with five dozen liquor jugs.
+// The quick brown fox jumps over the lazy dog. Pack my box with five dozen liquor jugs.
+// The quick brown fox jumps over the lazy dog. Pack my box with five dozen liquor jugs.
+// The quick brown fox jumps over the lazy dog. Pack my box with five dozen liquor jugs.
+// The quick brown fox jumps over the lazy dog. Pack my box with five dozen liquor jugs.
+// The quick brown fox jumps over the lazy dog. Pack my box with five dozen liquor jugs.
+// The quick brown fox jumps over the lazy dog. Pack my box with five dozen liquor jugs.
+// The quick brown fox jumps over the lazy dog. Pack my box with five dozen liquor jugs.
+// The quick brown fox jumps over the lazy dog. Pack my box with five dozen liquor jugs.
+// The quick brown fox jumps over the lazy dog. Pack my box with five dozen liquor jugs.
+// The quick brown fox jumps over the lazy dog. Pack my box with five dozen liquor jugs.
+// The quick brown fox jumps over the lazy dog. Pack my box with five dozen liquor jugs.
+// The quick brown fox jumps over the lazy dog. Pack my box with five dozen liquor jugs.
+// The quick brown fox jumps over the lazy dog. Pack my box with five dozen liquor jugs.
+// The quick brown fox jumps over the lazy dog. Pack my box with five dozen liquor jugs.
+// The quick brown fox jumps over the lazy dog. Pack my box with five dozen liquor jugs.
+// The quick brown fox jumps over the lazy dog. Pack my box with five dozen liquor jugs.
+// The quick brown fox jumps over the lazy dog. Pack my box with five dozen liquor jugs.
+// The quick brown fox jumps over the lazy dog. Pack my box with five dozen liquor jugs.
+// The quick brown fox jumps over the lazy dog. Pack my box with five dozen liquor jugs.
+// The quick brown fox jumps over the lazy dog. Pack my box with five dozen liquor jugs.
+// The quick brown fox jumps over the lazy dog. Pack my box with five dozen liquor jugs.
+// The quick brown fox jumps over the lazy dog. Pack my box with five dozen liquor jugs.
+// The quick brown fox jumps over the lazy dog. Pack my box with five dozen liquor jugs.
+// The quick brown fox jumps over the lazy dog. Pack my box with five dozen liquor jugs.
+// The quick brown fox jumps over the lazy dog. Pack my box with five dozen liquor jugs.
+// The quick brown fox jumps over the lazy dog. Pack my box with five dozen liquor jugs.
+// The quick brown fox jumps over the lazy dog. Pack my box with five dozen liquor jugs.
+// The quick brown fox jumps over the lazy dog. Pack my box with five dozen liquor jugs.
+// The quick brown fox jumps over the lazy dog. Pack my box with five dozen liquor jugs.
+
+function tag(strings) {
+    return strings;
+}
+
+function templateObjectFromSite() {
+    return tag`cached ${1} template`;
+}
+
+window.templateObject = templateObjectFromSite();
+window.templateObjectsPerScript = window.templateObjectsPerScript ?? [];
+window.templateObjectsPerScript.push([window.templateObject, templateObjectFromSite()]);
@@ -13,7 +13,9 @@
 #include <LibCore/ArgsParser.h>
 #include <LibCore/ConfigFile.h>
 #include <LibCore/StandardPaths.h>
+#include <LibJS/Bytecode/Executable.h>
 #include <LibJS/Bytecode/Interpreter.h>
+#include <LibJS/CompiledProgramCache.h>
 #include <LibJS/Console.h>
 #include <LibJS/Contrib/Test262/GlobalObject.h>
 #include <LibJS/Print.h>
@@ -22,6 +24,8 @@
 #include <LibJS/Runtime/GlobalEnvironment.h>
 #include <LibJS/Runtime/JSONObject.h>
 #include <LibJS/Runtime/Reference.h>
+#include <LibJS/Runtime/RegExpCache.h>
+#include <LibJS/Runtime/SamplingProfiler.h>
 #include <LibJS/Runtime/StringPrototype.h>
 #include <LibJS/Runtime/ValueInlines.h>
 #include <LibJS/RustFFI.h>
@@ -89,6 +93,8 @@ private:
 GC_DEFINE_ALLOCATOR(ScriptObject);
 
 static bool s_dump_ast = false;
+static bool s_dump_lazy_compilation_statistics = false;
+static bool s_dump_cache_statistics = false;
 static bool s_as_module = false;
 static bool s_print_last_result = false;
 static bool s_strip_ansi = false;
@@ -834,6 +840,46 @@ static ErrorOr<int> run_repl(bool gc_on_every_allocation, bool syntax_highlight)
 
 #endif
 
+static ErrorOr<void> write_profile(JS::SamplingProfiler const& profiler, StringView path)
+{
+    auto collapsed_stacks_path = ByteString::formatted("{}.folded", path);
+    auto collapsed_stacks_file = TRY(Core::File::open(collapsed_stacks_path, Core::File::OpenMode::Write, 0666));
+    TRY(collapsed_stacks_file->write_until_depleted(profiler.to_collapsed_stacks().bytes()));
+
+    auto chrome_trace_path = ByteString::formatted("{}.json", path);
+    auto chrome_trace_file = TRY(Core::File::open(chrome_trace_path, Core::File::OpenMode::Write, 0666));
+    TRY(chrome_trace_file->write_until_depleted(profiler.to_chrome_trace().bytes()));
+
+    warnln("Wrote {} profiler samples to {} and {}", profiler.sample_count(), collapsed_stacks_path, chrome_trace_path);
+    return {};
+}
+
+static void dump_lazy_compilation_statistics()
+{
+    auto const& statistics = g_vm->lazy_compilation_statistics();
+    warnln("Lazy compilation statistics:");
+    warnln("  Compiled: {} functions, {} code units of source, {} bytes of bytecode",
+        statistics.functions_compiled, statistics.source_code_units_compiled, statistics.bytecode_bytes_compiled);
+    warnln("  Never compiled: {} functions, {} code units of source ({} functions, {} code units still alive)",
+        statistics.functions_never_compiled + statistics.functions_awaiting_compilation,
+        statistics.source_code_units_never_compiled + statistics.source_code_units_awaiting_compilation,
+        statistics.functions_awaiting_compilation, statistics.source_code_units_awaiting_compilation);
+}
+
+static void dump_cache_statistics(JS::Realm const& realm)
+{
+    warnln("Cache statistics:");
+    auto const& compiled_program_cache = g_vm->compiled_program_cache();
+    warnln("  Compiled programs: {} hits, {} misses", compiled_program_cache.hit_count(), compiled_program_cache.miss_count());
+    auto const& megamorphic_property_cache = g_vm->megamorphic_property_cache();
+    warnln("  Megamorphic property lookups: {} hits, {} misses", megamorphic_property_cache.hit_count, megamorphic_property_cache.miss_count);
+    auto const& intl_formatter_cache = realm.intl_formatter_cache().statistics();
+    warnln("  Intl formatters: {} hits, {} misses, {} evictions, {} uncacheable lookups",
+        intl_formatter_cache.hits, intl_formatter_cache.misses, intl_formatter_cache.evictions, intl_formatter_cache.uncacheable_lookups);
+    auto regexp_cache = JS::RegExpCache::the().statistics();
+    warnln("  Compiled regular expressions: {} hits, {} misses, {} evictions", regexp_cache.hits, regexp_cache.misses, regexp_cache.evictions);
+}
+
 ErrorOr<int> ladybird_main(Main::Arguments arguments)
 {
     bool gc_on_every_allocation = false;
@@ -842,6 +888,7 @@ ErrorOr<int> ladybird_main(Main::Arguments arguments)
     bool use_test262_global = false;
     bool parse_only = false;
     StringView evaluate_script;
+    StringView profile_path;
     Vector<StringView> script_paths;
 
     Core::ArgsParser args_parser;
@@ -849,6 +896,9 @@ ErrorOr<int> ladybird_main(Main::Arguments arguments)
     args_parser.add_option(parse_only, "Parse only", "parse-only", 'p');
     args_parser.add_option(s_dump_ast, "Dump the AST", "dump-ast", 'A');
     args_parser.add_option(JS::Bytecode::g_dump_bytecode, "Dump the bytecode", "dump-bytecode", 'd');
+    args_parser.add_option(s_dump_lazy_compilation_statistics, "Dump statistics about lazily compiled functions on exit", "dump-lazy-compilation-stats", {});
+    args_parser.add_option(s_dump_cache_statistics, "Dump hit and miss counts of the engine's caches on exit", "dump-cache-stats", {});
+    args_parser.add_option(profile_path, "Profile execution, writing <path>.folded (collapsed stacks) and <path>.json (Chrome trace)", "profile", {}, "path");
     args_parser.add_option(s_as_module, "Treat as module", "as-module", 'm');
     args_parser.add_option(s_print_last_result, "Print last result", "print-last-result", 'l');
     args_parser.add_option(s_strip_ansi, "Disable ANSI colors", "disable-ansi-colors", 'i');
@@ -946,8 +996,23 @@ ErrorOr<int> ladybird_main(Main::Arguments arguments)
 
         // We resolve modules as if it is the first file
 
-        if (!TRY(parse_and_run(realm, builder.string_view(), source_name, parse_only)))
+        if (!profile_path.is_empty())
+            g_vm->ensure_sampling_profiler().start();
+
+        auto success = TRY(parse_and_run(realm, builder.string_view(), source_name, parse_only));
+
+        if (auto* profiler = g_vm->sampling_profiler(); profiler && profiler->is_running()) {
+            profiler->stop();
+            TRY(write_profile(*profiler, profile_path));
+        }
+
+        if (!success)
             return 1;
+
+        if (s_dump_lazy_compilation_statistics)
+            dump_lazy_compilation_statistics();
+        if (s_dump_cache_statistics)
+            dump_cache_statistics(realm);
     }
 
     return s_exit_code;
@@ -25,6 +25,7 @@
 #    include <LibLine/Editor.h>
 #endif
 #include <LibMain/Main.h>
+#include <LibThreading/Thread.h>
 #include <LibWasm/AbstractMachine/AbstractMachine.h>
 #include <LibWasm/AbstractMachine/BytecodeInterpreter.h>
 #include <LibWasm/Printer/Printer.h>
@@ -306,6 +307,7 @@ ErrorOr<int> ladybird_main(Main::Arguments arguments)
     [[maybe_unused]] bool wasi = false;
     Optional<u64> specific_function_address;
     ByteString exported_function_to_execute;
+    size_t thread_count = 1;
     Vector<ParsedValue> values_to_push;
     Vector<ByteString> modules_to_link_in;
     Vector<StringView> args_if_wasi;
@@ -325,6 +327,7 @@ ErrorOr<int> ladybird_main(Main::Arguments arguments)
     parser.add_option(attempt_instantiate, "Attempt to instantiate the module", "instantiate", 'i');
     parser.add_option(exported_function_to_execute, "Attempt to execute the named exported function from the module (implies -i)", "execute", 'e', "name");
     parser.add_option(export_all_imports, "Export noop functions corresponding to imports", "export-noop");
+    parser.add_option(thread_count, "Execute the exported function on this many threads at once, each in its own instance of the module sharing only its imported memories", "threads", 't', "count");
 #if !defined(AK_OS_WINDOWS)
     parser.add_option(wasi, "Enable WASI", "wasi", 'w');
 #endif
@@ -716,7 +719,8 @@ ErrorOr<int> ladybird_main(Main::Arguments arguments)
             return 1;
         }
 
-        auto result = machine.instantiate(*parse_result, link_result.release_value());
+        auto imports = link_result.release_value();
+        auto result = machine.instantiate(*parse_result, imports);
         if (result.is_error()) {
             warnln("Module instantiation failed: {}", result.error().error);
             return 1;
@@ -838,14 +842,19 @@ ErrorOr<int> ladybird_main(Main::Arguments arguments)
         }
 
         if (!exported_function_to_execute.is_empty()) {
-            Optional<Wasm::FunctionAddress> run_address;
-            Vector<Wasm::Value> values;
-            for (auto& entry : module_instance->exports()) {
-                if (entry.name() == exported_function_to_execute) {
-                    if (auto addr = entry.value().get_pointer<Wasm::FunctionAddress>())
-                        run_address = *addr;
+            auto find_function_to_execute = [&](Wasm::ModuleInstance const& instance) -> Optional<Wasm::FunctionAddress> {
+                Optional<Wasm::FunctionAddress> address;
+                for (auto& entry : instance.exports()) {
+                    if (entry.name() == exported_function_to_execute) {
+                        if (auto addr = entry.value().get_pointer<Wasm::FunctionAddress>())
+                            address = *addr;
+                    }
                 }
-            }
+                return address;
+            };
+
+            Optional<Wasm::FunctionAddress> run_address = find_function_to_execute(*module_instance);
+            Vector<Wasm::Value> values;
             if (!run_address.has_value()) {
                 warnln("No such exported function, sorry :(");
                 return 1;
@@ -876,22 +885,79 @@ ErrorOr<int> ladybird_main(Main::Arguments arguments)
                 outln();
             }
 
-            auto result = machine.invoke(g_interpreter, run_address.value(), move(values));
-            if (result.is_trap()) {
-                auto trap_reason = result.trap().format();
-                if (trap_reason.starts_with("exit:"sv))
-                    return -trap_reason.substring_view(5).to_number<i32>().value_or(-1);
-                warnln("Execution trapped: {}", trap_reason);
-            } else {
-                if (!result.values().is_empty())
-                    warnln("Returned:");
-                auto result_type = instance->get<Wasm::WasmFunction>().type().results();
-                size_t index = 0;
-                for (auto& value : result.values()) {
-                    g_stdout->write_until_depleted("  -> "sv.bytes()).release_value_but_fixme_should_propagate_errors();
-                    g_printer->print(value, result_type[index]);
-                    ++index;
+            auto report_result = [&](Wasm::Result& result) -> Optional<int> {
+                if (result.is_trap()) {
+                    auto trap_reason = result.trap().format();
+                    if (trap_reason.starts_with("exit:"sv))
+                        return -trap_reason.substring_view(5).to_number<i32>().value_or(-1);
+                    warnln("Execution trapped: {}", trap_reason);
+                } else {
+                    if (!result.values().is_empty())
+                        warnln("Returned:");
+                    auto result_type = instance->get<Wasm::WasmFunction>().type().results();
+                    size_t index = 0;
+                    for (auto& value : result.values()) {
+                        g_stdout->write_until_depleted("  -> "sv.bytes()).release_value_but_fixme_should_propagate_errors();
+                        g_printer->print(value, result_type[index]);
+                        ++index;
+                    }
                 }
+                return {};
+            };
+
+            if (thread_count <= 1) {
+                auto result = machine.invoke(g_interpreter, run_address.value(), move(values));
+                if (auto exit_code = report_result(result); exit_code.has_value())
+                    return *exit_code;
+                return 0;
+            }
+
+            // Run the function on several threads at once, the way a pthreads build runs its workers: every thread
+            // instantiates the module on its own, with the same imports. The instances' globals, tables and memories are
+            // their own, and the only state they share is the memory they import, which therefore has to be shared.
+            for (auto const& extern_value : imports) {
+                auto const* memory_address = extern_value.get_pointer<Wasm::MemoryAddress>();
+                if (memory_address && !machine.store().get(*memory_address)->is_shared()) {
+                    warnln("Running on several threads requires the module's imported memories to be shared");
+                    return 1;
+                }
+            }
+
+            // NB: The store is not thread-safe, so all instances are created up front, before any thread runs.
+            Vector<NonnullOwnPtr<Wasm::ModuleInstance>> thread_instances;
+            Vector<Wasm::FunctionAddress> thread_run_addresses;
+            thread_run_addresses.append(*run_address);
+            for (size_t i = 1; i < thread_count; ++i) {
+                auto thread_instance = machine.instantiate(*parse_result, imports);
+                if (thread_instance.is_error()) {
+                    warnln("Module instantiation for thread {} failed: {}", i, thread_instance.error().error);
+                    return 1;
+                }
+                thread_instances.append(thread_instance.release_value());
+                thread_run_addresses.append(find_function_to_execute(*thread_instances.last()).release_value());
+            }
+
+            // Each thread gets its own interpreter, the results are reported in thread order.
+            Vector<Optional<Wasm::Result>> results;
+            results.resize(thread_count);
+            Vector<NonnullRefPtr<Threading::Thread>> threads;
+            for (size_t i = 0; i < thread_count; ++i) {
+                threads.append(Threading::Thread::construct(ByteString::formatted("wasm thread {}", i), [&, i, values]() mutable -> intptr_t {
+                    StackInfo stack_info;
+                    Wasm::BytecodeInterpreter interpreter(stack_info);
+                    results[i] = machine.invoke(interpreter, thread_run_addresses[i], move(values));
+                    return 0;
+                }));
+            }
+            for (auto& thread : threads)
+                thread->start();
+            for (auto& thread : threads)
+                (void)thread->join();
+
+            for (size_t i = 0; i < thread_count; ++i) {
+                warnln("Thread {}:", i);
+                if (auto exit_code = report_result(*results[i]); exit_code.has_value())
+                    return *exit_code;
             }
         }
     }